@@ -110,6 +110,14 @@ ifneq ($(BOARD_USE_MAX_SECURE_RESOURCE),)
 EXYNOS_GLOBAL_CFLAGS += -DMAX_SECURE_RESOURCE=$(BOARD_USE_MAX_SECURE_RESOURCE)
 endif
 
+ifneq ($(BOARD_USE_MAX_MFC_MB_PER_SEC),)
+EXYNOS_GLOBAL_CFLAGS += -DMAX_MFC_MB_PER_SEC=$(BOARD_USE_MAX_MFC_MB_PER_SEC)
+endif
+
+ifneq ($(BOARD_USE_MAX_MFC_BITRATE),)
+EXYNOS_GLOBAL_CFLAGS += -DMAX_MFC_BITRATE=$(BOARD_USE_MAX_MFC_BITRATE)
+endif
+
 ####################################
 ####  libExynosC2ComponentStore  ###
 ####################################
@@ -119,7 +127,8 @@ LOCAL_CFLAGS :=
 LOCAL_MODULE_TAGS := optional
 
 LOCAL_SRC_FILES := \
-        Exynos_C2_ComponentStore.cpp
+        Exynos_C2_ComponentStore.cpp \
+        Exynos_C2_ComponentRM.cpp
 
 LOCAL_C_INCLUDES :=
 
@@ -160,6 +169,49 @@ LOCAL_CFLAGS += $(EXYNOS_GLOBAL_CFLAGS)
 
 include $(BUILD_SHARED_LIBRARY)
 
+####################################
+####  ExynosC2ComponentRMTest  #####
+####################################
+include $(CLEAR_VARS)
+
+LOCAL_CFLAGS :=
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_SRC_FILES := \
+        Exynos_C2_ComponentRM.cpp \
+        tests/ExynosC2ComponentRM_test.cpp
+
+LOCAL_C_INCLUDES :=
+
+LOCAL_MODULE := ExynosC2ComponentRMTest
+LOCAL_LICENSE_KINDS := SPDX-license-identifier-Apache-2.0
+LOCAL_LICENSE_CONDITIONS := notice
+LOCAL_NOTICE_FILE := $(LOCAL_PATH)/NOTICE
+
+LOCAL_PROPRIETARY_MODULE := true
+
+LOCAL_HEADER_LIBRARIES := libexynosc2_base_headers libexynosc2_osal_headers
+LOCAL_HEADER_LIBRARIES += $(EXYNOS_VENDOR_HEADER_LIBS)
+
+LOCAL_STATIC_LIBRARIES := libExynosC2OSAL
+
+LOCAL_SHARED_LIBRARIES := \
+        liblog \
+        libutils \
+        libcutils \
+        libstagefright_xmlparser
+LOCAL_SHARED_LIBRARIES += $(EXYNOS_VENDOR_SHARED_LIBS)
+
+LOCAL_CFLAGS +=	-O2 \
+                -Werror \
+                -Wall \
+                -Wno-deprecated-enum-enum-conversion \
+                -std=gnu++1z \
+                -std=c++2a
+LOCAL_CFLAGS += $(EXYNOS_GLOBAL_CFLAGS)
+
+include $(BUILD_NATIVE_TEST)
+
 
 #############################
 ####  libExynosC2H264Dec  ###
@@ -1228,6 +1280,91 @@ LOCAL_CFLAGS += $(EXYNOS_DEC_CFLAGS)
 
 include $(BUILD_SHARED_LIBRARY)
 
+###################################
+####  ExynosC2FilterBenchmark  ###
+###################################
+include $(CLEAR_VARS)
+
+LOCAL_CFLAGS :=
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_SRC_FILES := \
+        filter/Exynos_Filter.cpp \
+        filter/benchmark/Exynos_Filter_Benchmark.cpp
+
+LOCAL_C_INCLUDES :=
+
+LOCAL_MODULE := ExynosC2FilterBenchmark
+LOCAL_LICENSE_KINDS := SPDX-license-identifier-Apache-2.0
+LOCAL_LICENSE_CONDITIONS := notice
+LOCAL_NOTICE_FILE := $(LOCAL_PATH)/NOTICE
+
+LOCAL_PROPRIETARY_MODULE := true
+
+LOCAL_HEADER_LIBRARIES := libexynosc2_filter_headers
+LOCAL_HEADER_LIBRARIES += $(EXYNOS_VENDOR_HEADER_LIBS)
+
+LOCAL_STATIC_LIBRARIES := libExynosC2OSAL
+
+LOCAL_SHARED_LIBRARIES := \
+        liblog \
+        libutils \
+        libcutils
+LOCAL_SHARED_LIBRARIES += $(EXYNOS_VENDOR_SHARED_LIBS)
+
+LOCAL_CFLAGS +=	-O3 \
+                -Werror \
+                -Wall \
+                -Wno-deprecated-enum-enum-conversion \
+                -std=gnu++1z \
+                -std=c++2a
+LOCAL_CFLAGS += $(EXYNOS_GLOBAL_CFLAGS)
+
+include $(BUILD_EXECUTABLE)
+
+###################################
+####  ExynosC2FilterTest  #########
+###################################
+include $(CLEAR_VARS)
+
+LOCAL_CFLAGS :=
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_SRC_FILES := \
+        filter/Exynos_Filter.cpp \
+        filter/tests/ExynosFilterWork_test.cpp \
+        filter/tests/ExynosFilterParam_test.cpp
+
+LOCAL_C_INCLUDES :=
+
+LOCAL_MODULE := ExynosC2FilterTest
+LOCAL_LICENSE_KINDS := SPDX-license-identifier-Apache-2.0
+LOCAL_LICENSE_CONDITIONS := notice
+LOCAL_NOTICE_FILE := $(LOCAL_PATH)/NOTICE
+
+LOCAL_PROPRIETARY_MODULE := true
+
+LOCAL_HEADER_LIBRARIES := libexynosc2_filter_headers
+LOCAL_HEADER_LIBRARIES += $(EXYNOS_VENDOR_HEADER_LIBS)
+
+LOCAL_STATIC_LIBRARIES := libExynosC2OSAL
+
+LOCAL_SHARED_LIBRARIES := \
+        liblog \
+        libutils \
+        libcutils
+LOCAL_SHARED_LIBRARIES += $(EXYNOS_VENDOR_SHARED_LIBS)
+
+LOCAL_CFLAGS +=	-O2 \
+                -Werror \
+                -Wall \
+                -Wno-deprecated-enum-enum-conversion \
+                -std=gnu++1z \
+                -std=c++2a
+LOCAL_CFLAGS += $(EXYNOS_GLOBAL_CFLAGS)
+
+include $(BUILD_NATIVE_TEST)
+
 include $(EXYNOS_CODEC2_TOP)/osal/Android.mk
 include $(EXYNOS_CODEC2_TOP)/videocodec/Android.mk
 include $(EXYNOS_CODEC2_TOP)/csc/Android.mk
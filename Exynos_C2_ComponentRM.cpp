@@ -0,0 +1,235 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <mutex>
+
+#include "ExynosDef.h"
+#include "Exynos_C2_ComponentRM.h"
+
+#define LOG_ON
+#include "ExynosLog.h"
+#define LOG_TAG "ExynosC2ComponentRM"
+
+static std::mutex gMutex;
+static std::shared_ptr<ExynosC2ComponentRM> gComponentRM;
+
+std::shared_ptr<ExynosC2ComponentRM> ExynosC2ComponentRM::getInstance() {
+    std::lock_guard<std::mutex> lock(gMutex);
+
+    if (gComponentRM.get() == nullptr) {
+        auto delfunc = [](ExynosC2ComponentRM *p) {
+                            if (p != nullptr) {
+                                delete p;
+                            }
+                       };
+        gComponentRM = std::shared_ptr<ExynosC2ComponentRM>(new ExynosC2ComponentRM(),
+                                                            std::move(delfunc));
+    }
+
+    return gComponentRM;
+}
+
+uint64_t ExynosC2ComponentRM::Load::getMbPerSec() const {
+    uint64_t mbs = (uint64_t)((width + 15) / 16) * ((height + 15) / 16);
+
+    return mbs * ((frameRate > 0)? frameRate:DEFAULT_RM_FRAME_RATE);
+}
+
+/* operating rate is used only if it is valid, otherwise the stream rate is used */
+void ExynosC2ComponentRM::Load::setFrameRate(int32_t streamRate, int32_t operateRate) {
+    if ((streamRate <= 0) ||
+        (streamRate > MAX_RM_FRAME_RATE)) {
+        streamRate = 0;
+    }
+
+    if ((operateRate <= 0) ||
+        (operateRate > MAX_RM_FRAME_RATE)) {
+        operateRate = 0;
+    }
+
+    frameRate = (uint32_t)MAX(streamRate, operateRate);
+}
+
+ExynosC2ComponentRM::ExynosC2ComponentRM() : ExynosLog() {
+    mObjName = "ExynosC2ComponentRM";
+    mbLogOff = false;
+
+    for (int i = 0; i < RESOURCE_MAX; i++) {
+        mCount[i] = 0;
+    }
+
+    mReservedMbPerSec = 0;
+    mReservedBitrate  = 0;
+
+    mPolicy = defaultPolicy;
+}
+
+bool ExynosC2ComponentRM::defaultPolicy(
+    const Reservation  &request,
+    uint64_t            reservedMbPerSec,
+    uint64_t            reservedBitrate,
+    uint64_t            maxMbPerSec,
+    uint64_t            maxBitrate) {
+    if (request.priority != REALTIME) {
+        /* it will be processed as possible as it can */
+        return true;
+    }
+
+    if ((reservedMbPerSec + request.load.getMbPerSec()) > maxMbPerSec) {
+        return false;
+    }
+
+    if ((request.load.bitrate > 0) &&
+        ((reservedBitrate + request.load.bitrate) > maxBitrate)) {
+        return false;
+    }
+
+    return true;
+}
+
+void ExynosC2ComponentRM::setPolicy(PolicyFnType policy) {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mPolicy = (policy != nullptr)? policy:defaultPolicy;
+}
+
+/* mMutex should be held */
+void ExynosC2ComponentRM::reserve(const Reservation &reservation, bool add) {
+    if (reservation.priority != REALTIME) {
+        return;
+    }
+
+    uint64_t mbPerSec = reservation.load.getMbPerSec();
+    uint64_t bitrate  = reservation.load.bitrate;
+
+    if (add) {
+        mReservedMbPerSec += mbPerSec;
+        mReservedBitrate  += bitrate;
+    } else {
+        mReservedMbPerSec -= MIN(mbPerSec, mReservedMbPerSec);
+        mReservedBitrate  -= MIN(bitrate, mReservedBitrate);
+    }
+}
+
+void ExynosC2ComponentRM::releaseResource(Reservation *reservation) {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    reserve(*reservation, false);
+
+    if (mCount[reservation->type] > 0) {
+        mCount[reservation->type]--;
+    }
+
+    ExynosLogV("[%s] resource(%s) is released. (cnt:%u, reserved:%llu MB/s, %llu bps)", __FUNCTION__,
+                    mResourceNames[reservation->type], mCount[reservation->type],
+                    (unsigned long long)mReservedMbPerSec, (unsigned long long)mReservedBitrate);
+}
+
+bool ExynosC2ComponentRM::updateResource(ComponentResource resource, Load load, Priority priority) {
+    ExynosLogFunctionTrace();
+
+    if (resource.get() == nullptr) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    reserve(*resource, false);
+
+    Reservation request = *resource;
+    request.load     = load;
+    request.priority = priority;
+
+    if (!mPolicy(request, mReservedMbPerSec, mReservedBitrate, MAX_MFC_MB_PER_SEC, MAX_MFC_BITRATE)) {
+        /* the previous reservation is kept */
+        reserve(*resource, true);
+
+        ExynosLogW("[%s] resource(%s) is over the budget : %ux%u@%u (reserved:%llu/%llu MB/s)", __FUNCTION__,
+                        mResourceNames[resource->type], load.width, load.height, load.frameRate,
+                        (unsigned long long)mReservedMbPerSec, (unsigned long long)MAX_MFC_MB_PER_SEC);
+        return false;
+    }
+
+    resource->load     = load;
+    resource->priority = priority;
+
+    reserve(*resource, true);
+
+    return true;
+}
+
+ExynosC2ComponentRM::ComponentResource ExynosC2ComponentRM::getResource(ResourceType type, Load load, Priority priority) {
+    ExynosLogFunctionTrace();
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    uint32_t max = 0;
+
+    switch (type) {
+    case DECODER:
+        max = MAX_DEC_RESOURCE;
+        break;
+    case ENCODER:
+        max = MAX_ENC_RESOURCE;
+        break;
+    case SECURE:
+        max = MAX_SECURE_RESOURCE;
+        break;
+    default:
+        break;
+    }
+
+    if ((max == 0) ||
+        (mCount[type] >= max)) {
+        ExynosLogW("[%s] resource(%s) is not available. (cnt:%u, max:%u)", __FUNCTION__,
+                        mResourceNames[type], mCount[type], max);
+        return nullptr;
+    }
+
+    Reservation request;
+    request.type     = type;
+    request.priority = priority;
+    request.load     = load;
+
+    if (!mPolicy(request, mReservedMbPerSec, mReservedBitrate, MAX_MFC_MB_PER_SEC, MAX_MFC_BITRATE)) {
+        ExynosLogW("[%s] resource(%s) is not admitted : %ux%u@%u, %u bps (reserved:%llu/%llu MB/s)", __FUNCTION__,
+                        mResourceNames[type], load.width, load.height, load.frameRate, load.bitrate,
+                        (unsigned long long)mReservedMbPerSec, (unsigned long long)MAX_MFC_MB_PER_SEC);
+        return nullptr;
+    }
+
+    /* reservation is returned to the budget at the last release of it */
+    auto delfunc = [wkRM = weak_from_this()](Reservation *p) {
+                        auto rm = wkRM.lock();
+                        if (rm.get() != nullptr) {
+                            rm->releaseResource(p);
+                        }
+
+                        delete p;
+                   };
+
+    ComponentResource resource(new Reservation(request), std::move(delfunc));
+
+    mCount[type]++;
+    reserve(request, true);
+
+    ExynosLogV("[%s] resource(%s) is added. (cnt:%u, max:%u, reserved:%llu MB/s, %llu bps)", __FUNCTION__,
+                    mResourceNames[type], mCount[type], max,
+                    (unsigned long long)mReservedMbPerSec, (unsigned long long)mReservedBitrate);
+
+    return resource;
+}
@@ -20,13 +20,31 @@
 #include <mutex>
 #include <list>
 #include <memory>
+#include <functional>
 
 #include <media/stagefright/xmlparser/MediaCodecsXmlParser.h>
 
 #define LOG_ON
 #include "ExynosLog.h"
 
-class ExynosC2ComponentRM : public ExynosLog {
+#ifndef MAX_SECURE_RESOURCE
+#define MAX_SECURE_RESOURCE 3
+#endif
+#define MAX_DEC_RESOURCE 16
+#define MAX_ENC_RESOURCE 16
+
+/* capacity of MFC shared by all instances */
+#ifndef MAX_MFC_MB_PER_SEC
+#define MAX_MFC_MB_PER_SEC 3888000  /* 3840x2160 @ 120fps */
+#endif
+#ifndef MAX_MFC_BITRATE
+#define MAX_MFC_BITRATE 400000000   /* bps */
+#endif
+#define DEFAULT_RM_FRAME_RATE 30    /* if frame rate is unknown */
+#define MAX_RM_FRAME_RATE 480       /* above it, it is considered as "as fast as possible"(ex, 32767) */
+
+class ExynosC2ComponentRM : public ExynosLog,
+                            public std::enable_shared_from_this<ExynosC2ComponentRM> {
 public:
     enum ResourceType : uint32_t {
         DECODER = 0,
@@ -35,19 +53,65 @@ public:
         RESOURCE_MAX
     };
 
+    enum Priority : uint32_t {
+        REALTIME = 0,   /* load is reserved in the budget */
+        NON_REALTIME,   /* best effort, load is not reserved */
+    };
+
+    class Load {
+    public:
+        Load()
+            : width(0),
+              height(0),
+              frameRate(0),
+              bitrate(0) {}
+
+        uint32_t width;
+        uint32_t height;
+        uint32_t frameRate;  /* 0 : unknown */
+        uint32_t bitrate;    /* bps, 0 : unknown */
+
+        uint64_t getMbPerSec() const;
+        void setFrameRate(int32_t streamRate, int32_t operateRate);
+    };
+
+    /* a reservation per instance. it is returned to the budget when the last reference is released */
+    class Reservation {
+    public:
+        ResourceType type;
+        Priority     priority;
+        Load         load;
+    };
+
+    using ComponentResource = std::shared_ptr<Reservation>;
 
-    using ComponentResource = std::shared_ptr<uint32_t>;
+    /* decides whether a reservation could be admitted with the budget which is already reserved */
+    using PolicyFnType = std::function<bool(const Reservation &request,
+                                            uint64_t reservedMbPerSec, uint64_t reservedBitrate,
+                                            uint64_t maxMbPerSec, uint64_t maxBitrate)>;
 
     ~ExynosC2ComponentRM() = default;
 
     static std::shared_ptr<ExynosC2ComponentRM> getInstance();
-    ComponentResource getResource(ResourceType type);
+    ComponentResource getResource(ResourceType type, Load load = Load(), Priority priority = REALTIME);
+    bool updateResource(ComponentResource resource, Load load, Priority priority);
+    void setPolicy(PolicyFnType policy);
 
 private:
     ExynosC2ComponentRM();
 
+    void releaseResource(Reservation *reservation);
+    void reserve(const Reservation &reservation, bool add);
+    static bool defaultPolicy(const Reservation &request,
+                              uint64_t reservedMbPerSec, uint64_t reservedBitrate,
+                              uint64_t maxMbPerSec, uint64_t maxBitrate);
+
     std::mutex mMutex;
-    ComponentResource mResources[RESOURCE_MAX];
+    uint32_t   mCount[RESOURCE_MAX];
+    uint64_t   mReservedMbPerSec;
+    uint64_t   mReservedBitrate;
+
+    PolicyFnType mPolicy;
 
     const char *mResourceNames[RESOURCE_MAX] = {
         "Decoder",
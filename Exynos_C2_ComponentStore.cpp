@@ -41,77 +41,9 @@
 #include "ExynosLog.h"
 #define LOG_TAG "ExynosC2ComponentStore"
 
-#ifndef MAX_SECURE_RESOURCE
-#define MAX_SECURE_RESOURCE 3
-#endif
-#define MAX_DEC_RESOURCE 16
-#define MAX_ENC_RESOURCE 16
-
 static std::mutex gMutex;
-static std::shared_ptr<ExynosC2ComponentRM> gComponentRM;
 static std::shared_ptr<ExynosC2ComponentInfo> gComponentInfo;
 
-std::shared_ptr<ExynosC2ComponentRM> ExynosC2ComponentRM::getInstance() {
-    std::lock_guard<std::mutex> lock(gMutex);
-
-    if (gComponentRM.get() == nullptr) {
-        auto delfunc = [](ExynosC2ComponentRM *p) {
-                            if (p != nullptr) {
-                                delete p;
-                            }
-                       };
-        gComponentRM = std::shared_ptr<ExynosC2ComponentRM>(new ExynosC2ComponentRM(),
-                                                            std::move(delfunc));
-    }
-
-    return gComponentRM;
-}
-
-ExynosC2ComponentRM::ExynosC2ComponentRM() : ExynosLog() {
-    mObjName = "ExynosC2ComponentRM";
-    mbLogOff = false;
-
-    for (int i = 0; i < RESOURCE_MAX; i++) {
-        mResources[i] = std::make_shared<uint32_t>(0);
-    }
-}
-
-ExynosC2ComponentRM::ComponentResource ExynosC2ComponentRM::getResource(ResourceType type) {
-    ExynosLogFunctionTrace();
-
-    std::lock_guard<std::mutex> lock(mMutex);
-
-    ComponentResource resource = nullptr;
-
-    uint32_t max = 0;
-
-    switch (type) {
-    case DECODER:
-        max = MAX_DEC_RESOURCE;
-        break;
-    case ENCODER:
-        max = MAX_ENC_RESOURCE;
-        break;
-    case SECURE:
-        max = MAX_SECURE_RESOURCE;
-        break;
-    default:
-        break;
-    }
-
-    if ((max == 0) ||
-        (mResources[type].use_count() > max)) {
-        return nullptr;
-    }
-
-    resource = mResources[type];
-
-    ExynosLogV("[%s] resource(%s) is added. (cnt:%d, max:%d)", __FUNCTION__,
-                    mResourceNames[type], (mResources[type].use_count() - 1), max);
-
-    return resource;
-}
-
 const std::shared_ptr<ExynosC2ComponentInfo> ExynosC2ComponentInfo::getInstance() {
     std::lock_guard<std::mutex> lock(gMutex);
 
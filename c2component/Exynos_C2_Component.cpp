@@ -16,6 +16,7 @@
  */
 #include "Exynos_C2_Component.h"
 #include "ExynosBufferAllocator.h"
+#include "ExynosMapCache.h"
 #include "ExynosETC.h"
 
 #define LOG_ON
@@ -41,7 +42,7 @@ ExynosC2Component::CommonParamIntf::CommonParamIntf(
     {
         ExynosMutex<std::shared_ptr<ExynosFilterParams>>::LockObj filterParams(mFilterParams);
 
-        (*filterParams) = std::make_shared<ExynosFilterParams>();
+        (*filterParams) = MakePooledShared<ExynosFilterParams>();
     }
 
     addParameter(
@@ -322,6 +323,9 @@ c2_status_t ExynosC2Component::flush_sm(
 
     mPendingFlushCount++;
 
+    /* works already done are delivered before flushed works */
+    flushWorkDoneBatch();
+
     ExynosMutex<ExynosQueue<std::shared_ptr<WorkQueueElement>>>::LockObj workQ(mWorkQueue);
 
     flushQueue(workQ, flushedWork);
@@ -442,6 +446,8 @@ c2_status_t ExynosC2Component::start() {
             return C2_CORRUPTED;
         }
 
+        mWorkDoneBatchTime = ExynosUtils::GetWorkDoneBatchTime();
+
         auto err = shThreadPool->post(std::string("ExynosC2Component::doStart"),
                                       weak_pointer_bind(false, &ExynosC2Component::doStart, weak_from_this()));
 
@@ -494,6 +500,8 @@ c2_status_t ExynosC2Component::stop() {
             ExynosLogE("[%s] doStop() is timed out", __FUNCTION__);
         }
 
+        flushWorkDoneBatch();
+
         comp->mInit = false;
     }
 
@@ -768,12 +776,12 @@ bool ExynosC2Component::queueFilterWork(
     ExynosLogD("[%s] input flag : 0x%x", "doQueue", workElement->mC2Work->input.flags);
 
     if (buffer->mParams.get() == nullptr) {
-        buffer->mParams = std::static_pointer_cast<ExynosParams>(std::make_shared<ExynosFilterParams>());
+        buffer->mParams = std::static_pointer_cast<ExynosParams>(MakePooledShared<ExynosFilterParams>());
     }
 
     /* configurations */
     {
-        auto params = std::make_shared<ExynosFilterParams>();
+        auto params = MakePooledShared<ExynosFilterParams>();
 
         /* configurations piled by config_vb() */
         {
@@ -881,6 +889,7 @@ void ExynosC2Component::sendC2Work(std::unique_ptr<C2Work> c2work) {
 
     if (listener.get() != nullptr) {
         std::list<std::unique_ptr<C2Work>> items;
+        bool urgent = true;
 
         if (!c2work->worklets.empty()) {
             ExynosLogD("[sendC2Work] c2work: %p", c2work.get());
@@ -889,14 +898,109 @@ void ExynosC2Component::sendC2Work(std::unique_ptr<C2Work> c2work) {
             ExynosLogD("[sendC2Work] output customOrdinal: %lld", c2work->worklets.front()->output.ordinal.customOrdinal);
             ExynosLogV("[sendC2Work] input buffers: %d, output buffers: %d",
                                 c2work->input.buffers.size(), c2work->worklets.front()->output.buffers.size());
+
+            /* EOS, error and config update should not be delayed */
+            urgent = ((c2work->result != C2_OK) ||
+                      (c2work->worklets.front()->output.flags & C2FrameData::FLAG_END_OF_STREAM) ||
+                      (!c2work->worklets.front()->output.configUpdate.empty()));
         }
 
-        items.push_back(std::move(c2work));
+        if (mWorkDoneBatchTime == 0) {
+            items.push_back(std::move(c2work));
+
+            deliverWorkDone(std::move(items));
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mWorkDoneBatchMutex);
+
+            mWorkDoneBatch.push_back(std::move(c2work));
+
+            if ((!urgent) &&
+                (mWorkDoneBatch.size() < WORK_DONE_BATCH_MAX_CNT)) {
+                if (mWorkDoneBatch.size() == 1) {
+                    /* the first one decides when the batch is delivered */
+                    mWorkDoneBatchDeadline = std::chrono::steady_clock::now() + std::chrono::microseconds(mWorkDoneBatchTime);
+
+                    if (!mWorkDoneBatchThread.joinable()) {
+                        mWorkDoneBatchExit = false;
+                        mWorkDoneBatchThread = std::thread(&ExynosC2Component::runWorkDoneBatch, this);
+                    }
+
+                    mWorkDoneBatchSignal.notify_one();
+                }
+
+                return;
+            }
+        }
 
-        listener->onWorkDone_nb(shared_from_this(), std::move(items));
+        flushWorkDoneBatch();
     }
 }
 
+void ExynosC2Component::deliverWorkDone(std::list<std::unique_ptr<C2Work>> items) {
+    std::shared_ptr<C2Component::Listener> listener = mCallbackListener;
+
+    if ((listener.get() == nullptr) ||
+        (items.empty())) {
+        return;
+    }
+
+    if (items.size() > 1) {
+        ExynosLogV("[%s] deliver %zu c2works at once", __FUNCTION__, items.size());
+    }
+
+    /* it could be called on mWorkDoneBatchThread, so never holds a strong reference of itself */
+    listener->onWorkDone_nb(weak_from_this(), std::move(items));
+}
+
+void ExynosC2Component::flushWorkDoneBatch() {
+    std::lock_guard<std::mutex> deliverLock(mWorkDoneDeliverMutex);
+    std::list<std::unique_ptr<C2Work>> items;
+
+    {
+        std::lock_guard<std::mutex> lock(mWorkDoneBatchMutex);
+
+        items.splice(items.end(), mWorkDoneBatch);
+    }
+
+    deliverWorkDone(std::move(items));
+}
+
+void ExynosC2Component::runWorkDoneBatch() {
+    std::unique_lock<std::mutex> lock(mWorkDoneBatchMutex);
+
+    while (!mWorkDoneBatchExit) {
+        if (mWorkDoneBatch.empty()) {
+            mWorkDoneBatchSignal.wait(lock);
+            continue;
+        }
+
+        if (mWorkDoneBatchSignal.wait_until(lock, mWorkDoneBatchDeadline) == std::cv_status::timeout) {
+            lock.unlock();
+            flushWorkDoneBatch();
+            lock.lock();
+        }
+    }
+}
+
+void ExynosC2Component::stopWorkDoneBatch() {
+    {
+        std::lock_guard<std::mutex> lock(mWorkDoneBatchMutex);
+
+        mWorkDoneBatchExit = true;
+        mWorkDoneBatchSignal.notify_all();
+    }
+
+    if (mWorkDoneBatchThread.joinable()) {
+        mWorkDoneBatchThread.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mWorkDoneBatchMutex);
+    mWorkDoneBatch.clear();
+}
+
 int32_t ExynosC2Component::getC2WorkCount() {
     ExynosLogFunctionTrace();
 
@@ -932,6 +1036,9 @@ c2_status_t ExynosC2Component::onStop() {
     mReplicaInputBlockPool.reset();
     mReplicaBufferAllocator.reset();
 
+    /* idle mappings of buffers which are not used anymore */
+    ExynosMapCache::getInstance().drop(getMapOwner());
+
     return ret;
 }
 
@@ -988,9 +1095,41 @@ c2_status_t ExynosC2Component::onApplyConfig(
         }
     }
 
+    /* resolution or frame rate could be changed */
+    updateResourceLoad();
+
     return C2_OK;
 }
 
+ExynosC2ComponentRM::Priority ExynosC2Component::getResourcePriority() {
+    if (mParamIntf.get() == nullptr) {
+        return ExynosC2ComponentRM::Priority::REALTIME;
+    }
+
+    CommonParamIntf::Lock lock = mParamIntf->lock();
+
+    return (mParamIntf->getRealTimePriority() == 0)? ExynosC2ComponentRM::Priority::REALTIME:
+                                                     ExynosC2ComponentRM::Priority::NON_REALTIME;
+}
+
+void ExynosC2Component::updateResourceLoad() {
+    ExynosLogFunctionTrace();
+
+    if (mCompRes.get() == nullptr) {
+        /* not started yet. it will be reserved at start */
+        return;
+    }
+
+    auto rm = ExynosC2ComponentRM::getInstance();
+
+    auto load = getResourceLoad();
+    auto priority = getResourcePriority();
+
+    if (rm->updateResource(mCompRes, load, priority) == false) {
+        ExynosLogW("[%s] load(%ux%u@%u) is over the capacity, previous load is kept", __FUNCTION__, load.width, load.height, load.frameRate);
+    }
+}
+
 c2_status_t ExynosC2Component::onFlush() {
     ExynosLogFunctionTrace();
 
@@ -1010,6 +1149,9 @@ c2_status_t ExynosC2Component::onFlush() {
 
     shFilter->flush();
 
+    /* buffers returned by flush may not come back */
+    ExynosMapCache::getInstance().drop(getMapOwner());
+
     return ret;
 }
 
@@ -1039,7 +1181,7 @@ c2_status_t ExynosC2Component::onReset() {
     mReplicaInputBlockPool.reset();
     mReplicaBufferAllocator.reset();
 
-    ExynosLogI("[%s] resource is released (%u)", __FUNCTION__, (mCompRes.use_count() - 1));
+    ExynosLogI("[%s] resource is released", __FUNCTION__);
 
     mCompRes = nullptr;
 
@@ -1104,6 +1246,9 @@ bool ExynosC2Component::doQueue() {
         if (!onQueue(element)) {
             std::shared_ptr<C2Component::Listener> listener = mCallbackListener;
 
+            /* works done before have to be delivered first */
+            flushWorkDoneBatch();
+
             if (listener.get() != nullptr) {
                 std::list<std::unique_ptr<C2Work>> items;
 
@@ -26,6 +26,10 @@
 #include <algorithm>
 #include <map>
 #include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 
 #include <C2Component.h>
 #include <C2Config.h>
@@ -86,11 +90,16 @@ public:
 
         mUseCustomOrdinal = false;
         mCompRes = nullptr;
+
+        mWorkDoneBatchTime = 0;
+        mWorkDoneBatchExit = false;
     }
 
     virtual ~ExynosC2Component() {
         ExynosLogFunctionTrace();
 
+        stopWorkDoneBatch();
+
         mThreadPool->stop();
 
         mCallbackListener.reset();
@@ -191,6 +200,16 @@ protected:
     std::shared_ptr<WorkQueueElement> findWorkElement(std::shared_ptr<C2Buffer> c2buffer);
     c2_status_t makeFilterParam(std::vector<C2Param::Index> &indices);
 
+    /* load of the instance which is reserved on ExynosC2ComponentRM */
+    virtual ExynosC2ComponentRM::Load getResourceLoad() = 0;
+    ExynosC2ComponentRM::Priority getResourcePriority();
+    void updateResourceLoad();
+
+    /* identity of this instance on mappings in ExynosMapCache */
+    uint64_t getMapOwner() {
+        return (uint64_t)(uintptr_t)this;
+    }
+
     ExynosMutex<ComponentState>         mStateMutex;
     std::shared_ptr<CommonParamIntf>    mParamIntf;
 
@@ -229,6 +248,12 @@ private:
     bool doFilterWorkDone(std::unique_ptr<ExynosFilter::FilterWork> work);
 
     bool inputProcessTrigger(int workCount);
+
+    /* works done are delivered with a list within mWorkDoneBatchTime */
+    void deliverWorkDone(std::list<std::unique_ptr<C2Work>> items);
+    void flushWorkDoneBatch();
+    void runWorkDoneBatch();
+    void stopWorkDoneBatch();
     bool flushQueue(ExynosMutex<ExynosQueue<std::shared_ptr<WorkQueueElement>>>::LockObj &srcQ,
                     std::list<std::unique_ptr<C2Work>> * const flushedWork);
 
@@ -240,6 +265,15 @@ private:
     std::atomic_int mC2WorkCount;
     std::atomic_int mPendingFlushCount;
 
+    uint32_t                                mWorkDoneBatchTime;  /* us */
+    std::mutex                              mWorkDoneBatchMutex;
+    std::mutex                              mWorkDoneDeliverMutex;  /* keeps the order of delivery */
+    std::condition_variable                 mWorkDoneBatchSignal;
+    std::list<std::unique_ptr<C2Work>>      mWorkDoneBatch;
+    std::chrono::steady_clock::time_point   mWorkDoneBatchDeadline;
+    std::thread                             mWorkDoneBatchThread;
+    bool                                    mWorkDoneBatchExit;
+
     /* disable default constructor */
     ExynosC2Component() = delete;
 };
@@ -435,7 +469,7 @@ public:
     }
 
     std::shared_ptr<ExynosFilterParams> getPiledFilterParams() {
-        std::shared_ptr<ExynosFilterParams> ret = std::make_shared<ExynosFilterParams>();
+        std::shared_ptr<ExynosFilterParams> ret = MakePooledShared<ExynosFilterParams>();
 
         ExynosMutex<std::shared_ptr<ExynosFilterParams>>::LockObj filterParams(mFilterParams);
 
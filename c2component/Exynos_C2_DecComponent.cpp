@@ -245,14 +245,17 @@ c2_status_t ExynosC2DecComponent::onStart() {
 
         auto vdecIntf = std::static_pointer_cast<VdecCommonParamIntf>(mParamIntf);
 
+        auto load = getResourceLoad();
+
         mCompRes = rm->getResource((vdecIntf->mIsSecure)? ExynosC2ComponentRM::ResourceType::SECURE:
-                                                          ExynosC2ComponentRM::ResourceType::DECODER);
+                                                          ExynosC2ComponentRM::ResourceType::DECODER,
+                                   load, getResourcePriority());
         if (mCompRes.get() == nullptr) {
             ExynosLogE("[%s] getResource() is failed", __FUNCTION__);
             return C2_NO_MEMORY;
         }
 
-        ExynosLogI("[%s] resource is obtained (%u)", __FUNCTION__, mCompRes.use_count());
+        ExynosLogI("[%s] resource is obtained (%ux%u@%u)", __FUNCTION__, load.width, load.height, load.frameRate);
     }
 
     ret = onSetup();
@@ -287,6 +290,8 @@ c2_status_t ExynosC2DecComponent::onStart() {
     if (mReplicaBufferAllocator.get() == nullptr) {
         ExynosLogE("[%s] makeAllocator() for replica is failed", __FUNCTION__);
     } else {
+        mReplicaBufferAllocator->setMapOwner(getMapOwner());
+
         if (mReplicaInputBlockPool.get() == nullptr) {
             ExynosLogE("[%s] replicaInputblockPool() is invalid", __FUNCTION__);
         }
@@ -345,7 +350,7 @@ c2_status_t ExynosC2DecComponent::onSetup() {
     /* send Filter list info for control filter */
     auto targetID = mParamIntf->findFilterID("control");
     if (targetID > 0) {
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamFilterListInfo>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamFilterListInfo>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamFilterListInfo>>(filterParam->getBaseParam());
 
         param->m.wkInfo = mFilterManager->getFilterListInfo();
@@ -420,7 +425,7 @@ c2_status_t ExynosC2DecComponent::onFlush() {
     /* send Filter list info for control filter */
     auto targetID = mParamIntf->findFilterID("control");
     if (targetID > 0) {
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamFilterListInfo>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamFilterListInfo>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamFilterListInfo>>(filterParam->getBaseParam());
 
         param->m.wkInfo = mFilterManager->getFilterListInfo();
@@ -605,6 +610,9 @@ void ExynosC2DecComponent::onUpdateC2Config(
     if (c2buffer.get() != nullptr) {
         if (updateC2Config_StreamSize(outConfig, buffer, (requestUpdate & REQUESTED_TYPE_PIC_SIZE)? true:false)) {
             updateC2Config_MaxStreamSize(outConfig, buffer);
+
+            /* resolution is changed by bitstream */
+            updateResourceLoad();
         }
 
         updateC2Config_CropInfo(outConfig, buffer);
@@ -634,6 +642,7 @@ void ExynosC2DecComponent::setBlockPool() {
 
     VdecCommonParamIntf::Lock lock = mParamIntf->lock();
 
+    mFilterManager->setMapOwner(getMapOwner());
     mFilterManager->setBlockPool((mParamIntf->mOutputPoolIds->flexCount() > 0)?
                                       mParamIntf->mOutputPoolIds->m.values[0]:C2BlockPool::BASIC_GRAPHIC,
                                  mStreamUsage);
@@ -678,6 +687,8 @@ std::optional<std::shared_ptr<ExynosBuffer>> ExynosC2DecComponent::getExynosBuff
             return std::nullopt;
         }
 
+        (*optBuffer)->setMapOwner(getMapOwner());
+
         ExynosLogD("[%s] buffer: %p", __FUNCTION__, (*optBuffer).get());
 
         return optBuffer;
@@ -686,6 +697,30 @@ std::optional<std::shared_ptr<ExynosBuffer>> ExynosC2DecComponent::getExynosBuff
     return std::nullopt;
 }
 
+ExynosC2ComponentRM::Load ExynosC2DecComponent::getResourceLoad() {
+    ExynosC2ComponentRM::Load load;
+
+    if (mParamIntf.get() == nullptr) {
+        return load;
+    }
+
+    auto vdecIntf = std::static_pointer_cast<VdecCommonParamIntf>(mParamIntf);
+
+    VdecCommonParamIntf::Lock lock = vdecIntf->lock();
+
+    auto resolution  = vdecIntf->getStreamSize();
+    auto operateRate = vdecIntf->getOperateRate();
+
+    if (resolution.get() != nullptr) {
+        load.width  = resolution->width;
+        load.height = resolution->height;
+    }
+
+    load.setFrameRate(0, operateRate);  /* stream rate is unknown */
+
+    return load;
+}
+
 bool ExynosC2DecComponent::updateC2Config_StreamSize(
     std::vector<std::unique_ptr<C2Param>>  &outConfig,
     std::shared_ptr<ExynosBuffer>           buffer,
@@ -846,7 +881,7 @@ void ExynosC2DecComponent::addFilterParam_OutputDelayUpdate(std::shared_ptr<Exyn
         });
 
     if (buffer->mParams.get() == nullptr) {
-        buffer->mParams = std::static_pointer_cast<ExynosParams>(std::make_shared<ExynosFilterParams>());
+        buffer->mParams = std::static_pointer_cast<ExynosParams>(MakePooledShared<ExynosFilterParams>());
     }
 
     auto filterParams = std::static_pointer_cast<ExynosFilterParams>(buffer->mParams);
@@ -854,7 +889,7 @@ void ExynosC2DecComponent::addFilterParam_OutputDelayUpdate(std::shared_ptr<Exyn
     auto intfImpl = std::static_pointer_cast<VdecCommonParamIntf>(mParamIntf);
     auto id = intfImpl->findFilterID("dec");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<FuncParamOutputDelayUpdate>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<FuncParamOutputDelayUpdate>>();
         auto param       = std::static_pointer_cast<ExynosParam<FuncParamOutputDelayUpdate>>(filterParam->getBaseParam());
 
         param->m.func = updatefunc;
@@ -142,6 +142,7 @@ protected:
     std::optional<std::shared_ptr<ExynosBuffer>> getExynosBuffer(C2FrameData &input) override;
     void sendC2Work(std::unique_ptr<C2Work> c2work) override;
     void PreFlush() override;
+    ExynosC2ComponentRM::Load getResourceLoad() override;
     int32_t getC2WorkCount() override {
         return ExynosC2Component::getC2WorkCount();
     }
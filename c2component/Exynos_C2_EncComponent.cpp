@@ -231,14 +231,18 @@ c2_status_t ExynosC2EncComponent::onStart() {
         /* try to get a resource from manager */
         auto rm = ExynosC2ComponentRM::getInstance();
 
+        auto load = getResourceLoad();
+
         mCompRes = rm->getResource((vencIntf->mIsSecure)? ExynosC2ComponentRM::ResourceType::SECURE:
-                                                          ExynosC2ComponentRM::ResourceType::ENCODER);
+                                                          ExynosC2ComponentRM::ResourceType::ENCODER,
+                                   load, getResourcePriority());
         if (mCompRes.get() == nullptr) {
             ExynosLogE("[%s] getResource() is failed", __FUNCTION__);
             return C2_NO_MEMORY;
         }
 
-        ExynosLogI("[%s] resource is obtained (%u)", __FUNCTION__, mCompRes.use_count());
+        ExynosLogI("[%s] resource is obtained (%ux%u@%u, %u bps)", __FUNCTION__,
+                        load.width, load.height, load.frameRate, load.bitrate);
     }
 
     ret = onSetup();
@@ -275,6 +279,8 @@ c2_status_t ExynosC2EncComponent::onStart() {
     if (mReplicaBufferAllocator.get() == nullptr) {
         ExynosLogE("[%s] makeAllocator() for replica is failed", __FUNCTION__);
     } else {
+        mReplicaBufferAllocator->setMapOwner(getMapOwner());
+
         if (mReplicaInputBlockPool.get() == nullptr) {
             ExynosLogE("[%s] replicaInputblockPool() is invalid", __FUNCTION__);
         }
@@ -541,11 +547,38 @@ void ExynosC2EncComponent::setBlockPool() {
 
     VencCommonParamIntf::Lock lock = mParamIntf->lock();
 
+    mFilterManager->setMapOwner(getMapOwner());
     mFilterManager->setBlockPool((mParamIntf->mOutputPoolIds->flexCount() > 0)?
                                       mParamIntf->mOutputPoolIds->m.values[0]:C2BlockPool::BASIC_LINEAR);
     return;
 }
 
+ExynosC2ComponentRM::Load ExynosC2EncComponent::getResourceLoad() {
+    ExynosC2ComponentRM::Load load;
+
+    if (mParamIntf.get() == nullptr) {
+        return load;
+    }
+
+    auto vencIntf = std::static_pointer_cast<VencCommonParamIntf>(mParamIntf);
+
+    VencCommonParamIntf::Lock lock = vencIntf->lock();
+
+    auto resolution  = vencIntf->getStreamSize();
+    auto frameRate   = (int32_t)vencIntf->getFrameRate();
+    auto operateRate = vencIntf->getOperateRate();
+
+    if (resolution.get() != nullptr) {
+        load.width  = resolution->width;
+        load.height = resolution->height;
+    }
+
+    load.setFrameRate(frameRate, operateRate);
+    load.bitrate   = vencIntf->getBitrate();
+
+    return load;
+}
+
 std::optional<std::shared_ptr<ExynosBuffer>> ExynosC2EncComponent::getExynosBuffer(C2FrameData &input) {
     ExynosLogFunctionTrace();
 
@@ -619,6 +652,8 @@ std::optional<std::shared_ptr<ExynosBuffer>> ExynosC2EncComponent::getExynosBuff
             return std::nullopt;
         }
 
+        (*optBuffer)->setMapOwner(getMapOwner());
+
         mWidth  = (*optBuffer)->mImageInfo.stCropInfo.nWidth;
         mHeight = (*optBuffer)->mImageInfo.stCropInfo.nHeight;
 
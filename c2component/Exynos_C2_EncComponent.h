@@ -111,6 +111,7 @@ protected:
                                   std::vector<std::unique_ptr<C2Param>> &outConfig);
     void setBlockPool() override;
     std::optional<std::shared_ptr<ExynosBuffer>> getExynosBuffer(C2FrameData &input) override;
+    ExynosC2ComponentRM::Load getResourceLoad() override;
 
     /* function for ExynosC2EncComponent's child class */
     void updateC2Config_Subscribes(std::shared_ptr<C2Buffer> c2buffer,
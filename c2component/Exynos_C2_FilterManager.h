@@ -350,6 +350,10 @@ public:
                                     poolID,
                                     C2MemoryUsage(usage, element->mUsage.expected), &blockPool);
 
+            if (allocator.get() != nullptr) {
+                allocator->setMapOwner(mMapOwner);
+            }
+
             element->mBufferAllocator = allocator;
             element->mOutputBlockPool = blockPool;
 
@@ -389,6 +393,13 @@ public:
         return true;
     }
 
+    /* owner of mappings of buffers from allocators made by setBlockPool(), see ExynosMapCache::drop() */
+    void setMapOwner(uint64_t owner) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mMapOwner = owner;
+    }
+
     void clearBlockPool() {
         ExynosLogFunctionTrace();
         std::lock_guard<std::mutex> lock(mMutex);
@@ -456,6 +467,8 @@ private:
 
     std::shared_ptr<std::map<std::string, int>>     mFilterListInfo;
 
+    uint64_t                                        mMapOwner = 0;
+
     /* disable default constructor */
     ExynosC2FilterManager() = delete;
 };
@@ -39,7 +39,7 @@ FilterParamSetterRet CommonCnv::cnvOperateRate(std::shared_ptr<C2InterfaceHelper
         }
 
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamOperatingRate>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamOperatingRate>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamOperatingRate>>(filterParam->getBaseParam());
 
             param->m.value = framerate;
@@ -78,7 +78,7 @@ FilterParamSetterRet CommonCnv::cnvRealTimePriority(std::shared_ptr<C2InterfaceH
     }
 
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamRealTimePriority>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamRealTimePriority>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamRealTimePriority>>(filterParam->getBaseParam());
 
         param->m.value = (uint32_t)(realTimePriority) * (-1);
@@ -110,7 +110,7 @@ FilterParamSetterRet DecCommonCnv::cnvPixelFormat(std::shared_ptr<C2InterfaceHel
 
     auto id = intfImpl->findFilterID("dec");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamPixelFormat>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamPixelFormat>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamPixelFormat>>(filterParam->getBaseParam());
 
         param->m.format = intfImpl->getPixelFormat();
@@ -137,7 +137,7 @@ FilterParamSetterRet DecCommonCnv::cnvActualFormat(std::shared_ptr<C2InterfaceHe
 
     auto id = intfImpl->findFilterID("csc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamActualFormat>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamActualFormat>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamActualFormat>>(filterParam->getBaseParam());
 
         auto format = intfImpl->getActualFormat();
@@ -166,7 +166,7 @@ FilterParamSetterRet DecCommonCnv::cnvColorAspects(std::shared_ptr<C2InterfaceHe
 
     auto id = intfImpl->findFilterID("dec");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamColorAspects>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamColorAspects>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamColorAspects>>(filterParam->getBaseParam());
 
         auto FWCA = intfImpl->getColorAspects_l();
@@ -225,7 +225,7 @@ FilterParamSetterRet DecCommonCnv::cnvHdrStaticInfo(std::shared_ptr<C2InterfaceH
 
     auto id = intfImpl->findFilterID("dec");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamHdrStaticInfo>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamHdrStaticInfo>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamHdrStaticInfo>>(filterParam->getBaseParam());
 
         auto codedStaticInfo = intfImpl->getHdrStaticInfo(true);
@@ -273,7 +273,7 @@ FilterParamSetterRet DecCommonCnv::cnvInputCrop(std::shared_ptr<C2InterfaceHelpe
 
     auto id = intfImpl->findFilterID("csc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamInputCrop>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamInputCrop>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamInputCrop>>(filterParam->getBaseParam());
 
         auto crop = intfImpl->getInputCrop();
@@ -303,7 +303,7 @@ FilterParamSetterRet DecCommonCnv::cnvOutputCrop(std::shared_ptr<C2InterfaceHelp
 
     auto id = intfImpl->findFilterID("csc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamOutputCrop>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamOutputCrop>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamOutputCrop>>(filterParam->getBaseParam());
 
         auto crop = intfImpl->getOutputCrop();
@@ -333,7 +333,7 @@ FilterParamSetterRet DecCommonCnv::cnvScaleSize(std::shared_ptr<C2InterfaceHelpe
 
     auto id = intfImpl->findFilterID("csc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamOutputFrameInfo>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamOutputFrameInfo>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamOutputFrameInfo>>(filterParam->getBaseParam());
 
         auto size = intfImpl->getPictureSize();
@@ -364,7 +364,7 @@ FilterParamSetterRet DecCommonCnv::cnvDecodeOrder(std::shared_ptr<C2InterfaceHel
 
     auto id = intfImpl->findFilterID("dec");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamDecodeOrder>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamDecodeOrder>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamDecodeOrder>>(filterParam->getBaseParam());
 
         auto order = intfImpl->getDecodeOrder();
@@ -394,7 +394,7 @@ FilterParamSetterRet DecCommonCnv::cnvBufferCopy(std::shared_ptr<C2InterfaceHelp
 
         auto id = intfImpl->findFilterID("csc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamBufferCopy>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamBufferCopy>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamBufferCopy>>(filterParam->getBaseParam());
 
             auto copy = intfImpl->getBufferCopy();
@@ -424,7 +424,7 @@ FilterParamSetterRet DecCommonCnv::cnvBlackBar(std::shared_ptr<C2InterfaceHelper
 
     auto id = intfImpl->findFilterID("dec");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamBlackBar>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamBlackBar>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamBlackBar>>(filterParam->getBaseParam());
 
         auto blackbar = intfImpl->getBlackBar();
@@ -454,7 +454,7 @@ FilterParamSetterRet DecCommonCnv::cnvThumbnailMode(std::shared_ptr<C2InterfaceH
 
     auto id = intfImpl->findFilterID("dec");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamThumbnailMode>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamThumbnailMode>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamThumbnailMode>>(filterParam->getBaseParam());
 
         auto blackbar = intfImpl->getThumbnailMode();
@@ -484,7 +484,7 @@ FilterParamSetterRet DecCommonCnv::cnvCompressedColor(std::shared_ptr<C2Interfac
 
     auto id = intfImpl->findFilterID("dec");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamCompressedColor>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamCompressedColor>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamCompressedColor>>(filterParam->getBaseParam());
 
         auto pixelFormat = intfImpl->getPixelFormat();
@@ -535,7 +535,7 @@ FilterParamSetterRet DecCommonCnv::cnvDisplayDelay(std::shared_ptr<C2InterfaceHe
 
     auto id = intfImpl->findFilterID("dec");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamDisplayDelay>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamDisplayDelay>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamDisplayDelay>>(filterParam->getBaseParam());
 
         if (delay >= 0) {
@@ -568,7 +568,7 @@ FilterParamSetterRet DecCommonCnv::cnvImageConvertControlFrameCommon(std::shared
     if (count > 0) {
         auto id = intfImpl->findFilterID("hdr2sdr");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamHDR2SDRFrameCount>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamHDR2SDRFrameCount>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamHDR2SDRFrameCount>>(filterParam->getBaseParam());
 
             param->m.value = count;
@@ -607,7 +607,7 @@ FilterParamSetterRet EncCommonCnv::cnvSubscribedParam(std::shared_ptr<C2Interfac
         {
             auto id = intfImpl->findFilterID("enc");
             if (id != 0) {  /* target filter is valid */
-                auto filterParam = std::make_shared<ExynosFilterParam<ParamAverageQp>>();
+                auto filterParam = MakePooledShared<ExynosFilterParam<ParamAverageQp>>();
                 auto param       = std::static_pointer_cast<ExynosParam<ParamAverageQp>>(filterParam->getBaseParam());
 
                 param->m.enable = 1;
@@ -642,7 +642,7 @@ FilterParamSetterRet EncCommonCnv::cnvFrameRate(std::shared_ptr<C2InterfaceHelpe
 
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamFramerate>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamFramerate>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamFramerate>>(filterParam->getBaseParam());
 
             param->m.framerate = intfImpl->getFrameRate();
@@ -675,7 +675,7 @@ FilterParamSetterRet EncCommonCnv::cnvActualFormat(std::shared_ptr<C2InterfaceHe
 
     auto id = intfImpl->findFilterID("csc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamActualFormat>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamActualFormat>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamActualFormat>>(filterParam->getBaseParam());
 
         auto format = intfImpl->getActualFormat();
@@ -773,7 +773,7 @@ FilterParamSetterRet EncCommonCnv::cnvStartIDRFrame(std::shared_ptr<C2InterfaceH
         if (id != 0) {  /* target filter is valid */
             /* IDR period */
             {
-                auto filterParam = std::make_shared<ExynosFilterParam<ParamIDRPeriod>>();
+                auto filterParam = MakePooledShared<ExynosFilterParam<ParamIDRPeriod>>();
                 auto param       = std::static_pointer_cast<ExynosParam<ParamIDRPeriod>>(filterParam->getBaseParam());
 
                 param->m.period = period;
@@ -788,7 +788,7 @@ FilterParamSetterRet EncCommonCnv::cnvStartIDRFrame(std::shared_ptr<C2InterfaceH
 
             /* framerate */
             {
-                auto filterParam = std::make_shared<ExynosFilterParam<ParamFramerate>>();
+                auto filterParam = MakePooledShared<ExynosFilterParam<ParamFramerate>>();
                 auto param       = std::static_pointer_cast<ExynosParam<ParamFramerate>>(filterParam->getBaseParam());
 
                 param->m.framerate = framerate;
@@ -818,7 +818,7 @@ FilterParamSetterRet EncCommonCnv::cnvRequestSyncFrame(std::shared_ptr<C2Interfa
     if (intfImpl->getRequestSyncFrame()) {
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamIntraVOPRefresh>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamIntraVOPRefresh>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamIntraVOPRefresh>>(filterParam->getBaseParam());
 
             param->m.request = On;
@@ -847,7 +847,7 @@ FilterParamSetterRet EncCommonCnv::cnvSyncFramePeriod(std::shared_ptr<C2Interfac
 
     auto id = intfImpl->findFilterID("enc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamIDRPeriod>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamIDRPeriod>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamIDRPeriod>>(filterParam->getBaseParam());
 
         auto period     = intfImpl->getIDRPeriod();
@@ -878,7 +878,7 @@ FilterParamSetterRet EncCommonCnv::cnvIntraRefresh(std::shared_ptr<C2InterfaceHe
 
     auto id = intfImpl->findFilterID("enc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamIntraRefresh>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamIntraRefresh>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamIntraRefresh>>(filterParam->getBaseParam());
 
         auto intraRefresh = intfImpl->getIntraRefresh();
@@ -912,7 +912,7 @@ FilterParamSetterRet EncCommonCnv::cnvInputCrop(std::shared_ptr<C2InterfaceHelpe
 
     auto id = intfImpl->findFilterID("csc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamInputCrop>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamInputCrop>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamInputCrop>>(filterParam->getBaseParam());
 
         auto crop = intfImpl->getInputCrop();
@@ -942,7 +942,7 @@ FilterParamSetterRet EncCommonCnv::cnvScaleSize(std::shared_ptr<C2InterfaceHelpe
 
     auto id = intfImpl->findFilterID("csc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamOutputFrameInfo>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamOutputFrameInfo>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamOutputFrameInfo>>(filterParam->getBaseParam());
 
         auto size = intfImpl->getPictureSize();
@@ -1041,7 +1041,7 @@ FilterParamSetterRet EncCommonCnv::cnvColorAspects(std::shared_ptr<C2InterfaceHe
 
     auto id = intfImpl->findFilterID("enc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamColorAspects>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamColorAspects>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamColorAspects>>(filterParam->getBaseParam());
 
         auto CA = intfImpl->getColorAspects_l();
@@ -1093,7 +1093,7 @@ FilterParamSetterRet EncCommonCnv::cnvCSCDataSpace(std::shared_ptr<C2InterfaceHe
 
     auto id = intfImpl->findFilterID("csc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamDataSpace>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamDataSpace>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamDataSpace>>(filterParam->getBaseParam());
 
         auto dataspace = intfImpl->getDataSpace();
@@ -1175,7 +1175,7 @@ FilterParamSetterRet EncCommonCnv::cnvQpRange(std::shared_ptr<C2InterfaceHelper>
 
     auto id = intfImpl->findFilterID("enc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamQpRange>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamQpRange>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamQpRange>>(filterParam->getBaseParam());
 
         auto range = intfImpl->getQpRange();
@@ -1210,7 +1210,7 @@ FilterParamSetterRet EncCommonCnv::cnvDropControl(std::shared_ptr<C2InterfaceHel
 
     auto id = intfImpl->findFilterID("enc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamDropControl>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamDropControl>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamDropControl>>(filterParam->getBaseParam());
 
         auto enable = intfImpl->getDropControl();
@@ -1240,7 +1240,7 @@ FilterParamSetterRet EncCommonCnv::cnvDynamicFramerate(std::shared_ptr<C2Interfa
 
     auto id = intfImpl->findFilterID("enc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamDynamicFramerate>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamDynamicFramerate>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamDynamicFramerate>>(filterParam->getBaseParam());
 
         auto enable = intfImpl->getDynamicFramerate();
@@ -1272,7 +1272,7 @@ FilterParamSetterRet EncCommonCnv::cnvBitrate(std::shared_ptr<C2InterfaceHelper>
 
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamBitrate>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamBitrate>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamBitrate>>(filterParam->getBaseParam());
 
             param->m.bitrate = intfImpl->getBitrate();
@@ -1289,7 +1289,7 @@ FilterParamSetterRet EncCommonCnv::cnvBitrate(std::shared_ptr<C2InterfaceHelper>
 }
 
 static std::shared_ptr<ExynosFilterParam<ParamBitrateMode>> makeBitrateModeParam(uint32_t mode, uint32_t id) {
-    auto filterParam = std::make_shared<ExynosFilterParam<ParamBitrateMode>>();
+    auto filterParam = MakePooledShared<ExynosFilterParam<ParamBitrateMode>>();
     auto param       = std::static_pointer_cast<ExynosParam<ParamBitrateMode>>(filterParam->getBaseParam());
 
     switch (mode) {
@@ -1388,7 +1388,7 @@ FilterParamSetterRet EncCommonCnv::cnvLayeringCommon(std::shared_ptr<C2Interface
     if (layering->m.layerCount > 0) {
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamLayering>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamLayering>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamLayering>>(filterParam->getBaseParam());
 
             param->m.layerCount     = layering->m.layerCount;
@@ -1450,7 +1450,7 @@ FilterParamSetterRet EncCommonCnv::cnvAverageQp(std::shared_ptr<C2InterfaceHelpe
     if (enable) {
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamAverageQp>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamAverageQp>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamAverageQp>>(filterParam->getBaseParam());
 
             param->m.enable = 1;
@@ -1482,7 +1482,7 @@ FilterParamSetterRet EncCommonCnv::cnvMinQuality(std::shared_ptr<C2InterfaceHelp
     if (level > 0) {
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamMinQuality>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamMinQuality>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamMinQuality>>(filterParam->getBaseParam());
 
             param->m.level = level;
@@ -1514,7 +1514,7 @@ FilterParamSetterRet EncCommonCnv::cnvPMV(std::shared_ptr<C2InterfaceHelper> int
         (pmv->Mode != VendorC2Config::PMV_DISABLED)) {
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamPMV>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamPMV>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamPMV>>(filterParam->getBaseParam());
 
             param->m.mode   = pmv->Mode;
@@ -1570,7 +1570,7 @@ FilterParamSetterRet EncCommonCnv::cnvPrependHeaderMode(std::shared_ptr<C2Interf
 
     auto id = intfImpl->findFilterID("enc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamPrependHeaderMode>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamPrependHeaderMode>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamPrependHeaderMode>>(filterParam->getBaseParam());
 
         if (mode->value == C2Config::PREPEND_HEADER_TO_ALL_SYNC) {
@@ -1601,7 +1601,7 @@ FilterParamSetterRet EncCommonCnv::cnvRefPframes(std::shared_ptr<C2InterfaceHelp
 
     auto id = intfImpl->findFilterID("enc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamRefPframes>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamRefPframes>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamRefPframes>>(filterParam->getBaseParam());
 
         param->m.pframes = refPframes;
@@ -1628,7 +1628,7 @@ FilterParamSetterRet EncCommonCnv::cnvIFrameRatio(std::shared_ptr<C2InterfaceHel
 
     auto id = intfImpl->findFilterID("enc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamIFrameRatio>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamIFrameRatio>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamIFrameRatio>>(filterParam->getBaseParam());
 
         param->m.value = ratio;
@@ -1657,7 +1657,7 @@ FilterParamSetterRet EncCommonCnv::cnvChromaQpOffset(std::shared_ptr<C2Interface
     if (offset.get() != nullptr) {
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamChromaQpOffset>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamChromaQpOffset>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamChromaQpOffset>>(filterParam->getBaseParam());
 
             param->m.cb = offset->Cb;
@@ -1687,7 +1687,7 @@ FilterParamSetterRet EncCommonCnv::cnvGop(std::shared_ptr<C2InterfaceHelper> int
 
     auto id = intfImpl->findFilterID("enc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamBFrame>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamBFrame>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamBFrame>>(filterParam->getBaseParam());
 
         ParseGop(*gop, nullptr, nullptr, &(param->m.bframes));
@@ -1718,7 +1718,7 @@ FilterParamSetterRet EncCommonCnv::cnvHdrFormat(std::shared_ptr<C2InterfaceHelpe
         (type == C2Config::hdr_format_t::HDR10_PLUS)) {
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamHdrEncoding>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamHdrEncoding>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamHdrEncoding>>(filterParam->getBaseParam());
 
             if ((C2Config::hdr_format_t)type == C2Config::hdr_format_t::HDR10) {
@@ -1755,7 +1755,7 @@ FilterParamSetterRet EncCommonCnv::cnvHdrStaticInfo(std::shared_ptr<C2InterfaceH
 
     auto id = intfImpl->findFilterID("enc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamHdrStaticInfo>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamHdrStaticInfo>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamHdrStaticInfo>>(filterParam->getBaseParam());
 
         ExynosHdrStaticInfo &ST = param->m.ST;
@@ -1804,7 +1804,7 @@ FilterParamSetterRet EncCommonCnv::cnvHdrDynamicInfo(std::shared_ptr<C2Interface
 
     auto id = intfImpl->findFilterID("enc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamHdrDynamicInfo>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamHdrDynamicInfo>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamHdrDynamicInfo>>(filterParam->getBaseParam());
 
         ExynosHdrDynamicInfo &DY = param->m.DY;
@@ -1840,7 +1840,7 @@ FilterParamSetterRet EncCommonCnv::cnvMaxIFrameSize(std::shared_ptr<C2InterfaceH
 
     auto id = intfImpl->findFilterID("enc");
     if (id != 0) {  /* target filter is valid */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamMaxIFrameSize>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamMaxIFrameSize>>();
         auto param       = std::static_pointer_cast<ExynosParam<ParamMaxIFrameSize>>(filterParam->getBaseParam());
 
         param->m.size = size;
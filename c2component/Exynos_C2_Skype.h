@@ -357,7 +357,7 @@ public:
 
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamSkypeLowLatency>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamSkypeLowLatency>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamSkypeLowLatency>>(filterParam->getBaseParam());
 
             param->m.enable = intfImpl->getSkypeLowLatency();
@@ -385,7 +385,7 @@ public:
 
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamSkypeInputControl>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamSkypeInputControl>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamSkypeInputControl>>(filterParam->getBaseParam());
 
             param->m.enable = intfImpl->getSkypeInputControl();
@@ -413,7 +413,7 @@ public:
 
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamSkypeLTRCount>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamSkypeLTRCount>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamSkypeLTRCount>>(filterParam->getBaseParam());
 
             param->m.value = intfImpl->getSkypeLTRCount();
@@ -440,7 +440,7 @@ public:
 
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamSkypeLTR>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamSkypeLTR>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamSkypeLTR>>(filterParam->getBaseParam());
 
             auto ltr = intfImpl->getSkypeLTR();
@@ -471,7 +471,7 @@ public:
 
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamSkypeSAR>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamSkypeSAR>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamSkypeSAR>>(filterParam->getBaseParam());
 
             auto sar = intfImpl->getSkypeSar();
@@ -504,7 +504,7 @@ public:
         if (size > 0) {
             auto id = intfImpl->findFilterID("enc");
             if (id != 0) {  /* target filter is valid */
-                auto filterParam = std::make_shared<ExynosFilterParam<ParamSliceSize>>();
+                auto filterParam = MakePooledShared<ExynosFilterParam<ParamSliceSize>>();
                 auto param       = std::static_pointer_cast<ExynosParam<ParamSliceSize>>(filterParam->getBaseParam());
 
                 param->m.mode = SLICE_MODE_MB;
@@ -534,7 +534,7 @@ public:
 
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamSkypeFrameQP>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamSkypeFrameQP>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamSkypeFrameQP>>(filterParam->getBaseParam());
 
             param->m.value = intfImpl->getSkypeFrameQp();
@@ -561,7 +561,7 @@ public:
 
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamSkypeBaseLayerPid>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamSkypeBaseLayerPid>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamSkypeBaseLayerPid>>(filterParam->getBaseParam());
 
             param->m.value = intfImpl->getSkypeBaseLayerPid();
@@ -627,7 +627,7 @@ void skypeSetup(std::shared_ptr<ExynosC2Component::CommonParamIntf> paramIntf, i
 
                 auto id = encIntf->findFilterID("enc");
                 if (id != 0) {  /* target filter is valid */
-                    auto filterParam = std::make_shared<ExynosFilterParam<ParamMaxLayering>>();
+                    auto filterParam = MakePooledShared<ExynosFilterParam<ParamMaxLayering>>();
                     auto param       = std::static_pointer_cast<ExynosParam<ParamMaxLayering>>(filterParam->getBaseParam());
 
                     param->m.layerCount = max;
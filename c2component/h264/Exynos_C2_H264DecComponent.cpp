@@ -206,7 +206,7 @@ public:
 
         auto id = intfImpl->findFilterID("dec");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamSkypeLowLatency>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamSkypeLowLatency>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamSkypeLowLatency>>(filterParam->getBaseParam());
 
             param->m.enable = intfImpl->getSkypeLowLatency();
@@ -502,7 +502,7 @@ public:
 
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamProfileLevel>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamProfileLevel>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamProfileLevel>>(filterParam->getBaseParam());
 
             /* default */
@@ -561,7 +561,7 @@ public:
         if (size > 0) {
             auto id = intfImpl->findFilterID("enc");
             if (id != 0) {  /* target filter is valid */
-                auto filterParam = std::make_shared<ExynosFilterParam<ParamSliceSize>>();
+                auto filterParam = MakePooledShared<ExynosFilterParam<ParamSliceSize>>();
                 auto param       = std::static_pointer_cast<ExynosParam<ParamSliceSize>>(filterParam->getBaseParam());
 
                 param->m.mode = SLICE_MODE_BYTES;
@@ -617,7 +617,7 @@ public:
 
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamEntropyMode>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamEntropyMode>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamEntropyMode>>(filterParam->getBaseParam());
 
             param->m.value = intfImpl->getEntropyMode();
@@ -233,7 +233,7 @@ public:
         if (intfImpl->getImageConvert()) {
             auto id = intfImpl->findFilterID("hdr2sdr");
             if (id != 0) {  /* target filter is valid */
-                auto filterParam = std::make_shared<ExynosFilterParam<ParamHDR2SDR>>();
+                auto filterParam = MakePooledShared<ExynosFilterParam<ParamHDR2SDR>>();
                 auto param       = std::static_pointer_cast<ExynosParam<ParamHDR2SDR>>(filterParam->getBaseParam());
 
                 param->m.enable = 1;
@@ -261,7 +261,7 @@ public:
 
         auto id = intfImpl->findFilterID("hdr2sdr");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamHDR2SDRMode>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamHDR2SDRMode>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamHDR2SDRMode>>(filterParam->getBaseParam());
 
             param->m.type = intfImpl->getImageConvertMode();
@@ -288,7 +288,7 @@ public:
 
         auto id = intfImpl->findFilterID("hdr2sdr");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamHDR2SDRPixelFormat>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamHDR2SDRPixelFormat>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamHDR2SDRPixelFormat>>(filterParam->getBaseParam());
 
             param->m.format = intfImpl->getImageConvertPixelFormat();
@@ -541,7 +541,7 @@ public:
 
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamFrameQP>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamFrameQP>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamFrameQP>>(filterParam->getBaseParam());
 
             int32_t quality = intfImpl->getQuality();
@@ -633,7 +633,7 @@ public:
 
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamProfileLevel>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamProfileLevel>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamProfileLevel>>(filterParam->getBaseParam());
 
             /* default */
@@ -716,7 +716,7 @@ public:
 
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamGeneralPB>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamGeneralPB>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamGeneralPB>>(filterParam->getBaseParam());
 
             auto enable = intfImpl->getGeneralPB();
@@ -786,7 +786,7 @@ public:
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
             if (intfImpl->getHDR10PlusStatEnc()) {
-                auto filterParam = std::make_shared<ExynosFilterParam<ParamHDR10PlusStat>>();
+                auto filterParam = MakePooledShared<ExynosFilterParam<ParamHDR10PlusStat>>();
                 auto param       = std::static_pointer_cast<ExynosParam<ParamHDR10PlusStat>>(filterParam->getBaseParam());
 
                 param->m.enable = 1;
@@ -221,7 +221,7 @@ public:
 
         auto id = intfImpl->findFilterID("enc");
         if (id != 0) {  /* target filter is valid */
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamProfileLevel>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamProfileLevel>>();
             auto param       = std::static_pointer_cast<ExynosParam<ParamProfileLevel>>(filterParam->getBaseParam());
 
             /* default */
@@ -9,7 +9,8 @@ LOCAL_CFLAGS :=
 LOCAL_MODULE_TAGS := optional
 
 LOCAL_SRC_FILES := \
-        ExynosCSC.cpp
+        ExynosCSC.cpp \
+        ExynosCSCKernel.cpp
 
 LOCAL_PRELINK_MODULE := false
 LOCAL_MODULE := libExynosCSC
@@ -36,3 +37,74 @@ LOCAL_CFLAGS +=	-fPIC \
 LOCAL_CFLAGS += $(EXYNOS_GLOBAL_CFLAGS)
 
 include $(BUILD_STATIC_LIBRARY)
+
+#############################
+####   ExynosC2CSCTest   ####
+#############################
+include $(CLEAR_VARS)
+
+LOCAL_CFLAGS :=
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_SRC_FILES := \
+        tests/ExynosCSCKernel_test.cpp \
+        tests/ExynosCSC_test.cpp
+
+LOCAL_MODULE := ExynosC2CSCTest
+LOCAL_LICENSE_KINDS := SPDX-license-identifier-Apache-2.0
+LOCAL_LICENSE_CONDITIONS := notice
+LOCAL_NOTICE_FILE := $(LOCAL_PATH)/NOTICE
+
+LOCAL_PROPRIETARY_MODULE := true
+
+LOCAL_HEADER_LIBRARIES := libexynosc2_csc_headers
+LOCAL_HEADER_LIBRARIES += $(EXYNOS_VENDOR_HEADER_LIBS)
+
+LOCAL_STATIC_LIBRARIES := libExynosCSC libExynosC2OSAL
+
+LOCAL_SHARED_LIBRARIES := liblog libcutils libutils libhardware libacryl
+LOCAL_SHARED_LIBRARIES += $(EXYNOS_VENDOR_SHARED_LIBS)
+
+LOCAL_CFLAGS +=	-O2 \
+                -Werror \
+                -Wall \
+                -std=gnu++1z \
+                -std=c++2a
+LOCAL_CFLAGS += $(EXYNOS_GLOBAL_CFLAGS)
+
+include $(BUILD_NATIVE_TEST)
+
+####################################
+####  ExynosC2CSCKernelBenchmark ###
+####################################
+include $(CLEAR_VARS)
+
+LOCAL_CFLAGS :=
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_SRC_FILES := \
+        benchmark/Exynos_CSCKernel_Benchmark.cpp
+
+LOCAL_MODULE := ExynosC2CSCKernelBenchmark
+LOCAL_LICENSE_KINDS := SPDX-license-identifier-Apache-2.0
+LOCAL_LICENSE_CONDITIONS := notice
+LOCAL_NOTICE_FILE := $(LOCAL_PATH)/NOTICE
+
+LOCAL_PROPRIETARY_MODULE := true
+
+LOCAL_HEADER_LIBRARIES := libexynosc2_csc_headers
+LOCAL_HEADER_LIBRARIES += $(EXYNOS_VENDOR_HEADER_LIBS)
+
+LOCAL_STATIC_LIBRARIES := libExynosCSC libExynosC2OSAL
+
+LOCAL_SHARED_LIBRARIES := liblog libcutils libutils libhardware libacryl
+LOCAL_SHARED_LIBRARIES += $(EXYNOS_VENDOR_SHARED_LIBS)
+
+LOCAL_CFLAGS +=	-O3 \
+                -Werror \
+                -Wall \
+                -std=gnu++1z \
+                -std=c++2a
+LOCAL_CFLAGS += $(EXYNOS_GLOBAL_CFLAGS)
+
+include $(BUILD_EXECUTABLE)
@@ -20,7 +20,14 @@
 #include "ExynosGraphicBuffer.h"
 #include "hardware/exynos/acryl.h"
 
+#include <vector>
+#include <future>
+#include <functional>
+
+#include "ExynosStripeRunner.h"
+
 #include "ExynosCSC.h"
+#include "ExynosCSCKernel.h"
 
 #define LOG_ON
 #include "ExynosLog.h"
@@ -82,9 +89,9 @@ const coeff_matrix kBT2020[2] = {
     },
 };
 
-typedef bool (*ConvFunc)(ExynosBufferInfo input, ExynosBufferInfo output);
+typedef bool (*ConvFunc)(ExynosBufferInfo &input, ExynosBufferInfo &output, const ExynosStripeRunner &runner);
 
-static bool bufferMap(ExynosBufferInfo input, ExynosBufferInfo output,
+static bool bufferMap(ExynosBufferInfo &input, ExynosBufferInfo &output,
                       BufferAddressInfo &inAddrInfo, BufferAddressInfo &outAddrInfo) {
     std::shared_ptr<ExynosBuffer> inBuf = input.obj;
     if (inBuf->map(inAddrInfo) == false) {
@@ -111,8 +118,9 @@ static bool bufferMap(ExynosBufferInfo input, ExynosBufferInfo output,
 }
 
 static bool conv420P(
-    ExynosBufferInfo input,
-    ExynosBufferInfo output) {
+    ExynosBufferInfo &input,
+    ExynosBufferInfo &output,
+    const ExynosStripeRunner &runner) {
     BufferAddressInfo inAddrInfo, outAddrInfo;
 
     if (false == bufferMap(input, output, inAddrInfo, outAddrInfo)) {
@@ -121,19 +129,8 @@ static bool conv420P(
     std::shared_ptr<ExynosBuffer> inBuf = input.obj;
     std::shared_ptr<ExynosBuffer> outBuf = output.obj;
 
-    /* Y plane */
     char *pSrc = (char *)inAddrInfo.plane[0];
     char *pDst = (char *)outAddrInfo.plane[0];
-    if ((input.stImageInfo.nStride == output.stImageInfo.nStride) &&
-        (input.stImageInfo.stCropInfo.nWidth == output.stImageInfo.stCropInfo.nWidth)) {
-        memcpy(pDst, pSrc, (input.stImageInfo.nStride * input.stImageInfo.stCropInfo.nHeight));
-    } else {
-        for (int i = 0; i < (int)input.stImageInfo.stCropInfo.nHeight; i++) {
-            memcpy(pDst + (output.stImageInfo.nStride * i),
-                   pSrc + (input.stImageInfo.nStride * i),
-                   input.stImageInfo.stCropInfo.nWidth);
-        }
-    }
 
     int SRC_WIDTH_ALIGN = (inBuf->getFlags() & ExynosBuffer::GPU_TEXTURE)? HW_GPU_ALIGN:HW_WIDTH_ALIGN;
     if (input.stImageInfo.nFormat == HAL_PIXEL_FORMAT_YV12) {
@@ -173,19 +170,37 @@ static bool conv420P(
         return false;
     }
 
-    /* U/V plane */
-    for (int i = 0; i < (int)(input.stImageInfo.stCropInfo.nHeight >> 1); i++) {
-        memcpy(pDst_Plane2 + (dstStride * i),
-               pSrc_Plane2 + (srcStride * i),
-               (input.stImageInfo.stCropInfo.nWidth >> 1));
-    }
+    auto stripe = [&](int start, int end) {
+        /* Y plane */
+        if ((input.stImageInfo.nStride == output.stImageInfo.nStride) &&
+            (input.stImageInfo.stCropInfo.nWidth == output.stImageInfo.stCropInfo.nWidth)) {
+            memcpy(pDst + (output.stImageInfo.nStride * start),
+                   pSrc + (input.stImageInfo.nStride * start),
+                   (input.stImageInfo.nStride * (end - start)));
+        } else {
+            for (int i = start; i < end; i++) {
+                memcpy(pDst + (output.stImageInfo.nStride * i),
+                       pSrc + (input.stImageInfo.nStride * i),
+                       input.stImageInfo.stCropInfo.nWidth);
+            }
+        }
 
-    /* V/U plane */
-    for (int i = 0; i < (int)(input.stImageInfo.stCropInfo.nHeight >> 1); i++) {
-        memcpy(pDst_Plane3 + (dstStride * i),
-               pSrc_Plane3 + (srcStride * i),
-               (input.stImageInfo.stCropInfo.nWidth >> 1));
-    }
+        /* U/V plane : odd width or height has a chroma sample for the last pixel */
+        for (int i = (start >> 1); i < ((end + 1) >> 1); i++) {
+            memcpy(pDst_Plane2 + (dstStride * i),
+                   pSrc_Plane2 + (srcStride * i),
+                   ((input.stImageInfo.stCropInfo.nWidth + 1) >> 1));
+        }
+
+        /* V/U plane */
+        for (int i = (start >> 1); i < ((end + 1) >> 1); i++) {
+            memcpy(pDst_Plane3 + (dstStride * i),
+                   pSrc_Plane3 + (srcStride * i),
+                   ((input.stImageInfo.stCropInfo.nWidth + 1) >> 1));
+        }
+    };
+
+    runner.run(input.stImageInfo.stCropInfo.nHeight, stripe);
 
     inBuf->unmap();
     outBuf->unmap();
@@ -194,8 +209,9 @@ static bool conv420P(
 }
 
 static bool conv420SPXto420SPX_Common(
-    ExynosBufferInfo input,
-    ExynosBufferInfo output,
+    ExynosBufferInfo &input,
+    ExynosBufferInfo &output,
+    const ExynosStripeRunner &runner,
     bool bIs10Bit = false) {
     BufferAddressInfo inAddrInfo, outAddrInfo;
     int byte = (bIs10Bit == false)? 1: 2;
@@ -215,40 +231,48 @@ static bool conv420SPXto420SPX_Common(
         (input.stImageInfo.nFormat == HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_SP) ||
         (input.stImageInfo.nFormat == HAL_PIXEL_FORMAT_YCBCR_P010)) {
         /* single-fd to multi-fd */
-        int vstride = vendor::graphics::ExynosGraphicBufferMeta::get_vstride(input.obj->handle());
+        int vstride = input.obj->vstride();
 
         pSrcCbCr = (char *)inAddrInfo.plane[0] + ((input.stImageInfo.nStride * byte) * vstride);
         pDstCbCr = (char *)outAddrInfo.plane[1];
     } else {
         /* multi-fd to single-fd */
-        int vstride = vendor::graphics::ExynosGraphicBufferMeta::get_vstride(output.obj->handle());
+        int vstride = output.obj->vstride();
 
         pSrcCbCr = (char *)inAddrInfo.plane[1];
         pDstCbCr = (char *)outAddrInfo.plane[0] + ((output.stImageInfo.nStride * byte) * vstride);
     }
 
-    if ((input.stImageInfo.nStride == output.stImageInfo.nStride) &&
-        (input.stImageInfo.stCropInfo.nWidth == output.stImageInfo.stCropInfo.nWidth)) {
-        /* Y plane */
-        memcpy(pDst, pSrc, ((input.stImageInfo.nStride * byte) * input.stImageInfo.stCropInfo.nHeight));
+    int srcStride = (input.stImageInfo.nStride * byte);
+    int dstStride = (output.stImageInfo.nStride * byte);
+
+    auto stripe = [&](int start, int end) {
+        if ((input.stImageInfo.nStride == output.stImageInfo.nStride) &&
+            (input.stImageInfo.stCropInfo.nWidth == output.stImageInfo.stCropInfo.nWidth)) {
+            /* Y plane */
+            memcpy(pDst + (dstStride * start), pSrc + (srcStride * start), (srcStride * (end - start)));
+
+            /* CbCr plane */
+            memcpy(pDstCbCr + (dstStride * (start >> 1)), pSrcCbCr + (srcStride * (start >> 1)),
+                   (srcStride * (((end + 1) >> 1) - (start >> 1))));
+        } else {
+            /* Y plane */
+            for (int i = start; i < end; i++) {
+                memcpy(pDst + (dstStride * i),
+                       pSrc + (srcStride * i),
+                       (input.stImageInfo.stCropInfo.nWidth * byte));
+            }
 
-        /* CbCr plane */
-        memcpy(pDstCbCr, pSrcCbCr, ((input.stImageInfo.nStride * byte) * (input.stImageInfo.stCropInfo.nHeight >> 1)));
-    } else {
-        /* Y plane */
-        for (int i = 0; i < (int)input.stImageInfo.stCropInfo.nHeight; i++) {
-            memcpy(pDst + ((output.stImageInfo.nStride * byte) * i),
-                   pSrc + ((input.stImageInfo.nStride * byte) * i),
-                   (input.stImageInfo.stCropInfo.nWidth * byte));
+            /* CbCr plane : a pair of Cb and Cr */
+            for (int i = (start >> 1); i < ((end + 1) >> 1); i++) {
+                memcpy(pDstCbCr + (dstStride * i),
+                       pSrcCbCr + (srcStride * i),
+                       (ALIGN(input.stImageInfo.stCropInfo.nWidth, 2) * byte));
+            }
         }
+    };
 
-        /* CbCr plane */
-        for (int i = 0; i < (int)(input.stImageInfo.stCropInfo.nHeight >> 1); i++) {
-            memcpy(pDstCbCr + ((output.stImageInfo.nStride * byte) * i),
-                   pSrcCbCr + ((input.stImageInfo.nStride * byte) * i),
-                   (input.stImageInfo.stCropInfo.nWidth * byte));
-        }
-    }
+    runner.run(input.stImageInfo.stCropInfo.nHeight, stripe);
 
     inBuf->unmap();
     outBuf->unmap();
@@ -257,32 +281,37 @@ static bool conv420SPXto420SPX_Common(
 }
 
 static bool conv420Pto420PM(
-    ExynosBufferInfo input,
-    ExynosBufferInfo output) {
-    return conv420P(input, output);
+    ExynosBufferInfo &input,
+    ExynosBufferInfo &output,
+    const ExynosStripeRunner &runner) {
+    return conv420P(input, output, runner);
 }
 
 static bool conv420SPto420SPM(
-    ExynosBufferInfo input,
-    ExynosBufferInfo output) {
-    return conv420SPXto420SPX_Common(input, output, false);
+    ExynosBufferInfo &input,
+    ExynosBufferInfo &output,
+    const ExynosStripeRunner &runner) {
+    return conv420SPXto420SPX_Common(input, output, runner, false);
 }
 
 static bool convP010XtoP010X(
-    ExynosBufferInfo input,
-    ExynosBufferInfo output) {
-    return conv420SPXto420SPX_Common(input, output, true);
+    ExynosBufferInfo &input,
+    ExynosBufferInfo &output,
+    const ExynosStripeRunner &runner) {
+    return conv420SPXto420SPX_Common(input, output, runner, true);
 }
 
 static bool conv420PMto420P(
-    ExynosBufferInfo input,
-    ExynosBufferInfo output) {
-    return conv420P(input, output);
+    ExynosBufferInfo &input,
+    ExynosBufferInfo &output,
+    const ExynosStripeRunner &runner) {
+    return conv420P(input, output, runner);
 }
 
 static bool convP010MtoYV12(
-    ExynosBufferInfo input,
-    ExynosBufferInfo output) {
+    ExynosBufferInfo &input,
+    ExynosBufferInfo &output,
+    const ExynosStripeRunner &runner) {
     BufferAddressInfo inAddrInfo, outAddrInfo;
 
     if (false == bufferMap(input, output, inAddrInfo, outAddrInfo)) {
@@ -291,25 +320,16 @@ static bool convP010MtoYV12(
     std::shared_ptr<ExynosBuffer> inBuf = input.obj;
     std::shared_ptr<ExynosBuffer> outBuf = output.obj;
 
-    /* Y plane */
+    const CSCKernel &kernel = GetCSCKernel();
+
     uint16_t *pSrc = (uint16_t *)inAddrInfo.plane[0];
     uint8_t  *pDst = (uint8_t *)outAddrInfo.plane[0];
 
-    for (size_t y = 0; y < input.stImageInfo.stCropInfo.nHeight; ++y) {
-        for (size_t x = 0; x < input.stImageInfo.stCropInfo.nWidth; ++x) {
-            pDst[x] = (uint8_t)(pSrc[x] >> 8);  /* little endian : MSB(8bit + 2bit) */
-        }
-
-        pSrc += input.stImageInfo.nStride;
-        pDst += output.stImageInfo.nStride;
-    }
-
     int DST_WIDTH_ALIGN = (outBuf->getFlags() & ExynosBuffer::GPU_TEXTURE)? HW_GPU_ALIGN:HW_WIDTH_ALIGN;
     if (output.stImageInfo.nFormat == HAL_PIXEL_FORMAT_YV12) {
         DST_WIDTH_ALIGN = 16;
     }
 
-    /* CbCr plane */
     uint16_t *pSrcCb = (uint16_t *)inAddrInfo.plane[1];
 
     uint8_t *pDstV = nullptr;
@@ -323,16 +343,26 @@ static bool convP010MtoYV12(
         pDstU = (uint8_t *)(pDstV + ALIGN((output.stImageInfo.nStride >> 1), DST_WIDTH_ALIGN) * (output.stImageInfo.nHeight >> 1));
     }
 
-    for (size_t y = 0; y < (input.stImageInfo.stCropInfo.nHeight + 1) / 2; ++y) {
-        for (size_t x = 0; x < (input.stImageInfo.stCropInfo.nWidth + 1) / 2; ++x) {
-            pDstU[x] = (uint8_t)(pSrcCb[(x * 2)] >> 8);  /* little endian : MSB(8bit + 2bit) */
-            pDstV[x] = (uint8_t)(pSrcCb[(x * 2) + 1] >> 8);
+    size_t dstCStride = ALIGN((output.stImageInfo.nStride >> 1), DST_WIDTH_ALIGN);
+
+    auto stripe = [&](int start, int end) {
+        /* Y plane */
+        for (int y = start; y < end; ++y) {
+            kernel.narrow16to8(pSrc + (input.stImageInfo.nStride * y),
+                               pDst + (output.stImageInfo.nStride * y),
+                               input.stImageInfo.stCropInfo.nWidth);
         }
 
-        pSrcCb += input.stImageInfo.nStride;
-        pDstV += ALIGN((output.stImageInfo.nStride >> 1), DST_WIDTH_ALIGN);
-        pDstU += ALIGN((output.stImageInfo.nStride >> 1), DST_WIDTH_ALIGN);
-    }
+        /* CbCr plane */
+        for (int y = (start / 2); y < ((end + 1) / 2); ++y) {
+            kernel.deinterleave16to8(pSrcCb + (input.stImageInfo.nStride * y),
+                                     pDstU + (dstCStride * y),
+                                     pDstV + (dstCStride * y),
+                                     (input.stImageInfo.stCropInfo.nWidth + 1) / 2);
+        }
+    };
+
+    runner.run(input.stImageInfo.stCropInfo.nHeight, stripe);
 
     inBuf->unmap();
     outBuf->unmap();
@@ -341,8 +371,9 @@ static bool convP010MtoYV12(
 }
 
 static bool convP010toNV12X(
-    ExynosBufferInfo input,
-    ExynosBufferInfo output) {
+    ExynosBufferInfo &input,
+    ExynosBufferInfo &output,
+    const ExynosStripeRunner &runner) {
     BufferAddressInfo inAddrInfo, outAddrInfo;
 
     if (false == bufferMap(input, output, inAddrInfo, outAddrInfo)) {
@@ -351,40 +382,39 @@ static bool convP010toNV12X(
     std::shared_ptr<ExynosBuffer> inBuf = input.obj;
     std::shared_ptr<ExynosBuffer> outBuf = output.obj;
 
-    /* Y plane */
+    const CSCKernel &kernel = GetCSCKernel();
+
     uint16_t *pSrc = (uint16_t *)inAddrInfo.plane[0];
     uint8_t  *pDst = (uint8_t *)outAddrInfo.plane[0];
 
-    for (size_t y = 0; y < input.stImageInfo.stCropInfo.nHeight; ++y) {
-        for (size_t x = 0; x < input.stImageInfo.stCropInfo.nWidth; ++x) {
-            pDst[x] = (uint8_t)(pSrc[x] >> 8);  /* little endian : MSB(8bit + 2bit) */
-        }
-
-        pSrc += input.stImageInfo.nStride;
-        pDst += output.stImageInfo.nStride;
-    }
-
-    /* CbCr plane */
-    int vstride = vendor::graphics::ExynosGraphicBufferMeta::get_vstride(input.obj->handle());
+    int vstride = input.obj->vstride();
 
     uint16_t *pSrcCb    = (uint16_t *)inAddrInfo.plane[0] + (input.stImageInfo.nStride * vstride);
     uint8_t  *pDstCb    = (uint8_t *)outAddrInfo.plane[1];
 
     if (output.stImageInfo.nFormat == HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_SPN) {
-        int vstride = vendor::graphics::ExynosGraphicBufferMeta::get_vstride(output.obj->handle());
+        int vstride = output.obj->vstride();
 
         pDstCb = (uint8_t *)outAddrInfo.plane[0] + (output.stImageInfo.nStride * vstride);
     }
 
-    for (size_t y = 0; y < (input.stImageInfo.stCropInfo.nHeight + 1) / 2; ++y) {
-        for (size_t x = 0; x < input.stImageInfo.stCropInfo.nWidth; x += 2) {
-            pDstCb[x]       = (uint8_t)(pSrcCb[x] >> 8);  /* little endian : MSB(8bit + 2bit) */
-            pDstCb[x + 1]   = (uint8_t)(pSrcCb[x + 1] >> 8);
+    auto stripe = [&](int start, int end) {
+        /* Y plane */
+        for (int y = start; y < end; ++y) {
+            kernel.narrow16to8(pSrc + (input.stImageInfo.nStride * y),
+                               pDst + (output.stImageInfo.nStride * y),
+                               input.stImageInfo.stCropInfo.nWidth);
         }
 
-        pSrcCb += input.stImageInfo.nStride;
-        pDstCb += output.stImageInfo.nStride;
-    }
+        /* CbCr plane : a pair of Cb and Cr */
+        for (int y = (start / 2); y < ((end + 1) / 2); ++y) {
+            kernel.narrow16to8(pSrcCb + (input.stImageInfo.nStride * y),
+                               pDstCb + (output.stImageInfo.nStride * y),
+                               ALIGN(input.stImageInfo.stCropInfo.nWidth, 2));
+        }
+    };
+
+    runner.run(input.stImageInfo.stCropInfo.nHeight, stripe);
 
     inBuf->unmap();
     outBuf->unmap();
@@ -393,8 +423,9 @@ static bool convP010toNV12X(
 }
 
 static bool convRGBAtoNV21M(
-    ExynosBufferInfo input,
-    ExynosBufferInfo output) {
+    ExynosBufferInfo &input,
+    ExynosBufferInfo &output,
+    const ExynosStripeRunner &runner) {
     BufferAddressInfo inAddrInfo, outAddrInfo;
 
     if (false == bufferMap(input, output, inAddrInfo, outAddrInfo)) {
@@ -429,9 +460,14 @@ static bool convRGBAtoNV21M(
     }
 
     {
-        unsigned int tmp;
-        unsigned int R, G, B;
-        uint64_t Y, U, V;
+        const CSCKernel &kernel = GetCSCKernel();
+
+        CSCCoeff coeff = {
+            { (int16_t)matrix->Y.CR, (int16_t)matrix->Y.CG, (int16_t)matrix->Y.CB },
+            { (int16_t)matrix->U.CR, (int16_t)matrix->U.CG, (int16_t)matrix->U.CB },
+            { (int16_t)matrix->V.CR, (int16_t)matrix->V.CG, (int16_t)matrix->V.CB },
+            zeroLvl, maxLvlLuma, maxLvlChroma,
+        };
 
         int src_stride = input.stImageInfo.nStride;
         int width  = input.stImageInfo.stCropInfo.nWidth;
@@ -443,38 +479,18 @@ static bool convRGBAtoNV21M(
         unsigned char *pDstY = (unsigned char *)outAddrInfo.plane[0];
         unsigned char *pDstVU = (unsigned char *)outAddrInfo.plane[1];
 
-        int vu_offset = 0;
+        auto stripe = [&](int start, int end) {
+            for (int j = start; j < end; j++) {
+                kernel.rgbaToY(pSrc + (j * src_stride), pDstY + (j * dst_stride), width, coeff);
 
-#define CLIP3(min,v,max) (((v) < (min)) ? (min) : (((max) > (v)) ? (v) : (max)))
-        for (int j = 0; j < height; j++) {
-            if ((j % 2) == 0) {
-                vu_offset = ((j / 2) * dst_stride);
-            }
-
-            for (int i = 0; i < width; i++) {
-                tmp = pSrc[(j * src_stride) + i];
-
-                B = (tmp & 0x00FF0000) >> 16;
-                G = (tmp & 0x0000FF00) >> 8;
-                R = (tmp & 0x000000FF);
-
-                Y = (((matrix->Y.CR * R) + (matrix->Y.CG * G) + (matrix->Y.CB * B)) >> 8) + zeroLvl;
-                Y = CLIP3(zeroLvl, Y, maxLvlLuma);
-
-                pDstY[(j * dst_stride) + i] = (unsigned char)Y;
-
-                if ((j % 2) == 0 && (i % 2) == 0) {
-                    U = (((matrix->U.CR * R) + (matrix->U.CG * G) + (matrix->U.CB * B)) >> 8) + 128;
-                    U = CLIP3(zeroLvl, U, maxLvlChroma);
-
-                    V = (((matrix->V.CR * R) + (matrix->V.CG * G) + (matrix->V.CB * B)) >> 8) + 128;
-                    V = CLIP3(zeroLvl, V, maxLvlChroma);
-
-                    pDstVU[vu_offset++] = (unsigned char)V;
-                    pDstVU[vu_offset++] = (unsigned char)U;
+                /* chroma is taken from top-left pixel of each 2x2 block */
+                if ((j % 2) == 0) {
+                    kernel.rgbaToVU(pSrc + (j * src_stride), pDstVU + ((j / 2) * dst_stride), width, coeff);
                 }
             }
-        }
+        };
+
+        runner.run(height, stripe);
     }
 
     inBuf->unmap();
@@ -507,7 +523,7 @@ struct SW_CONV_INFO {
       HAL_PIXEL_FORMAT_EXYNOS_YV12_M,
       conv420Pto420PM },
     { HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_P,
-      HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_SP_M,
+      HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_P_M,
       conv420Pto420PM },
     { HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_SP,
       HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_SP_M,
@@ -531,8 +547,10 @@ struct SW_CONV_INFO {
 
 class SWCSCImpl : public CSCImpl {
 public:
-    SWCSCImpl(std::string name) {
+    SWCSCImpl(std::string name) : mRunner(name) {
         mObjName = name;
+
+        mRunner.setThreadInfo(ExynosUtils::GetSWCSCThreadCnt(), ExynosUtils::GetSWCSCStripeHeight());
     }
 
     ~SWCSCImpl() = default;
@@ -556,7 +574,7 @@ public:
                     updateActualDataSpace(output.stImageInfo.nDataSpace);
                 }
 
-                return info.func(input, output);
+                return info.func(input, output, mRunner);
             }
         }
 
@@ -565,11 +583,19 @@ public:
         return false;
     }
 
+    void setThreadInfo(uint32_t threads, uint32_t stripeHeight) override {
+        ExynosLogD("[%s] threads(%d), stripe height(%d)", __FUNCTION__, threads, stripeHeight);
+
+        mRunner.setThreadInfo(threads, stripeHeight);
+    }
+
 private:
     void updateActualDataSpace(unsigned int &dataspace) override {
         ExynosLogD("[%s] dataspace(0x%x)", __FUNCTION__, dataspace);
     }
 
+    ExynosStripeRunner mRunner;
+
     SWCSCImpl() = delete;
 };
 
@@ -732,7 +758,7 @@ ExynosCSC::ExynosCSC(std::string name, ExynosCSC::Type type) {
     }
 }
 
-bool ExynosCSC::process(ExynosBufferInfo input, ExynosBufferInfo output) {
+bool ExynosCSC::process(ExynosBufferInfo &input, ExynosBufferInfo &output) {
     ExynosLogFunctionTrace();
 
     if (mImpl.get() == nullptr) {
@@ -765,6 +791,18 @@ bool ExynosCSC::process(ExynosBufferInfo input, ExynosBufferInfo output) {
     return ret;
 }
 
+void ExynosCSC::setThreadInfo(uint32_t threads, uint32_t stripeHeight) {
+    ExynosLogFunctionTrace();
+
+    if (mImpl.get() == nullptr) {
+        return;
+    }
+
+    mImpl->setThreadInfo(threads, stripeHeight);
+
+    return;
+}
+
 void ExynosCSC::setOperatingRate(uint32_t operatingRate) {
     ExynosLogFunctionTrace();
 
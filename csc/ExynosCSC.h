@@ -36,6 +36,7 @@ public:
 
     virtual bool run(ExynosBufferInfo &input, ExynosBufferInfo &output) = 0;
     virtual void setOperatingRate(uint32_t operatingRate) { UNUSED(operatingRate); }
+    virtual void setThreadInfo(uint32_t threads, uint32_t stripeHeight) { UNUSED(threads); UNUSED(stripeHeight); }
 
 private:
     virtual void updateActualDataSpace(unsigned int &dataspace) = 0;
@@ -59,8 +60,9 @@ public:
     }
 
     // bool setRotationInfo();
-    bool process(ExynosBufferInfo input, ExynosBufferInfo output);
+    bool process(ExynosBufferInfo &input, ExynosBufferInfo &output);
     void setOperatingRate(uint32_t operatingRate);
+    void setThreadInfo(uint32_t threads, uint32_t stripeHeight);  /* only for SW */
 
 private:
     std::shared_ptr<CSCImpl> mImpl;
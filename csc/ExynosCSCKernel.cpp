@@ -0,0 +1,341 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define USE_CSC_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define USE_CSC_SSE2
+#endif
+
+#include "ExynosETC.h"
+#include "ExynosCSCKernel.h"
+
+#define LOG_ON
+#include "ExynosLog.h"
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "ExynosCSCKernel"
+
+#define CLIP3(min,v,max) (((v) < (min)) ? (min) : (((max) > (v)) ? (v) : (max)))
+
+/*
+ * reference kernels
+ */
+static void narrow16to8_C(const uint16_t *src, uint8_t *dst, int width) {
+    for (int x = 0; x < width; x++) {
+        dst[x] = (uint8_t)(src[x] >> 8);  /* little endian : MSB(8bit + 2bit) */
+    }
+}
+
+static void deinterleave16to8_C(const uint16_t *src, uint8_t *dst0, uint8_t *dst1, int width) {
+    for (int x = 0; x < width; x++) {
+        dst0[x] = (uint8_t)(src[(x * 2)] >> 8);  /* little endian : MSB(8bit + 2bit) */
+        dst1[x] = (uint8_t)(src[(x * 2) + 1] >> 8);
+    }
+}
+
+static void rgbaToY_C(const uint32_t *src, uint8_t *dstY, int width, const CSCCoeff &coeff) {
+    for (int x = 0; x < width; x++) {
+        int R = (src[x] & 0x000000FF);
+        int G = (src[x] & 0x0000FF00) >> 8;
+        int B = (src[x] & 0x00FF0000) >> 16;
+
+        int Y = (((coeff.Y[0] * R) + (coeff.Y[1] * G) + (coeff.Y[2] * B)) >> 8) + coeff.zeroLvl;
+
+        dstY[x] = (uint8_t)CLIP3(coeff.zeroLvl, Y, coeff.maxLvlLuma);
+    }
+}
+
+static void rgbaToVU_C(const uint32_t *src, uint8_t *dstVU, int width, const CSCCoeff &coeff) {
+    for (int x = 0; x < width; x += 2) {
+        int R = (src[x] & 0x000000FF);
+        int G = (src[x] & 0x0000FF00) >> 8;
+        int B = (src[x] & 0x00FF0000) >> 16;
+
+        int U = (((coeff.U[0] * R) + (coeff.U[1] * G) + (coeff.U[2] * B)) >> 8) + 128;
+        int V = (((coeff.V[0] * R) + (coeff.V[1] * G) + (coeff.V[2] * B)) >> 8) + 128;
+
+        *dstVU++ = (uint8_t)CLIP3(coeff.zeroLvl, V, coeff.maxLvlChroma);
+        *dstVU++ = (uint8_t)CLIP3(coeff.zeroLvl, U, coeff.maxLvlChroma);
+    }
+}
+
+static const CSCKernel kReferenceKernel = {
+    "C",
+    narrow16to8_C,
+    deinterleave16to8_C,
+    rgbaToY_C,
+    rgbaToVU_C,
+};
+
+/*
+ * luma coefficients are non-negative and a sum of them is 256,
+ * so R * CR + G * CG + B * CB fits in 16bit unsigned.
+ * each chroma row has a sum of positive and negative coefficients as 128 at most,
+ * so every partial sum fits in 16bit signed.
+ * thus, vectors with 16bit lanes give a same result as C.
+ */
+#if defined(USE_CSC_NEON)
+static void narrow16to8_NEON(const uint16_t *src, uint8_t *dst, int width) {
+    int x = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        uint16x8_t lo = vld1q_u16(src + x);
+        uint16x8_t hi = vld1q_u16(src + x + 8);
+
+        vst1q_u8(dst + x, vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8)));
+    }
+
+    narrow16to8_C(src + x, dst + x, width - x);
+}
+
+static void deinterleave16to8_NEON(const uint16_t *src, uint8_t *dst0, uint8_t *dst1, int width) {
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8) {
+        uint16x8x2_t pair = vld2q_u16(src + (x * 2));
+
+        vst1_u8(dst0 + x, vshrn_n_u16(pair.val[0], 8));
+        vst1_u8(dst1 + x, vshrn_n_u16(pair.val[1], 8));
+    }
+
+    deinterleave16to8_C(src + (x * 2), dst0 + x, dst1 + x, width - x);
+}
+
+static void rgbaToY_NEON(const uint32_t *src, uint8_t *dstY, int width, const CSCCoeff &coeff) {
+    const uint8x8_t cr = vdup_n_u8((uint8_t)coeff.Y[0]);
+    const uint8x8_t cg = vdup_n_u8((uint8_t)coeff.Y[1]);
+    const uint8x8_t cb = vdup_n_u8((uint8_t)coeff.Y[2]);
+    const uint8x8_t zero = vdup_n_u8((uint8_t)coeff.zeroLvl);
+    const uint8x8_t max = vdup_n_u8((uint8_t)coeff.maxLvlLuma);
+
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8) {
+        uint8x8x4_t rgba = vld4_u8((const uint8_t *)(src + x));
+
+        uint16x8_t sum = vmull_u8(rgba.val[0], cr);
+        sum = vmlal_u8(sum, rgba.val[1], cg);
+        sum = vmlal_u8(sum, rgba.val[2], cb);
+
+        uint8x8_t Y = vqadd_u8(vshrn_n_u16(sum, 8), zero);
+        Y = vmin_u8(vmax_u8(Y, zero), max);
+
+        vst1_u8(dstY + x, Y);
+    }
+
+    rgbaToY_C(src + x, dstY + x, width - x, coeff);
+}
+
+static inline uint8x8_t chroma_NEON(int16x8_t R, int16x8_t G, int16x8_t B, const int16_t c[3],
+                                    int16x8_t zero, int16x8_t max) {
+    int16x8_t sum = vmulq_n_s16(R, c[0]);
+    sum = vmlaq_n_s16(sum, G, c[1]);
+    sum = vmlaq_n_s16(sum, B, c[2]);
+
+    sum = vaddq_s16(vshrq_n_s16(sum, 8), vdupq_n_s16(128));
+    sum = vminq_s16(vmaxq_s16(sum, zero), max);
+
+    return vqmovun_s16(sum);
+}
+
+static void rgbaToVU_NEON(const uint32_t *src, uint8_t *dstVU, int width, const CSCCoeff &coeff) {
+    const int16x8_t zero = vdupq_n_s16((int16_t)coeff.zeroLvl);
+    const int16x8_t max = vdupq_n_s16((int16_t)coeff.maxLvlChroma);
+    const uint32x4_t mask = vdupq_n_u32(0xFF);
+
+    int x = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        /* val[0] has even pixels */
+        uint32x4_t lo = vld2q_u32(src + x).val[0];
+        uint32x4_t hi = vld2q_u32(src + x + 8).val[0];
+
+        int16x8_t R = vreinterpretq_s16_u16(vcombine_u16(vmovn_u32(vandq_u32(lo, mask)),
+                                                         vmovn_u32(vandq_u32(hi, mask))));
+        int16x8_t G = vreinterpretq_s16_u16(vcombine_u16(vmovn_u32(vandq_u32(vshrq_n_u32(lo, 8), mask)),
+                                                         vmovn_u32(vandq_u32(vshrq_n_u32(hi, 8), mask))));
+        int16x8_t B = vreinterpretq_s16_u16(vcombine_u16(vmovn_u32(vandq_u32(vshrq_n_u32(lo, 16), mask)),
+                                                         vmovn_u32(vandq_u32(vshrq_n_u32(hi, 16), mask))));
+
+        uint8x8x2_t VU;
+        VU.val[0] = chroma_NEON(R, G, B, coeff.V, zero, max);
+        VU.val[1] = chroma_NEON(R, G, B, coeff.U, zero, max);
+
+        vst2_u8(dstVU + x, VU);
+    }
+
+    rgbaToVU_C(src + x, dstVU + x, width - x, coeff);
+}
+
+static const CSCKernel kSimdKernel = {
+    "NEON",
+    narrow16to8_NEON,
+    deinterleave16to8_NEON,
+    rgbaToY_NEON,
+    rgbaToVU_NEON,
+};
+#elif defined(USE_CSC_SSE2)
+static void narrow16to8_SSE2(const uint16_t *src, uint8_t *dst, int width) {
+    int x = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        __m128i lo = _mm_srli_epi16(_mm_loadu_si128((const __m128i *)(src + x)), 8);
+        __m128i hi = _mm_srli_epi16(_mm_loadu_si128((const __m128i *)(src + x + 8)), 8);
+
+        _mm_storeu_si128((__m128i *)(dst + x), _mm_packus_epi16(lo, hi));
+    }
+
+    narrow16to8_C(src + x, dst + x, width - x);
+}
+
+static void deinterleave16to8_SSE2(const uint16_t *src, uint8_t *dst0, uint8_t *dst1, int width) {
+    const __m128i mask = _mm_set1_epi16(0x00FF);
+
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8) {
+        __m128i lo = _mm_srli_epi16(_mm_loadu_si128((const __m128i *)(src + (x * 2))), 8);
+        __m128i hi = _mm_srli_epi16(_mm_loadu_si128((const __m128i *)(src + (x * 2) + 8)), 8);
+
+        /* 0, 1, 0, 1, ... */
+        __m128i packed = _mm_packus_epi16(lo, hi);
+
+        __m128i even = _mm_and_si128(packed, mask);
+        __m128i odd  = _mm_srli_epi16(packed, 8);
+
+        _mm_storel_epi64((__m128i *)(dst0 + x), _mm_packus_epi16(even, even));
+        _mm_storel_epi64((__m128i *)(dst1 + x), _mm_packus_epi16(odd, odd));
+    }
+
+    deinterleave16to8_C(src + (x * 2), dst0 + x, dst1 + x, width - x);
+}
+
+static inline void splitRGB_SSE2(__m128i lo, __m128i hi, __m128i &R, __m128i &G, __m128i &B) {
+    const __m128i mask = _mm_set1_epi32(0xFF);
+
+    R = _mm_packs_epi32(_mm_and_si128(lo, mask), _mm_and_si128(hi, mask));
+    G = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(lo, 8), mask), _mm_and_si128(_mm_srli_epi32(hi, 8), mask));
+    B = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(lo, 16), mask), _mm_and_si128(_mm_srli_epi32(hi, 16), mask));
+}
+
+static void rgbaToY_SSE2(const uint32_t *src, uint8_t *dstY, int width, const CSCCoeff &coeff) {
+    const __m128i cr = _mm_set1_epi16(coeff.Y[0]);
+    const __m128i cg = _mm_set1_epi16(coeff.Y[1]);
+    const __m128i cb = _mm_set1_epi16(coeff.Y[2]);
+    const __m128i zero = _mm_set1_epi8((char)coeff.zeroLvl);
+    const __m128i max = _mm_set1_epi8((char)coeff.maxLvlLuma);
+
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8) {
+        __m128i R, G, B;
+
+        splitRGB_SSE2(_mm_loadu_si128((const __m128i *)(src + x)),
+                      _mm_loadu_si128((const __m128i *)(src + x + 4)), R, G, B);
+
+        /* unsigned 16bit : wrapping on mullo does not matter */
+        __m128i sum = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(R, cr), _mm_mullo_epi16(G, cg)),
+                                    _mm_mullo_epi16(B, cb));
+
+        __m128i Y = _mm_packus_epi16(_mm_srli_epi16(sum, 8), _mm_setzero_si128());
+        Y = _mm_adds_epu8(Y, zero);
+        Y = _mm_min_epu8(_mm_max_epu8(Y, zero), max);
+
+        _mm_storel_epi64((__m128i *)(dstY + x), Y);
+    }
+
+    rgbaToY_C(src + x, dstY + x, width - x, coeff);
+}
+
+static inline __m128i chroma_SSE2(__m128i R, __m128i G, __m128i B, const int16_t c[3],
+                                  __m128i zero, __m128i max) {
+    __m128i sum = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(R, _mm_set1_epi16(c[0])),
+                                              _mm_mullo_epi16(G, _mm_set1_epi16(c[1]))),
+                                _mm_mullo_epi16(B, _mm_set1_epi16(c[2])));
+
+    sum = _mm_add_epi16(_mm_srai_epi16(sum, 8), _mm_set1_epi16(128));
+
+    return _mm_min_epi16(_mm_max_epi16(sum, zero), max);
+}
+
+static void rgbaToVU_SSE2(const uint32_t *src, uint8_t *dstVU, int width, const CSCCoeff &coeff) {
+    const __m128i zero = _mm_set1_epi16((int16_t)coeff.zeroLvl);
+    const __m128i max = _mm_set1_epi16((int16_t)coeff.maxLvlChroma);
+
+    int x = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        /* pick even pixels */
+        __m128i p0 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(src + x)), _MM_SHUFFLE(3, 1, 2, 0));
+        __m128i p1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(src + x + 4)), _MM_SHUFFLE(3, 1, 2, 0));
+        __m128i p2 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(src + x + 8)), _MM_SHUFFLE(3, 1, 2, 0));
+        __m128i p3 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(src + x + 12)), _MM_SHUFFLE(3, 1, 2, 0));
+
+        __m128i R, G, B;
+
+        splitRGB_SSE2(_mm_unpacklo_epi64(p0, p1), _mm_unpacklo_epi64(p2, p3), R, G, B);
+
+        __m128i V = chroma_SSE2(R, G, B, coeff.V, zero, max);
+        __m128i U = chroma_SSE2(R, G, B, coeff.U, zero, max);
+
+        /* V, U, V, U, ... */
+        _mm_storeu_si128((__m128i *)(dstVU + x), _mm_or_si128(V, _mm_slli_epi16(U, 8)));
+    }
+
+    rgbaToVU_C(src + x, dstVU + x, width - x, coeff);
+}
+
+static const CSCKernel kSimdKernel = {
+    "SSE2",
+    narrow16to8_SSE2,
+    deinterleave16to8_SSE2,
+    rgbaToY_SSE2,
+    rgbaToVU_SSE2,
+};
+#endif
+
+const CSCKernel &GetCSCReferenceKernel() {
+    return kReferenceKernel;
+}
+
+std::vector<const CSCKernel *> GetCSCKernelList() {
+    std::vector<const CSCKernel *> list = { &kReferenceKernel };
+#if defined(USE_CSC_NEON) || defined(USE_CSC_SSE2)
+    list.push_back(&kSimdKernel);
+#endif
+
+    return list;
+}
+
+const CSCKernel &GetCSCKernel() {
+    static const CSCKernel &kernel = []() -> const CSCKernel & {
+#if defined(USE_CSC_NEON) || defined(USE_CSC_SSE2)
+        if (ExynosUtils::GetSWCSCSimdType()) {
+            StaticExynosLog(Level::Info, LOG_TAG, "[%s] kernel(%s)", __FUNCTION__, kSimdKernel.name);
+            return kSimdKernel;
+        }
+#endif
+        StaticExynosLog(Level::Info, LOG_TAG, "[%s] kernel(%s)", __FUNCTION__, kReferenceKernel.name);
+        return kReferenceKernel;
+    }();
+
+    return kernel;
+}
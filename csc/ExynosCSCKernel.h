@@ -0,0 +1,62 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EXYNOS_CSC_KERNEL_H
+#define EXYNOS_CSC_KERNEL_H
+
+#include <stdint.h>
+#include <vector>
+
+/*
+ * row kernels of SW CSC.
+ * all variants give the same result as the reference(C) one bit by bit.
+ */
+struct CSCCoeff {
+    int16_t Y[3];  /* R, G, B */
+    int16_t U[3];
+    int16_t V[3];
+
+    int zeroLvl;
+    int maxLvlLuma;
+    int maxLvlChroma;
+};
+
+struct CSCKernel {
+    const char *name;
+
+    /* dst[x] = MSB 8bit of src[x] */
+    void (*narrow16to8)(const uint16_t *src, uint8_t *dst, int width);
+
+    /* dst0[x] = MSB 8bit of src[2x], dst1[x] = MSB 8bit of src[2x + 1] */
+    void (*deinterleave16to8)(const uint16_t *src, uint8_t *dst0, uint8_t *dst1, int width);
+
+    /* Y of each RGBA pixel */
+    void (*rgbaToY)(const uint32_t *src, uint8_t *dstY, int width, const CSCCoeff &coeff);
+
+    /* VU pair of each even RGBA pixel, width is a number of pixels */
+    void (*rgbaToVU)(const uint32_t *src, uint8_t *dstVU, int width, const CSCCoeff &coeff);
+};
+
+/* the fastest kernel on running cpu, it is decided once */
+const CSCKernel &GetCSCKernel();
+
+/* C implementation to compare with */
+const CSCKernel &GetCSCReferenceKernel();
+
+/* every kernel built for this cpu regardless of the property, the reference one comes first */
+std::vector<const CSCKernel *> GetCSCKernelList();
+
+#endif // EXYNOS_CSC_KERNEL_H
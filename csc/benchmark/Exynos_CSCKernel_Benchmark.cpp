@@ -0,0 +1,159 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * benchmark of SW CSC row kernels.
+ * every kernel built for the cpu runs each row function over the same frame,
+ * and the time per pixel is reported with the ratio to the reference(C) kernel.
+ * the result is a line of json.
+ *
+ * usage : ExynosC2CSCKernelBenchmark [-w width] [-h height] [-n loops]
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+#include <unistd.h>
+
+#include "ExynosCSCKernel.h"
+
+#define BENCH_DEFAULT_WIDTH   1920
+#define BENCH_DEFAULT_HEIGHT  1080
+#define BENCH_DEFAULT_LOOPS   10
+
+using steady_clock = std::chrono::steady_clock;
+
+/* BT.709 limited range */
+static const CSCCoeff kCoeff = {
+    {  47,  157,  16 },
+    { -26,  -86, 112 },
+    { 112, -102, -10 },
+    16, 235, 240,
+};
+
+/* the best of loops, in ns per pixel */
+static double Measure(int32_t loops, int32_t width, int32_t height, const std::function<void(int32_t)> &row) {
+    double best = 0;
+
+    for (int32_t i = 0; i < loops; i++) {
+        auto start = steady_clock::now();
+
+        for (int32_t y = 0; y < height; y++) {
+            row(y);
+        }
+
+        double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(steady_clock::now() - start).count();
+        ns /= ((double)width * height);
+
+        if ((i == 0) || (ns < best)) {
+            best = ns;
+        }
+    }
+
+    return best;
+}
+
+static std::string ToString(double value) {
+    char buf[32];
+
+    snprintf(buf, sizeof(buf), "%.3f", value);
+    return buf;
+}
+
+static void Usage(const char *name) {
+    fprintf(stderr, "usage : %s [-w width] [-h height] [-n loops]\n", name);
+}
+
+int main(int argc, char **argv) {
+    int32_t width  = BENCH_DEFAULT_WIDTH;
+    int32_t height = BENCH_DEFAULT_HEIGHT;
+    int32_t loops  = BENCH_DEFAULT_LOOPS;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "w:h:n:")) != -1) {
+        switch (opt) {
+        case 'w': width  = atoi(optarg); break;
+        case 'h': height = atoi(optarg); break;
+        case 'n': loops  = atoi(optarg); break;
+        default:
+            Usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((width <= 0) || (height <= 0) || (loops <= 0)) {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    std::vector<uint16_t> src16((size_t)width * height * 2);
+    std::vector<uint32_t> src32((size_t)width * height);
+    std::vector<uint8_t>  dst0((size_t)width * height);
+    std::vector<uint8_t>  dst1((size_t)width * height);
+
+    for (size_t i = 0; i < src16.size(); i++) {
+        src16[i] = (uint16_t)(i * 2654435761u);
+    }
+
+    for (size_t i = 0; i < src32.size(); i++) {
+        src32[i] = (uint32_t)(i * 2654435761u);
+    }
+
+    const char *names[] = { "narrow16to8", "deinterleave16to8", "rgbaToY", "rgbaToVU" };
+    std::vector<double> reference(4, 0);
+
+    std::string report = "{\"width\":" + std::to_string(width) +
+                         ",\"height\":" + std::to_string(height) +
+                         ",\"selected\":\"" + GetCSCKernel().name + "\"" +
+                         ",\"kernels\":[";
+
+    auto list = GetCSCKernelList();
+    for (size_t k = 0; k < list.size(); k++) {
+        const CSCKernel &kernel = *list[k];
+        size_t w = width;
+
+        double results[4] = {
+            Measure(loops, width, height, [&](int32_t y) { kernel.narrow16to8(&src16[y * w], &dst0[y * w], width); }),
+            Measure(loops, width, height, [&](int32_t y) { kernel.deinterleave16to8(&src16[y * w * 2], &dst0[y * w], &dst1[y * w], width); }),
+            Measure(loops, width, height, [&](int32_t y) { kernel.rgbaToY(&src32[y * w], &dst0[y * w], width, kCoeff); }),
+            Measure(loops, width, height, [&](int32_t y) { kernel.rgbaToVU(&src32[y * w], &dst0[y * w], width, kCoeff); }),
+        };
+
+        report += std::string((k > 0)? ",":"") + "{\"name\":\"" + kernel.name + "\"";
+
+        for (int i = 0; i < 4; i++) {
+            if (k == 0) {
+                reference[i] = results[i];  /* the reference kernel comes first */
+            }
+
+            report += std::string(",\"") + names[i] + "\":{\"ns_per_pixel\":" + ToString(results[i]) +
+                      ",\"speedup\":" + ToString((results[i] > 0)? (reference[i] / results[i]):0) + "}";
+        }
+
+        report += "}";
+    }
+
+    report += "]}";
+
+    printf("%s\n", report.c_str());
+
+    return 0;
+}
@@ -0,0 +1,173 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ExynosCSCKernel.h"
+
+#define TEST_MAX_WIDTH  130   /* covers every tail of 8 and 16 lanes several times */
+#define TEST_GUARD      32    /* bytes after the row which must not be touched */
+#define TEST_GUARD_VAL  0xA5
+
+namespace {
+
+/* BT.601, BT.709 and BT.2020 in full and limited range, same as ExynosCSC */
+const int16_t kMatrices[6][9] = {
+    {  77,  150,  29, -43,  -85, 128, 128, -107, -21 },
+    {  66,  129,  25, -38,  -74, 112, 112,  -94, -18 },
+    {  54,  183,  19, -29,  -99, 128, 128, -116, -12 },
+    {  47,  157,  16, -26,  -86, 112, 112, -102, -10 },
+    {  67,  174,  15, -36,  -92, 128, 128, -118, -10 },
+    {  58,  149,  13, -31,  -79, 110, 110, -101,  -9 },
+};
+
+CSCCoeff MakeCoeff(int index) {
+    CSCCoeff coeff;
+    bool limited = ((index % 2) == 1);
+
+    memcpy(coeff.Y, &kMatrices[index][0], sizeof(coeff.Y));
+    memcpy(coeff.U, &kMatrices[index][3], sizeof(coeff.U));
+    memcpy(coeff.V, &kMatrices[index][6], sizeof(coeff.V));
+
+    coeff.zeroLvl      = limited? 16:0;
+    coeff.maxLvlLuma   = limited? 235:255;
+    coeff.maxLvlChroma = limited? 240:255;
+
+    return coeff;
+}
+
+/* random values mixed with extremes which hit the clipping */
+template<typename T>
+std::vector<T> MakeSource(size_t cnt, std::mt19937 &rng) {
+    std::vector<T> src(cnt);
+
+    for (size_t i = 0; i < cnt; i++) {
+        switch (rng() % 4) {
+        case 0:  src[i] = 0;              break;
+        case 1:  src[i] = (T)~((T)0);     break;
+        default: src[i] = (T)rng();       break;
+        }
+    }
+
+    return src;
+}
+
+std::vector<uint8_t> MakeDst(size_t cnt) {
+    return std::vector<uint8_t>(cnt + TEST_GUARD, TEST_GUARD_VAL);
+}
+
+class ExynosCSCKernelTest : public ::testing::TestWithParam<const CSCKernel *> {
+protected:
+    const CSCKernel &kernel() {
+        return *GetParam();
+    }
+
+    const CSCKernel &reference() {
+        return GetCSCReferenceKernel();
+    }
+
+    std::mt19937 mRng{1234};
+};
+
+}  // namespace
+
+TEST_P(ExynosCSCKernelTest, Narrow16to8) {
+    for (int width = 1; width <= TEST_MAX_WIDTH; width++) {
+        auto src = MakeSource<uint16_t>(width, mRng);
+        auto out = MakeDst(width);
+        auto ref = MakeDst(width);
+
+        kernel().narrow16to8(src.data(), out.data(), width);
+        reference().narrow16to8(src.data(), ref.data(), width);
+
+        ASSERT_EQ(ref, out) << "width " << width;
+    }
+}
+
+TEST_P(ExynosCSCKernelTest, Deinterleave16to8) {
+    for (int width = 1; width <= TEST_MAX_WIDTH; width++) {
+        auto src = MakeSource<uint16_t>(width * 2, mRng);
+        auto out0 = MakeDst(width), out1 = MakeDst(width);
+        auto ref0 = MakeDst(width), ref1 = MakeDst(width);
+
+        kernel().deinterleave16to8(src.data(), out0.data(), out1.data(), width);
+        reference().deinterleave16to8(src.data(), ref0.data(), ref1.data(), width);
+
+        ASSERT_EQ(ref0, out0) << "width " << width;
+        ASSERT_EQ(ref1, out1) << "width " << width;
+    }
+}
+
+TEST_P(ExynosCSCKernelTest, RgbaToY) {
+    for (int matrix = 0; matrix < 6; matrix++) {
+        CSCCoeff coeff = MakeCoeff(matrix);
+
+        for (int width = 1; width <= TEST_MAX_WIDTH; width++) {
+            auto src = MakeSource<uint32_t>(width, mRng);
+            auto out = MakeDst(width);
+            auto ref = MakeDst(width);
+
+            kernel().rgbaToY(src.data(), out.data(), width, coeff);
+            reference().rgbaToY(src.data(), ref.data(), width, coeff);
+
+            ASSERT_EQ(ref, out) << "matrix " << matrix << " width " << width;
+        }
+    }
+}
+
+TEST_P(ExynosCSCKernelTest, RgbaToVU) {
+    for (int matrix = 0; matrix < 6; matrix++) {
+        CSCCoeff coeff = MakeCoeff(matrix);
+
+        for (int width = 1; width <= TEST_MAX_WIDTH; width++) {
+            /* a pair of VU per two pixels, an odd width has the last one alone */
+            size_t vuSize = ((width + 1) / 2) * 2;
+
+            auto src = MakeSource<uint32_t>(width, mRng);
+            auto out = MakeDst(vuSize);
+            auto ref = MakeDst(vuSize);
+
+            kernel().rgbaToVU(src.data(), out.data(), width, coeff);
+            reference().rgbaToVU(src.data(), ref.data(), width, coeff);
+
+            ASSERT_EQ(ref, out) << "matrix " << matrix << " width " << width;
+        }
+    }
+}
+
+TEST(ExynosCSCKernelListTest, ReferenceComesFirst) {
+    auto list = GetCSCKernelList();
+
+    ASSERT_FALSE(list.empty());
+    EXPECT_EQ(&GetCSCReferenceKernel(), list.front());
+
+    /* the selected one is always in the list */
+    bool found = false;
+    for (auto kernel : list) {
+        found |= (kernel == &GetCSCKernel());
+    }
+    EXPECT_TRUE(found);
+}
+
+INSTANTIATE_TEST_SUITE_P(AllKernels, ExynosCSCKernelTest, ::testing::ValuesIn(GetCSCKernelList()),
+                         [](const ::testing::TestParamInfo<const CSCKernel *> &info) {
+                             return std::string(info.param->name);
+                         });
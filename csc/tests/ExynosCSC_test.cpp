@@ -0,0 +1,450 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <system/graphics.h>
+#include "exynos_format.h"
+
+#include "ExynosBuffer.h"
+#include "ExynosCSC.h"
+
+#define TEST_ALLOC_WIDTH   64
+#define TEST_ALLOC_HEIGHT  40    /* not aligned to HW_HEIGHT_ALIGN, so vstride of some formats differs */
+#define TEST_GUARD_VAL     0xA5
+#define TEST_THREAD_CNT    3
+#define TEST_STRIPE_HEIGHT 4     /* small enough to have many stripes */
+
+namespace {
+
+/* a GRAPHIC buffer on memfd, it stands for a gralloc buffer */
+class MemFdBuffer : public ExynosBuffer {
+public:
+    MemFdBuffer(uint32_t width, uint32_t height, uint32_t format) {
+        mDataType = GRAPHIC;
+        mWidth    = width;
+        mHeight   = height;
+        mFormat   = format;
+
+        /* gralloc aligns the height of these formats as ExynosUtils does */
+        bool aligned = ((format == HAL_PIXEL_FORMAT_YCBCR_P010) ||
+                        (format == HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_SPN));
+        mVStride = aligned? ALIGN(height, HW_HEIGHT_ALIGN):height;
+
+        unsigned int size[BASE_BUFFER_MAX_PLANES] = { 0, };
+        ExynosUtils::GetYUVPlaneInfo(width, height, format, mPlaneCnt, size, 0);
+
+        mHandle = native_handle_create(mPlaneCnt, 0);
+
+        for (int i = 0; i < mPlaneCnt; i++) {
+            int fd = memfd_create("ExynosCSCTest", MFD_CLOEXEC);
+            EXPECT_EQ(0, ftruncate(fd, size[i]));
+
+            mHandle->data[i] = fd;
+            mPlaneSize[i]    = size[i];
+            mPlaneAddr[i]    = (uint8_t *)mmap(nullptr, size[i], PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+    }
+
+    ~MemFdBuffer() {
+        unmap();
+        invalidateMapping();  /* inode of memfd can be reused after close */
+
+        for (int i = 0; i < mPlaneCnt; i++) {
+            munmap(mPlaneAddr[i], mPlaneSize[i]);
+            close(mHandle->data[i]);
+        }
+
+        native_handle_delete(mHandle);
+        mHandle = nullptr;
+    }
+
+    int vstride() override {
+        return mVStride;
+    }
+
+    int planeCnt() {
+        return mPlaneCnt;
+    }
+
+    uint8_t *addr(int plane) {
+        return mPlaneAddr[plane];
+    }
+
+    void fill(std::mt19937 &rng) {
+        for (int i = 0; i < mPlaneCnt; i++) {
+            for (uint32_t j = 0; j < mPlaneSize[i]; j++) {
+                mPlaneAddr[i][j] = (uint8_t)rng();
+            }
+        }
+    }
+
+    void fill(uint8_t value) {
+        for (int i = 0; i < mPlaneCnt; i++) {
+            memset(mPlaneAddr[i], value, mPlaneSize[i]);
+        }
+    }
+
+    std::vector<uint8_t> contents() {
+        std::vector<uint8_t> data;
+
+        for (int i = 0; i < mPlaneCnt; i++) {
+            data.insert(data.end(), mPlaneAddr[i], mPlaneAddr[i] + mPlaneSize[i]);
+        }
+
+        return data;
+    }
+
+private:
+    int mVStride = 0;
+    int mPlaneCnt = 0;
+    uint8_t *mPlaneAddr[BASE_BUFFER_MAX_PLANES] = { nullptr, };
+    uint32_t mPlaneSize[BASE_BUFFER_MAX_PLANES] = { 0, };
+};
+
+/* where Y, Cb and Cr samples of a format are, independent from ExynosCSC */
+struct Layout {
+    uint8_t *y  = nullptr;
+    uint8_t *cb = nullptr;
+    uint8_t *cr = nullptr;
+    int yStride = 0;  /* bytes */
+    int cStride = 0;  /* bytes */
+    int cStep   = 1;  /* samples between chroma of neighbours */
+    int bytes   = 1;  /* per sample */
+
+    uint32_t sample(uint8_t *base, int stride, int step, int x, int y) const {
+        uint8_t *p = base + (stride * y) + (step * bytes * x);
+        return (bytes == 2)? *(uint16_t *)p:*p;
+    }
+
+    uint32_t Y(int x, int y) const  { return sample(this->y, yStride, 1, x, y); }
+    uint32_t Cb(int x, int y) const { return sample(cb, cStride, cStep, x, y); }
+    uint32_t Cr(int x, int y) const { return sample(cr, cStride, cStep, x, y); }
+};
+
+Layout MakeLayout(MemFdBuffer &buffer, int stride) {
+    Layout layout;
+    int height  = buffer.height();
+    int vstride = buffer.vstride();
+
+    layout.y       = buffer.addr(0);
+    layout.yStride = stride;
+
+    switch (buffer.format()) {
+    case HAL_PIXEL_FORMAT_YV12:
+        layout.cStride = ALIGN(stride / 2, 16);
+        layout.cr      = buffer.addr(0) + (stride * height);
+        layout.cb      = layout.cr + (layout.cStride * (height / 2));
+        break;
+    case HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_P:
+        layout.cStride = ALIGN(stride / 2, 16);
+        layout.cb      = buffer.addr(0) + (stride * height);
+        layout.cr      = layout.cb + (layout.cStride * (height / 2));
+        break;
+    case HAL_PIXEL_FORMAT_EXYNOS_YV12_M:
+        layout.cStride = ALIGN(stride / 2, HW_WIDTH_ALIGN);
+        layout.cr      = buffer.addr(1);
+        layout.cb      = buffer.addr(2);
+        break;
+    case HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_P_M:
+        layout.cStride = ALIGN(stride / 2, HW_WIDTH_ALIGN);
+        layout.cb      = buffer.addr(1);
+        layout.cr      = buffer.addr(2);
+        break;
+    case HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_SP:
+        [[fallthrough]];
+    case HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_SPN:
+        layout.cStride = stride;
+        layout.cStep   = 2;
+        layout.cb      = buffer.addr(0) + (stride * vstride);
+        layout.cr      = layout.cb + 1;
+        break;
+    case HAL_PIXEL_FORMAT_YCrCb_420_SP:
+        layout.cStride = stride;
+        layout.cStep   = 2;
+        layout.cr      = buffer.addr(0) + (stride * vstride);
+        layout.cb      = layout.cr + 1;
+        break;
+    case HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_SP_M:
+        layout.cStride = stride;
+        layout.cStep   = 2;
+        layout.cb      = buffer.addr(1);
+        layout.cr      = layout.cb + 1;
+        break;
+    case HAL_PIXEL_FORMAT_EXYNOS_YCrCb_420_SP_M:
+        layout.cStride = stride;
+        layout.cStep   = 2;
+        layout.cr      = buffer.addr(1);
+        layout.cb      = layout.cr + 1;
+        break;
+    case HAL_PIXEL_FORMAT_YCBCR_P010:
+        layout.bytes   = 2;
+        layout.yStride = stride * 2;
+        layout.cStride = stride * 2;
+        layout.cStep   = 2;
+        layout.cb      = buffer.addr(0) + (stride * 2 * vstride);
+        layout.cr      = layout.cb + 2;
+        break;
+    case HAL_PIXEL_FORMAT_EXYNOS_YCbCr_P010_M:
+        layout.bytes   = 2;
+        layout.yStride = stride * 2;
+        layout.cStride = stride * 2;
+        layout.cStep   = 2;
+        layout.cb      = buffer.addr(1);
+        layout.cr      = layout.cb + 2;
+        break;
+    default:
+        break;
+    }
+
+    return layout;
+}
+
+ExynosBufferInfo MakeInfo(std::shared_ptr<MemFdBuffer> buffer, int stride, int cropWidth, int cropHeight, uint32_t dataspace) {
+    ExynosBufferInfo info;
+    ExynosBufferInfo::reset(info);
+
+    info.obj    = buffer;
+    info.nPlane = buffer->planeCnt();
+
+    info.stImageInfo.nWidth              = buffer->width();
+    info.stImageInfo.nHeight             = buffer->height();
+    info.stImageInfo.nStride             = stride;
+    info.stImageInfo.nFormat             = buffer->format();
+    info.stImageInfo.stCropInfo.nWidth   = cropWidth;
+    info.stImageInfo.stCropInfo.nHeight  = cropHeight;
+    info.stImageInfo.nDataSpace          = dataspace;
+
+    return info;
+}
+
+struct ConvEntry {
+    uint32_t srcFormat;
+    uint32_t dstFormat;
+    const char *name;
+};
+
+void PrintTo(const ConvEntry &entry, std::ostream *os) {
+    *os << entry.name;
+}
+
+/* every entry of SW_CONV_INFO_TABLE */
+const ConvEntry kConvEntries[] = {
+    { HAL_PIXEL_FORMAT_EXYNOS_YV12_M,       HAL_PIXEL_FORMAT_YV12,                   "YV12M_to_YV12" },
+    { HAL_PIXEL_FORMAT_EXYNOS_YCbCr_P010_M, HAL_PIXEL_FORMAT_YCBCR_P010,             "P010M_to_P010" },
+    { HAL_PIXEL_FORMAT_EXYNOS_YCbCr_P010_M, HAL_PIXEL_FORMAT_YV12,                   "P010M_to_YV12" },
+    { HAL_PIXEL_FORMAT_EXYNOS_YCbCr_P010_M, HAL_PIXEL_FORMAT_EXYNOS_YV12_M,          "P010M_to_YV12M" },
+    { HAL_PIXEL_FORMAT_YV12,                HAL_PIXEL_FORMAT_EXYNOS_YV12_M,          "YV12_to_YV12M" },
+    { HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_P,  HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_P_M,   "420P_to_420PM" },
+    { HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_SP, HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_SP_M,  "420SP_to_420SPM" },
+    { HAL_PIXEL_FORMAT_YCrCb_420_SP,        HAL_PIXEL_FORMAT_EXYNOS_YCrCb_420_SP_M,  "NV21_to_NV21M" },
+    { HAL_PIXEL_FORMAT_YCBCR_P010,          HAL_PIXEL_FORMAT_EXYNOS_YCbCr_P010_M,    "P010_to_P010M" },
+    { HAL_PIXEL_FORMAT_YCBCR_P010,          HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_SP_M,  "P010_to_NV12M" },
+    { HAL_PIXEL_FORMAT_YCBCR_P010,          HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_SPN,   "P010_to_NV12N" },
+    { HAL_PIXEL_FORMAT_RGBA_8888,           HAL_PIXEL_FORMAT_EXYNOS_YCrCb_420_SP_M,  "RGBA_to_NV21M" },
+};
+
+/* odd ones have the last chroma sample for a single pixel */
+const std::pair<int, int> kCropSizes[] = {
+    { TEST_ALLOC_WIDTH, TEST_ALLOC_HEIGHT },
+    { TEST_ALLOC_WIDTH - 1, TEST_ALLOC_HEIGHT - 1 },
+    { 1, 1 },
+    { 2, 3 },
+    { 17, 33 },
+    { 33, 1 },
+    { 1, 35 },
+};
+
+/* BT.601, BT.709 and BT.2020 in full and limited range, same as Codec2BufferUtils */
+struct RGBMatrix {
+    uint32_t dataspace;
+    int coeff[9];
+    bool limited;
+};
+
+const RGBMatrix kRGBMatrices[] = {
+    { HAL_DATASPACE_STANDARD_BT601_625 | HAL_DATASPACE_RANGE_FULL,    {  77,  150,  29, -43, -85, 128, 128, -107, -21 }, false },
+    { HAL_DATASPACE_STANDARD_BT601_625 | HAL_DATASPACE_RANGE_LIMITED, {  66,  129,  25, -38, -74, 112, 112,  -94, -18 }, true  },
+    { HAL_DATASPACE_STANDARD_BT709 | HAL_DATASPACE_RANGE_FULL,        {  54,  183,  19, -29, -99, 128, 128, -116, -12 }, false },
+    { HAL_DATASPACE_STANDARD_BT709 | HAL_DATASPACE_RANGE_LIMITED,     {  47,  157,  16, -26, -86, 112, 112, -102, -10 }, true  },
+    { HAL_DATASPACE_STANDARD_BT2020 | HAL_DATASPACE_RANGE_FULL,       {  67,  174,  15, -36, -92, 128, 128, -118, -10 }, false },
+    { HAL_DATASPACE_STANDARD_BT2020 | HAL_DATASPACE_RANGE_LIMITED,    {  58,  149,  13, -31, -79, 110, 110, -101,  -9 }, true  },
+};
+
+int Clip(int v, int min, int max) {
+    return (v < min)? min:((v > max)? max:v);
+}
+
+class ExynosCSCTest : public ::testing::TestWithParam<ConvEntry> {
+protected:
+    /* stride of output is wider in some cases to take the row by row path */
+    void run(int cropWidth, int cropHeight, bool widerOutput, uint32_t dataspace,
+             const std::function<void(MemFdBuffer &, MemFdBuffer &, int, int)> &check) {
+        const ConvEntry &entry = GetParam();
+
+        int srcStride = TEST_ALLOC_WIDTH;
+        int dstStride = TEST_ALLOC_WIDTH + (widerOutput? 16:0);
+
+        auto src = std::make_shared<MemFdBuffer>(srcStride, TEST_ALLOC_HEIGHT, entry.srcFormat);
+        src->fill(mRng);
+
+        std::vector<uint8_t> single;
+
+        for (uint32_t threads : { 1, TEST_THREAD_CNT }) {
+            SCOPED_TRACE("crop " + std::to_string(cropWidth) + "x" + std::to_string(cropHeight) +
+                         ", dst stride " + std::to_string(dstStride) + ", threads " + std::to_string(threads));
+
+            auto dst = std::make_shared<MemFdBuffer>(dstStride, TEST_ALLOC_HEIGHT, entry.dstFormat);
+            dst->fill((uint8_t)TEST_GUARD_VAL);
+
+            ExynosBufferInfo input  = MakeInfo(src, srcStride, cropWidth, cropHeight, dataspace);
+            ExynosBufferInfo output = MakeInfo(dst, dstStride, cropWidth, cropHeight, dataspace);
+
+            ExynosCSC csc("ExynosCSCTest", ExynosCSC::Type::SW);
+            csc.setThreadInfo(threads, TEST_STRIPE_HEIGHT);
+
+            ASSERT_TRUE(csc.process(input, output));
+
+            check(*src, *dst, srcStride, dstStride);
+
+            /* stripes give the same result as a single thread */
+            if (threads == 1) {
+                single = dst->contents();
+            } else {
+                EXPECT_TRUE(single == dst->contents());
+            }
+        }
+    }
+
+    void testYUVToYUV();
+    void testRGBToYUV();
+
+    std::mt19937 mRng{5678};
+};
+
+}  // namespace
+
+void ExynosCSCTest::testYUVToYUV() {
+    const ConvEntry &entry = GetParam();
+
+    /* 10bit is narrowed to MSB 8bit when the output is 8bit */
+    bool narrow = ((entry.srcFormat == HAL_PIXEL_FORMAT_EXYNOS_YCbCr_P010_M) ||
+                   (entry.srcFormat == HAL_PIXEL_FORMAT_YCBCR_P010)) &&
+                  ((entry.dstFormat != HAL_PIXEL_FORMAT_EXYNOS_YCbCr_P010_M) &&
+                   (entry.dstFormat != HAL_PIXEL_FORMAT_YCBCR_P010));
+
+    for (auto &crop : kCropSizes) {
+        for (bool widerOutput : { false, true }) {
+            int cropWidth = crop.first, cropHeight = crop.second;
+
+            run(cropWidth, cropHeight, widerOutput, 0,
+                [&](MemFdBuffer &src, MemFdBuffer &dst, int srcStride, int dstStride) {
+                    Layout in  = MakeLayout(src, srcStride);
+                    Layout out = MakeLayout(dst, dstStride);
+
+                    auto expected = [&](uint32_t value) { return narrow? (value >> 8):value; };
+
+                    for (int y = 0; y < cropHeight; y++) {
+                        for (int x = 0; x < cropWidth; x++) {
+                            ASSERT_EQ(expected(in.Y(x, y)), out.Y(x, y)) << "Y(" << x << ", " << y << ")";
+                        }
+                    }
+
+                    for (int y = 0; y < ((cropHeight + 1) / 2); y++) {
+                        for (int x = 0; x < ((cropWidth + 1) / 2); x++) {
+                            ASSERT_EQ(expected(in.Cb(x, y)), out.Cb(x, y)) << "Cb(" << x << ", " << y << ")";
+                            ASSERT_EQ(expected(in.Cr(x, y)), out.Cr(x, y)) << "Cr(" << x << ", " << y << ")";
+                        }
+                    }
+                });
+        }
+    }
+}
+
+void ExynosCSCTest::testRGBToYUV() {
+    for (auto &matrix : kRGBMatrices) {
+        const int *c = matrix.coeff;
+        int zeroLvl      = matrix.limited? 16:0;
+        int maxLvlLuma   = matrix.limited? 235:255;
+        int maxLvlChroma = matrix.limited? 240:255;
+
+        for (auto &crop : kCropSizes) {
+            int cropWidth = crop.first, cropHeight = crop.second;
+
+            run(cropWidth, cropHeight, false, matrix.dataspace,
+                [&](MemFdBuffer &src, MemFdBuffer &dst, int srcStride, int dstStride) {
+                    Layout out = MakeLayout(dst, dstStride);
+
+                    auto rgb = [&](int x, int y, int i) {
+                        return (int)src.addr(0)[(((y * srcStride) + x) * 4) + i];
+                    };
+
+                    for (int y = 0; y < cropHeight; y++) {
+                        for (int x = 0; x < cropWidth; x++) {
+                            int R = rgb(x, y, 0), G = rgb(x, y, 1), B = rgb(x, y, 2);
+                            int Y = Clip((((c[0] * R) + (c[1] * G) + (c[2] * B)) >> 8) + zeroLvl, zeroLvl, maxLvlLuma);
+
+                            ASSERT_EQ((uint32_t)Y, out.Y(x, y)) << "Y(" << x << ", " << y << ")";
+                        }
+                    }
+
+                    /* chroma is taken from the top-left pixel of each 2x2 block */
+                    for (int y = 0; y < ((cropHeight + 1) / 2); y++) {
+                        for (int x = 0; x < ((cropWidth + 1) / 2); x++) {
+                            int R = rgb(x * 2, y * 2, 0), G = rgb(x * 2, y * 2, 1), B = rgb(x * 2, y * 2, 2);
+                            int U = Clip((((c[3] * R) + (c[4] * G) + (c[5] * B)) >> 8) + 128, zeroLvl, maxLvlChroma);
+                            int V = Clip((((c[6] * R) + (c[7] * G) + (c[8] * B)) >> 8) + 128, zeroLvl, maxLvlChroma);
+
+                            ASSERT_EQ((uint32_t)U, out.Cb(x, y)) << "U(" << x << ", " << y << ")";
+                            ASSERT_EQ((uint32_t)V, out.Cr(x, y)) << "V(" << x << ", " << y << ")";
+                        }
+                    }
+                });
+        }
+    }
+}
+
+TEST_P(ExynosCSCTest, OddSizesAndStrides) {
+    if (GetParam().srcFormat == HAL_PIXEL_FORMAT_RGBA_8888) {
+        testRGBToYUV();
+    } else {
+        testYUVToYUV();
+    }
+}
+
+TEST(ExynosCSCTableTest, UnsupportedConversionFails) {
+    auto src = std::make_shared<MemFdBuffer>(TEST_ALLOC_WIDTH, TEST_ALLOC_HEIGHT, HAL_PIXEL_FORMAT_YV12);
+    auto dst = std::make_shared<MemFdBuffer>(TEST_ALLOC_WIDTH, TEST_ALLOC_HEIGHT, HAL_PIXEL_FORMAT_YCBCR_P010);
+
+    ExynosBufferInfo input  = MakeInfo(src, TEST_ALLOC_WIDTH, TEST_ALLOC_WIDTH, TEST_ALLOC_HEIGHT, 0);
+    ExynosBufferInfo output = MakeInfo(dst, TEST_ALLOC_WIDTH, TEST_ALLOC_WIDTH, TEST_ALLOC_HEIGHT, 0);
+
+    ExynosCSC csc("ExynosCSCTest", ExynosCSC::Type::SW);
+    EXPECT_FALSE(csc.process(input, output));
+}
+
+INSTANTIATE_TEST_SUITE_P(AllEntries, ExynosCSCTest, ::testing::ValuesIn(kConvEntries),
+                         [](const ::testing::TestParamInfo<ConvEntry> &info) {
+                             return std::string(info.param.name);
+                         });
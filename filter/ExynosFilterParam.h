@@ -19,7 +19,6 @@
 
 #include <list>
 #include <string>
-#include <map>
 #include <memory>
 
 #include "ExynosDef.h"
@@ -61,11 +60,11 @@ template<typename T>
 class ExynosFilterParam : public ExynosFilterParamBase {
 public:
     ExynosFilterParam() : mTargetFilter(0) {
-        mBase = std::static_pointer_cast<ExynosParamBase>(std::make_shared<ExynosParam<T>>());
+        mBase = std::static_pointer_cast<ExynosParamBase>(MakePooledShared<ExynosParam<T>>());
     }
 
     ExynosFilterParam(const std::shared_ptr<ExynosParam<T>> obj) : mTargetFilter(0) {
-        mBase = std::static_pointer_cast<ExynosParamBase>(std::make_shared<ExynosParam<T>>(*obj.get()));
+        mBase = std::static_pointer_cast<ExynosParamBase>(MakePooledShared<ExynosParam<T>>(*obj.get()));
     }
 
     ~ExynosFilterParam() {
@@ -110,6 +109,9 @@ public:
         mFilterParams.clear();
     }
 
+    ExynosFilterParams(const ExynosFilterParams &rhs) = default;
+    ExynosFilterParams(ExynosFilterParams &&rhs) noexcept = default;
+
     ExynosFilterParams& operator=(const ExynosFilterParams &rhs) {
         this->mParams = rhs.mParams;
         this->mFilterParams = rhs.mFilterParams;
@@ -117,10 +119,20 @@ public:
         return *this;
     }
 
+    ExynosFilterParams& operator=(ExynosFilterParams &&rhs) noexcept {
+        this->mParams = std::move(rhs.mParams);
+        this->mFilterParams = std::move(rhs.mFilterParams);
+
+        return *this;
+    }
+
+    /* params appended take precedence over own params on the same index */
     void append(std::shared_ptr<ExynosFilterParams> params) {
         if (params.get() != nullptr) {
+            mFilterParams.merge(params->mFilterParams);
+
             for (auto it = params->mFilterParams.begin(); it != params->mFilterParams.end(); it++) {
-                addParam(it->second);
+                ExynosParams::addParam(it->second->getBaseParam());
             }
         }
     }
@@ -206,7 +218,9 @@ public:
     }
 
 private:
-    std::map<ParamIndex, std::shared_ptr<ExynosFilterParamBase>> mFilterParams;
+    using FilterParamMap = ExynosFlatMap<ParamIndex, std::shared_ptr<ExynosFilterParamBase>>;
+
+    FilterParamMap mFilterParams;
 };
 
 #endif // EXYNOS_FILTER_PARAM_H
@@ -20,6 +20,8 @@
 #include "ExynosLog.h"
 #define LOG_TAG "ExynosFilter"
 
+#define ALLOC_WAIT_WARN_TIME 3000  /* ms */
+
 bool ExynosFilterBase::setNext(std::shared_ptr<ExynosFilter> nextFilter) {
     ExynosLogFunctionTrace();
 
@@ -113,6 +115,11 @@ bool ExynosFilterBase::start() {
         return false;
     }
 
+    mStatEnabled = ExynosUtils::GetStageStatEnable();
+    if (mStatEnabled) {
+        mStat.reset();
+    }
+
     {
         auto err = shThreadPool->post(std::string("ExynosFilter::doStart"),
                                       weak_pointer_bind(false, &ExynosFilterBase::doStart, weak_from_this()));
@@ -175,6 +182,11 @@ bool ExynosFilterBase::stop() {
         }
     }
 
+    if (mStatEnabled && (mStat.getFrameCnt() > 0)) {
+        ExynosLogI("[%s] stat %s", __FUNCTION__, mStat.report(mObjName).c_str());
+        mStat.reset();
+    }
+
     if (ret) {
         std::shared_ptr<ExynosFilter> shNextFilter = GET_SHARED_PTR_NOLOG(mNextFilter);
 
@@ -343,7 +355,7 @@ bool ExynosFilterBase::release() {
     return ret;
 }
 
-bool ExynosFilterBase::processDone(ExynosBufferInfo input, ExynosBufferInfo output) {
+bool ExynosFilterBase::processDone(ExynosBufferInfo &input, ExynosBufferInfo &output) {
     ExynosLogFunctionTrace();
 
     if (input.obj.get() == nullptr) {
@@ -385,6 +397,8 @@ bool ExynosFilterBase::processDone(ExynosBufferInfo input, ExynosBufferInfo outp
         (workInfo->inDataNum > workInfo->outDataNum)) {
         reuseWorkInfo(workInfo);
     } else {
+        updateStat(workInfo);
+
         /* delegation about doWorkDone could not be procced
          * if buffer allocation is failed continuously
          * so, it must be called directly
@@ -436,19 +450,8 @@ std::shared_ptr<ExynosFilterBase::FilterWorkInfo> ExynosFilterBase::obtainWorkIn
         return workInfo;
     }
 
-    /* find workInfo which has a buffer same as inbuffer */
-    auto condfunc = [inbuffer](std::shared_ptr<FilterWorkInfo> elment)->bool {
-                        for (auto &buffer : elment->work->buffers) {
-                            if (buffer.get() == inbuffer.get()) {
-                                return true;
-                            }
-                        }
-
-                        return false;
-                    };
-
-    /* get workInfo and set outbuffer, if outbuffer is valid */
-    if (mWorkInfos.dequeue(workInfo, std::move(condfunc))) {
+    /* get workInfo which has a buffer same as inbuffer and set outbuffer, if outbuffer is valid */
+    if (mWorkInfos.dequeue(workInfo, inbuffer.get())) {
         if (CHECK_SHARED_PTR_NOLOG(workInfo)) {
             if (CHECK_SHARED_PTR_NOLOG(outbuffer)) {
                 {
@@ -495,7 +498,7 @@ std::shared_ptr<ExynosFilterBase::FilterWorkInfo> ExynosFilterBase::obtainWorkIn
                         std::lock_guard<std::mutex> lock(mPendingParamsMutex);
 
                         if (!CHECK_SHARED_PTR_NOLOG(mPendingParams)) {
-                            mPendingParams = std::make_shared<ExynosFilterParams>();
+                            mPendingParams = MakePooledShared<ExynosFilterParams>();
                         }
 
                         mPendingParams->append(std::static_pointer_cast<ExynosFilterParams>(inbuffer->mParams));
@@ -571,6 +574,8 @@ bool ExynosFilterBase::bypassBuffer(std::shared_ptr<ExynosBuffer> buffer) {
         workInfo->work->buffers.pop_back();
     }
 
+    updateStat(workInfo);
+
     /* delegation about doWorkDone could not be procced
      * if buffer allocation is failed continuously
      * so, it must be called directly
@@ -578,36 +583,81 @@ bool ExynosFilterBase::bypassBuffer(std::shared_ptr<ExynosBuffer> buffer) {
     return doWorkDone(std::move(workInfo->work));
 }
 
-std::optional<std::shared_ptr<ExynosBuffer>> ExynosFilterBase::allocBuffer(AllocArg arg) {
+void ExynosFilterBase::updateStat(std::shared_ptr<FilterWorkInfo> workInfo) {
+    if (!mStatEnabled) {
+        return;
+    }
+
+    /* latency from queueing a work to this filter until it is done */
+    mStat.addLatency(workInfo->queuedTime);
+}
+
+BufferAllocRetType ExynosFilterBase::allocBuffer(AllocArg arg) {
     ExynosLogFunctionTrace();
 
     auto allocator = GET_SHARED_PTR(mFnBufferAlloc);
     if (allocator == nullptr) {
-        return std::nullopt;
+        return { EXYNOS_ERROR_BAD_STATE, nullptr };
     }
 
-    /* allocate a buffer */
-    std::shared_ptr<ExynosBuffer> buffer = nullptr;
+    /* allocator waits for a buffer to be released up to arg.waitTime on each try.
+     * the waiting time is doubled on every failure in case that a release is not notified.
+     * the consumer could hold buffers for a while(ex, pause), but a buffer which is never
+     * returned must not stall the filter thread, so it gives up after the timeout.
+     */
+    auto startTime = std::chrono::steady_clock::now();
+    auto warnTime  = startTime + std::chrono::milliseconds(ALLOC_WAIT_WARN_TIME);
+    auto deadline  = startTime + std::chrono::milliseconds(ExynosUtils::GetAllocWaitTimeout());
+    int  retryCnt  = 0;
+
+    BufferAllocRetType ret = { EXYNOS_ERROR_BAD_STATE, nullptr };  /* quit */
+
+    arg.waitTime = ALLOC_WAIT_MIN_TIME;
 
     while (!mQuitWork) {
-        auto ret = (*allocator)(arg);
-        if (ret.first == EXYNOS_ERROR_TRY_AGAIN) {
-            continue;
+        ret = (*allocator)(arg);
+        if (ret.first != EXYNOS_ERROR_TRY_AGAIN) {
+            break;
         }
 
-        buffer = ret.second;
-        break;
+        auto curTime = std::chrono::steady_clock::now();
+        auto waited  = (long long)std::chrono::duration_cast<std::chrono::milliseconds>(curTime - startTime).count();
+
+        if (curTime >= deadline) {
+            ExynosLogE("[%s] there is no available buffer for %lld ms, give up", __FUNCTION__, waited);
+            ret = { EXYNOS_ERROR_TIMED_OUT, nullptr };
+            break;
+        }
+
+        if (curTime > warnTime) {
+            ExynosLogW("[%s] there is no available buffer for %lld ms", __FUNCTION__, waited);
+            warnTime = curTime + std::chrono::milliseconds(ALLOC_WAIT_WARN_TIME);
+        }
+
+        arg.waitTime = MIN(arg.waitTime * 2, ALLOC_WAIT_MAX_TIME);
+        retryCnt++;
     }
 
-    if (buffer.get() == nullptr) {
-        if (!mQuitWork) {
-            ExynosLogE("[%s] buffer allocation is failed", __FUNCTION__);
+    if ((ret.first == EXYNOS_ERROR_NONE) &&
+        (ret.second.get() == nullptr)) {
+        ret.first = EXYNOS_ERROR_UNKNOWN;
+    }
+
+    if (ret.first != EXYNOS_ERROR_NONE) {
+        if ((!mQuitWork) &&
+            (ret.first != EXYNOS_ERROR_TIMED_OUT)) {
+            ExynosLogE("[%s] buffer allocation is failed(%d)", __FUNCTION__, ret.first);
         }
 
-        return std::nullopt;
+        return { ret.first, nullptr };
+    }
+
+    if (retryCnt > 0) {
+        ExynosLogT("[%s] buffer is allocated after %d retries, waited %lld us", __FUNCTION__, retryCnt,
+                    (long long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count());
     }
 
-    return { buffer };
+    return ret;
 }
 
 bool ExynosFilterBase::doQueueWork(std::shared_ptr<std::unique_ptr<FilterWork>> shWork) {
@@ -636,7 +686,13 @@ bool ExynosFilterBase::doQueueWork(std::shared_ptr<std::unique_ptr<FilterWork>>
         return false;
     }
 
-    auto workInfo = std::make_shared<FilterWorkInfo>((bufferCount - work->inputIndex), 0, std::move(work));
+    auto workInfo = MakePooledShared<FilterWorkInfo>((bufferCount - work->inputIndex), 0, std::move(work));
+
+    int64_t cpuTime = 0;
+    if (mStatEnabled) {
+        workInfo->queuedTime = steady_clock::now();
+        cpuTime = ExynosStageStat::getThreadCpuTime();
+    }
 
     /* save workInfo */
     mWorkInfos.enqueue(workInfo);
@@ -665,24 +721,107 @@ bool ExynosFilterBase::doQueueWork(std::shared_ptr<std::unique_ptr<FilterWork>>
         /* delegation may occurs dead lock problem while DRC */
         auto err = doProcess(buffer);
         if (err == false) {
-            auto condfunc = [inbuffer = buffer](std::shared_ptr<FilterWorkInfo> elment)->bool {
-                                for (auto &buffer : elment->work->buffers) {
-                                    if (buffer.get() == inbuffer.get()) {
-                                        return true;
-                                    }
-                                }
-
-                                return false;
-                            };
-
             std::shared_ptr<FilterWorkInfo> workInfo = nullptr;
 
-            if (mWorkInfos.dequeue(workInfo, std::move(condfunc))) {
+            if (mWorkInfos.dequeue(workInfo, buffer.get())) {
                 workInfo.reset();
             }
         }
     }
 
+    if (mStatEnabled) {
+        /* cpu time consumed by the filter thread to process a work */
+        mStat.addCpuTime(ExynosStageStat::getThreadCpuTime() - cpuTime);
+    }
+
+    return true;
+}
+
+
+void ExynosFilterBase::FilterWorkInfoQueue::enqueue(std::shared_ptr<FilterWorkInfo> workInfo) {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if ((workInfo.get() == nullptr) ||
+        (workInfo->work.get() == nullptr)) {
+        return;
+    }
+
+    /* a work is queued only once */
+    auto found = mWorkIndex.find(workInfo->work.get());
+    if (found != mWorkIndex.end()) {
+        remove(found->second);
+    }
+
+    Entry entry;
+    entry.seq = mSeq++;
+    entry.work = workInfo->work.get();
+
+    for (auto &buffer : workInfo->work->buffers) {
+        entry.buffers.push_back(buffer.get());
+    }
+
+    entry.workInfo = std::move(workInfo);
+
+    auto it = mEntries.insert(mEntries.end(), std::move(entry));
+
+    mWorkIndex.emplace(it->work, it);
+
+    for (auto buffer : it->buffers) {
+        mBufferIndex.emplace(buffer, it);
+    }
+}
+
+bool ExynosFilterBase::FilterWorkInfoQueue::dequeue(
+    std::shared_ptr<FilterWorkInfo> &workInfo,
+    const ExynosBuffer              *buffer) {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto range = mBufferIndex.equal_range(buffer);
+    if (range.first == range.second) {
+        return false;
+    }
+
+    /* the oldest work wins if several works have the same buffer */
+    EntryIter entry = range.first->second;
+    for (auto it = range.first; it != range.second; it++) {
+        if (it->second->seq < entry->seq) {
+            entry = it->second;
+        }
+    }
+
+    workInfo = std::move(entry->workInfo);
+    remove(entry);
+
     return true;
 }
 
+int ExynosFilterBase::FilterWorkInfoQueue::size() {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mEntries.size();
+}
+
+void ExynosFilterBase::FilterWorkInfoQueue::clear() {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mBufferIndex.clear();
+    mWorkIndex.clear();
+    mEntries.clear();
+}
+
+void ExynosFilterBase::FilterWorkInfoQueue::remove(EntryIter entry) {
+    /* should be called with mMutex */
+    for (auto buffer : entry->buffers) {
+        auto range = mBufferIndex.equal_range(buffer);
+
+        for (auto it = range.first; it != range.second; it++) {
+            if (it->second == entry) {
+                mBufferIndex.erase(it);
+                break;
+            }
+        }
+    }
+
+    mWorkIndex.erase(entry->work);
+    mEntries.erase(entry);
+}
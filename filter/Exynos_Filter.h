@@ -22,6 +22,7 @@
 #include <functional>
 #include <string>
 #include <vector>
+#include <unordered_map>
 #include <utility>
 
 #include "ExynosQueue.h"
@@ -29,8 +30,10 @@
 #include "ExynosBuffer.h"
 #include "ExynosDef.h"
 #include "ExynosFilterParam.h"
+#include "ExynosMemoryPool.h"
 #include "ExynosListener.h"
 #include "ExynosETC.h"
+#include "ExynosStageStat.h"
 
 #define LOG_ON
 #include "ExynosLog.h"
@@ -44,7 +47,8 @@ public:
 
     virtual ~ExynosFilter() = default;
 
-    class FilterWork {
+    /* made on every frame, so it and nodes of buffers are recycled by ExynosMemoryPool */
+    class FilterWork : public ExynosPooledObject<FilterWork> {
     public:
         FilterWork() : inputIndex(0) {
             buffers.clear();
@@ -54,7 +58,7 @@ public:
             buffers.clear();
         }
 
-        std::list<std::shared_ptr<ExynosBuffer>> buffers;
+        std::list<std::shared_ptr<ExynosBuffer>, ExynosPoolAllocator<std::shared_ptr<ExynosBuffer>>> buffers;
 
         int inputIndex = 0;  /* an index of buffer which should be used */
         bool isDrain = false;
@@ -143,6 +147,7 @@ public:
         mDoResult.clear();
         mQuitWork = false;
         mDebug = EXYNOS_DEBUG_NONE;
+        mStatEnabled = false;
     }
 
     virtual ~ExynosFilterBase() {
@@ -186,10 +191,12 @@ protected:
                              */
 
         std::unique_ptr<FilterWork> work;
+
+        steady_clock::time_point queuedTime;  /* valid if statistics is enabled */
     };
 
     /* it will be implemented by ExynosFilter's child class function on ExynosListerInterface */
-    virtual bool processDone(ExynosBufferInfo input, ExynosBufferInfo output) override;
+    virtual bool processDone(ExynosBufferInfo &input, ExynosBufferInfo &output) override;
     virtual void eventReceived(std::shared_ptr<ExynosListenerEvent> event) override;
 
     /* function for thread pool owned by self. it will be implemented by ExynosFilter's child class */
@@ -215,7 +222,8 @@ protected:
     void reuseWorkInfo(std::shared_ptr<FilterWorkInfo> workInfo);
     bool workDone(std::unique_ptr<FilterWork> work);
     bool bypassBuffer(std::shared_ptr<ExynosBuffer> buffer);
-    std::optional<std::shared_ptr<ExynosBuffer>> allocBuffer(AllocArg arg);  /* blocking */
+    void updateStat(std::shared_ptr<FilterWorkInfo> workInfo);
+    BufferAllocRetType allocBuffer(AllocArg arg);  /* blocking up to ALLOC_WAIT_DEFAULT_TIMEOUT */
 
     std::shared_ptr<ExynosThreadPool> mThreadPool;
     std::shared_ptr<ExynosListener> mListener;  /* owns listener */
@@ -229,7 +237,47 @@ protected:
 
     ExynosDebugType mDebug;
 
+    bool            mStatEnabled;
+    ExynosStageStat mStat;
+
 private:
+    /*
+     * queue of workInfos indexed by its work and by buffers it had when it was queued,
+     * so returned buffer finds own workInfo without scanning all works
+     */
+    class FilterWorkInfoQueue {
+    public:
+        FilterWorkInfoQueue() = default;
+        ~FilterWorkInfoQueue() = default;
+
+        void enqueue(std::shared_ptr<FilterWorkInfo> workInfo);
+        bool dequeue(std::shared_ptr<FilterWorkInfo> &workInfo, const ExynosBuffer *buffer);
+        int size();
+        void clear();
+
+    private:
+        class Entry {
+        public:
+            uint64_t seq = 0;
+            std::shared_ptr<FilterWorkInfo> workInfo;
+            const FilterWork *work = nullptr;            /* key on mWorkIndex */
+            std::vector<const ExynosBuffer *, ExynosPoolAllocator<const ExynosBuffer *>> buffers;  /* keys on mBufferIndex */
+        };
+
+        using EntryList = std::list<Entry, ExynosPoolAllocator<Entry>>;
+        using EntryIter = EntryList::iterator;
+
+        void remove(EntryIter entry);
+
+        std::mutex mMutex;
+        uint64_t mSeq = 0;
+        EntryList mEntries;
+        std::unordered_map<const FilterWork *, EntryIter, std::hash<const FilterWork *>, std::equal_to<const FilterWork *>,
+                           ExynosPoolAllocator<std::pair<const FilterWork * const, EntryIter>>> mWorkIndex;
+        std::unordered_multimap<const ExynosBuffer *, EntryIter, std::hash<const ExynosBuffer *>, std::equal_to<const ExynosBuffer *>,
+                                ExynosPoolAllocator<std::pair<const ExynosBuffer * const, EntryIter>>> mBufferIndex;
+    };
+
     /* function for thread pool owned by self */
     bool doQueueWork(std::shared_ptr<std::unique_ptr<FilterWork>> shWork);
 
@@ -240,7 +288,7 @@ private:
     std::weak_ptr<FilterListener> mNotify;
 
     std::mutex mWorkInfoMutex;
-    ExynosQueue<std::shared_ptr<FilterWorkInfo>> mWorkInfos;
+    FilterWorkInfoQueue mWorkInfos;
 
     std::mutex mPendingParamsMutex;
     std::shared_ptr<ExynosFilterParams> mPendingParams;
@@ -0,0 +1,530 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * offline benchmark of the filter chain.
+ * the chain is made of stand-in filters which emulate the time of hardware and
+ * optionally copy the data like a software stage, and buffers are allocated from memfd.
+ * it does not need any device, and the result is a line of json.
+ *
+ * the scope is ExynosFilterBase only(queueing, threading, allocBuffer backoff and statistics).
+ * the stand-in filters are linked directly, so ExynosC2Component, ExynosFilterManager,
+ * C2BlockPool and the real filters(codec, csc, hdr2sdr) are not measured.
+ * it is a vendor executable since it links libExynosC2OSAL, it is not a host benchmark.
+ *
+ * usage : ExynosC2FilterBenchmark [-w width] [-h height] [-n frames] [-r fps] [-c concurrency]
+ *                                 [-p pool count] [-s name[:hw_us[:copy]],...]
+ */
+#include <condition_variable>
+#include <deque>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <thread>
+
+#include <getopt.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <cutils/native_handle.h>
+
+#include "Exynos_Filter.h"
+#include "ExynosStageStat.h"
+#include "ExynosDef.h"
+
+#define LOG_ON
+#include "ExynosLog.h"
+#define LOG_TAG "ExynosFilterBenchmark"
+
+#define BENCH_DEFAULT_WIDTH        1920
+#define BENCH_DEFAULT_HEIGHT       1080
+#define BENCH_DEFAULT_FRAMES       300
+#define BENCH_DEFAULT_CONCURRENCY  4
+#define BENCH_DEFAULT_POOL_CNT     8
+#define BENCH_DEFAULT_STAGES       "codec:4000,csc:1000:copy,hdr2sdr:2000"  /* h264 decoder */
+#define BENCH_WAIT_ALLOC_TIME      10    /* ms */
+#define BENCH_WAIT_DONE_TIME       5000  /* ms, without any progress */
+
+struct StageConfig {
+    std::string name;
+    int32_t     hwTime = 0;   /* us, emulated time of hardware */
+    bool        copy = false; /* input is copied to output like a software stage */
+};
+
+/* linear buffer backed by memfd. fd is owned by the pool */
+class MemfdBuffer : public ExynosBuffer {
+public:
+    MemfdBuffer(int fd, uint32_t size) {
+        mHandle = native_handle_create(1, 0);
+        if (mHandle != nullptr) {
+            mHandle->data[0] = fd;
+        }
+
+        mDataType = LINEAR;
+        mSize     = size;
+        mDataLen  = 0;
+
+        struct stat st;
+        if (fstat(fd, &st) == 0) {
+            setStIno(st.st_ino);
+        }
+    }
+
+    ~MemfdBuffer() {
+        unmap();
+
+        if (mHandle != nullptr) {
+            native_handle_delete(mHandle);
+            mHandle = nullptr;
+        }
+    }
+
+    int fd() {
+        return (mHandle != nullptr)? mHandle->data[0]:-1;
+    }
+};
+
+/* stand-in of C2BlockPool. a buffer is returned to the pool when the last reference is released */
+class MemfdPool : public std::enable_shared_from_this<MemfdPool> {
+public:
+    MemfdPool(std::string name, uint32_t size) : mName(name), mSize(size) {}
+
+    ~MemfdPool() {
+        for (auto fd : mFds) {
+            close(fd);
+        }
+    }
+
+    bool init(int count) {
+        for (int i = 0; i < count; i++) {
+            int fd = memfd_create(mName.c_str(), MFD_CLOEXEC);
+            if (fd < 0) {
+                return false;
+            }
+
+            mFds.push_back(fd);
+
+            if (ftruncate(fd, mSize) != 0) {
+                return false;
+            }
+
+            mFree.push_back(fd);
+        }
+
+        return true;
+    }
+
+    BufferAllocRetType alloc(AllocArg &arg) {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        if (mFree.empty()) {
+            int32_t waitTime = (arg.waitTime > 0)? arg.waitTime:BENCH_WAIT_ALLOC_TIME;
+
+            mCond.wait_for(lock, std::chrono::milliseconds(waitTime), [this]() { return !mFree.empty(); });
+            if (mFree.empty()) {
+                return { EXYNOS_ERROR_TRY_AGAIN, nullptr };
+            }
+        }
+
+        int fd = mFree.front();
+        mFree.pop_front();
+
+        lock.unlock();
+
+        auto delfunc = [wkPool = weak_from_this()](MemfdBuffer *p) {
+                            int fd = p->fd();
+                            delete p;
+
+                            auto pool = wkPool.lock();
+                            if (pool.get() != nullptr) {
+                                pool->put(fd);
+                            }
+                       };
+
+        auto buffer = std::shared_ptr<MemfdBuffer>(new MemfdBuffer(fd, mSize), std::move(delfunc));
+        if (buffer->handle() == nullptr) {
+            return { EXYNOS_ERROR_UNKNOWN, nullptr };
+        }
+
+        return { EXYNOS_ERROR_NONE, buffer };
+    }
+
+private:
+    void put(int fd) {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            mFree.push_back(fd);
+        }
+
+        mCond.notify_all();
+    }
+
+    std::string mName;
+    uint32_t    mSize;
+
+    std::mutex              mMutex;
+    std::condition_variable mCond;
+    std::vector<int>        mFds;
+    std::deque<int>         mFree;
+};
+
+/* stand-in of codec, csc and post processing filters */
+class ExynosStandInFilter : public ExynosFilterBase {
+public:
+    ExynosStandInFilter(uint32_t id, StageConfig config, uint32_t outSize) : ExynosFilterBase(id) {
+        mObjName = config.name;
+        mbLogOff = false;
+        mThreadPool->setObjName(mObjName);
+
+        mConfig  = config;
+        mOutSize = outSize;
+    }
+
+    ~ExynosStandInFilter() = default;
+
+    std::string report() {
+        return mStat.report(mObjName);
+    }
+
+protected:
+    bool doStart() override {
+        /* statistics is always taken regardless of the property */
+        mStatEnabled = true;
+        mStat.reset();
+
+        return true;
+    }
+
+    bool doStop() override {
+        return true;
+    }
+
+    bool doFlush() override {
+        return true;
+    }
+
+    bool doReset() override {
+        return true;
+    }
+
+    bool doProcess(std::shared_ptr<ExynosBuffer> buffer) override {
+        ExynosLogFunctionTrace();
+
+        if (buffer.get() == nullptr) {
+            /* invalid parameter */
+            ExynosLogE("[%s] invalid parameter", __FUNCTION__);
+            return false;
+        }
+
+        LinearBufferAttribute attr;
+        attr.mSize = mOutSize;
+
+        AllocArg arg;
+        arg.attr        = attr;
+        arg.limit       = 0;
+        arg.checkLimit  = nullptr;
+        arg.allocCount  = 0;
+
+        auto allocRet = allocBuffer(arg);
+        if (allocRet.first != EXYNOS_ERROR_NONE) {
+            return false;
+        }
+        std::shared_ptr<ExynosBuffer> outbuffer = allocRet.second;
+
+        if (mConfig.copy) {
+            BufferAddressInfo src, dst;
+
+            if ((buffer->map(src)) &&
+                (outbuffer->map(dst))) {
+                memcpy(dst.plane[0], src.plane[0], MIN(src.size[0], dst.size[0]));
+            }
+
+            buffer->unmap();
+            outbuffer->unmap();
+        }
+
+        if (mConfig.hwTime > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(mConfig.hwTime));
+        }
+
+        outbuffer->mImageInfo = buffer->mImageInfo;
+        outbuffer->setDataLen(mOutSize);
+
+        ExynosBufferInfo input, output;
+        ExynosBufferInfo::reset(input);
+        ExynosBufferInfo::reset(output);
+
+        input.eDataInfo  = DataInfo::UsedData;
+        input.obj  = buffer;
+
+        output.eDataInfo = DataInfo::SingleData;
+        output.obj = outbuffer;
+
+        return processDone(input, output);
+    }
+
+private:
+    StageConfig mConfig;
+    uint32_t    mOutSize;
+};
+
+static void Usage(const char *name) {
+    fprintf(stderr, "usage : %s [-w width] [-h height] [-n frames] [-r fps(0: as fast as possible)] [-c concurrency]\n"
+                    "          [-p buffer count per stage] [-s name[:hw_us[:copy]],...] (default: %s)\n",
+                    name, BENCH_DEFAULT_STAGES);
+}
+
+static bool ParseStages(const std::string &arg, std::vector<StageConfig> &stages) {
+    std::stringstream stream(arg);
+    std::string item;
+
+    while (std::getline(stream, item, ',')) {
+        std::stringstream itemStream(item);
+        std::string field;
+        StageConfig config;
+
+        if (!std::getline(itemStream, config.name, ':') ||
+            config.name.empty()) {
+            return false;
+        }
+
+        if (std::getline(itemStream, field, ':')) {
+            config.hwTime = atoi(field.c_str());
+        }
+
+        if (std::getline(itemStream, field, ':')) {
+            if (field != "copy") {
+                return false;
+            }
+
+            config.copy = true;
+        }
+
+        stages.push_back(config);
+    }
+
+    return !stages.empty();
+}
+
+int main(int argc, char **argv) {
+    uint32_t width       = BENCH_DEFAULT_WIDTH;
+    uint32_t height      = BENCH_DEFAULT_HEIGHT;
+    int32_t  frames      = BENCH_DEFAULT_FRAMES;
+    int32_t  frameRate   = 0;
+    int32_t  concurrency = BENCH_DEFAULT_CONCURRENCY;
+    int32_t  poolCnt     = BENCH_DEFAULT_POOL_CNT;
+    std::string stageArg = BENCH_DEFAULT_STAGES;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "w:h:n:r:c:p:s:")) != -1) {
+        switch (opt) {
+        case 'w': width       = atoi(optarg); break;
+        case 'h': height      = atoi(optarg); break;
+        case 'n': frames      = atoi(optarg); break;
+        case 'r': frameRate   = atoi(optarg); break;
+        case 'c': concurrency = atoi(optarg); break;
+        case 'p': poolCnt     = atoi(optarg); break;
+        case 's': stageArg    = optarg;       break;
+        default:
+            Usage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<StageConfig> stageConfigs;
+
+    if ((width == 0) || (height == 0) || (frames <= 0) || (frameRate < 0) ||
+        (concurrency <= 0) || (poolCnt <= 0) ||
+        (!ParseStages(stageArg, stageConfigs))) {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    uint32_t frameSize  = (width * height * 3) / 2;  /* NV12 */
+    uint32_t streamSize = frameSize / 4;
+
+    /* bitstream is queued from the pool like the input of decoder */
+    auto inputPool = std::make_shared<MemfdPool>("bench-input", streamSize);
+    if (!inputPool->init(concurrency + 1)) {
+        fprintf(stderr, "memfd is not available\n");
+        return 1;
+    }
+
+    std::vector<std::shared_ptr<MemfdPool>>                 pools;
+    std::vector<std::shared_ptr<BufferAllocFnType>>         allocFuncs;
+    std::vector<std::shared_ptr<ExynosStandInFilter>>       filters;
+
+    for (size_t i = 0; i < stageConfigs.size(); i++) {
+        auto pool = std::make_shared<MemfdPool>("bench-" + stageConfigs[i].name, frameSize);
+        if (!pool->init(poolCnt)) {
+            fprintf(stderr, "memfd is not available\n");
+            return 1;
+        }
+
+        auto allocFunc = std::make_shared<BufferAllocFnType>([pool](AllocArg &arg) { return pool->alloc(arg); });
+        auto filter = std::make_shared<ExynosStandInFilter>(FIRST_FILTER_ID + i, stageConfigs[i], frameSize);
+
+        filter->setAllocator(allocFunc);
+
+        if (!filters.empty()) {
+            filters.back()->setNext(filter);
+        }
+
+        pools.push_back(pool);
+        allocFuncs.push_back(allocFunc);
+        filters.push_back(filter);
+    }
+
+    /* end of the chain, it plays the role of component */
+    ExynosStageStat pipelineStat;
+
+    std::mutex              doneMutex;
+    std::condition_variable doneCond;
+    int32_t                 inFlight = 0;
+    int32_t                 doneCnt = 0;
+
+    auto callbackfunc = [&](std::unique_ptr<ExynosFilter::FilterWork> work)->bool {
+                            if (!work->buffers.empty()) {
+                                auto queuedTime = steady_clock::time_point(std::chrono::duration_cast<steady_clock::duration>(
+                                                        std::chrono::nanoseconds(work->buffers.front()->mImageInfo.nTimeStamp)));
+
+                                pipelineStat.addLatency(queuedTime);
+                            }
+
+                            work.reset();  /* buffers are returned to pools */
+
+                            {
+                                std::lock_guard<std::mutex> lock(doneMutex);
+
+                                inFlight--;
+                                doneCnt++;
+                            }
+
+                            doneCond.notify_all();
+
+                            return true;
+                        };
+
+    auto listener = ExynosFilter::FilterListener::makeListener(std::move(callbackfunc), "ExynosFilterBenchmark");
+    filters.back()->setCallback(listener);
+
+    if (!filters.front()->start()) {
+        fprintf(stderr, "start() is failed\n");
+        return 1;
+    }
+
+    pipelineStat.reset();
+
+    int64_t cpuTime  = ExynosStageStat::getThreadCpuTime();
+    auto startTime   = steady_clock::now();
+    bool timedOut    = false;
+
+    for (int32_t i = 0; (i < frames) && (!timedOut); i++) {
+        if (frameRate > 0) {
+            std::this_thread::sleep_until(startTime + std::chrono::microseconds(((int64_t)i * 1000000) / frameRate));
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(doneMutex);
+
+            if (!doneCond.wait_for(lock, std::chrono::milliseconds(BENCH_WAIT_DONE_TIME),
+                                   [&]() { return (inFlight < concurrency); })) {
+                timedOut = true;
+                break;
+            }
+
+            inFlight++;
+        }
+
+        AllocArg arg;
+        arg.attr        = LinearBufferAttribute{ streamSize };
+        arg.limit       = 0;
+        arg.checkLimit  = nullptr;
+        arg.allocCount  = 0;
+        arg.waitTime    = BENCH_WAIT_DONE_TIME;
+
+        auto ret = inputPool->alloc(arg);
+        if (ret.first != EXYNOS_ERROR_NONE) {
+            timedOut = true;
+            break;
+        }
+
+        auto buffer = ret.second;
+        buffer->setDataLen(streamSize);
+        buffer->mImageInfo.nWidth     = width;
+        buffer->mImageInfo.nHeight    = height;
+        buffer->mImageInfo.nTimeStamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                            steady_clock::now().time_since_epoch()).count();
+
+        auto work = std::make_unique<ExynosFilter::FilterWork>();
+
+        work->buffers.push_back(buffer);
+        work->inputIndex = 0;
+
+        filters.front()->queueWork(std::move(work));
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(doneMutex);
+
+        if ((!timedOut) &&
+            (!doneCond.wait_for(lock, std::chrono::milliseconds(BENCH_WAIT_DONE_TIME),
+                                [&]() { return (doneCnt >= frames); }))) {
+            timedOut = true;
+        }
+    }
+
+    cpuTime = ExynosStageStat::getThreadCpuTime() - cpuTime;
+
+    int32_t done = 0;
+    {
+        std::lock_guard<std::mutex> lock(doneMutex);
+
+        done = doneCnt;
+    }
+
+    std::string report = "{\"width\":" + std::to_string(width) +
+                         ",\"height\":" + std::to_string(height) +
+                         ",\"frames\":" + std::to_string(frames) +
+                         ",\"rate\":" + std::to_string(frameRate) +
+                         ",\"concurrency\":" + std::to_string(concurrency) +
+                         ",\"done\":" + std::to_string(done) +
+                         ",\"queue_cpu_us\":" + std::to_string(cpuTime) +
+                         ",\"pipeline\":" + pipelineStat.report("pipeline") +
+                         ",\"stages\":[";
+
+    for (size_t i = 0; i < filters.size(); i++) {
+        report += ((i > 0)? ",":"") + filters[i]->report();
+    }
+
+    report += "]}";
+
+    filters.front()->stop();
+    filters.front()->release();
+
+    printf("%s\n", report.c_str());
+
+    if (timedOut) {
+        fprintf(stderr, "works are not done in %d ms (done:%d/%d)\n", BENCH_WAIT_DONE_TIME, done, frames);
+        return 1;
+    }
+
+    return 0;
+}
@@ -66,7 +66,7 @@ bool ExynosCodecBaseFilter::onProcess(std::shared_ptr<ExynosBuffer> buffer) {
             return false;
         }
 
-        auto err = shCodec->inputEnqueue(input);
+        auto err = shCodec->inputEnqueue(std::move(input));
         if (err == false) {
             ExynosLogE("[%s] inputEnqueue() is failed", __FUNCTION__);
             return false;
@@ -216,7 +216,7 @@ void ExynosCodecBaseFilter::applyFilterParams(
     return;
 }
 
-bool ExynosCodecBaseFilter::processDone(ExynosBufferInfo input, ExynosBufferInfo output) {
+bool ExynosCodecBaseFilter::processDone(ExynosBufferInfo &input, ExynosBufferInfo &output) {
     ExynosLogFunctionTrace();
 
     /* process specialized features on each codec */
@@ -370,7 +370,7 @@ bool ExynosCodecBaseFilter::doStart() {
 
     mAllocThreadPool->flush();
 
-    (*mReqAllocCnt) = 0;  /* clear */
+    resetAllocWait();
 
     auto ret = onStart();
 
@@ -30,8 +30,7 @@
 #include "ExynosLog.h"
 
 using namespace std::chrono_literals;
-#define ALLOC_RETRY_TIME 1000ms
-#define WAIT_ALLOC_TIME 10ms
+#define ALLOC_RETRY_TIME 1000ms  /* since the first failure */
 
 class ExynosCodecBaseFilter : public ExynosFilterBase/*, public std::enable_shared_from_this<ExynosCodecBaseFilter>*/ {
 public:
@@ -46,6 +45,7 @@ public:
         mOperatingRate = 0;
 
         mReqAllocCnt = std::make_shared<uint32_t>(0);
+        mAllocWaitTime = ALLOC_WAIT_MIN_TIME;
     }
 
     virtual ~ExynosCodecBaseFilter() {
@@ -72,7 +72,7 @@ protected:
     virtual bool onProcess(std::shared_ptr<ExynosBuffer> input);
     virtual void onApplyConfig(ExynosBufferInfo &info, std::shared_ptr<ExynosParams> params);
     virtual void onAdditionalWorkForParam(ExynosParamIndex index, std::shared_ptr<ExynosParamBase> param);
-    virtual bool onProcessDone(ExynosBufferInfo input, ExynosBufferInfo output) = 0;
+    virtual bool onProcessDone(ExynosBufferInfo &input, ExynosBufferInfo &output) = 0;
     virtual void onEventReceived(std::shared_ptr<ExynosListenerEvent> event);
     virtual bool onFillOutBuffers() = 0;
     virtual int  onCheckNeedMoreBuffer() = 0;
@@ -103,9 +103,37 @@ protected:
      */
     std::shared_ptr<uint32_t> mReqAllocCnt;
 
+    /* how long the next allocation waits for a release(AllocArg.waitTime).
+     * it is doubled on every failure and reset with mReqAllocCnt.
+     */
+    int32_t mAllocWaitTime;
+    std::chrono::steady_clock::time_point mAllocWaitStart;
+
+    void resetAllocWait() {
+        (*mReqAllocCnt) = 0;
+        mAllocWaitTime = ALLOC_WAIT_MIN_TIME;
+    }
+
+    /* returns false if allocation has been failed for ALLOC_RETRY_TIME */
+    bool markAllocRetry(bool useDeadline) {
+        auto curTime = std::chrono::steady_clock::now();
+
+        if ((*mReqAllocCnt) == 0) {
+            mAllocWaitStart = curTime;
+        } else if ((useDeadline) &&
+                   ((curTime - mAllocWaitStart) > ALLOC_RETRY_TIME)) {
+            return false;
+        }
+
+        (*mReqAllocCnt)++;  /* mark */
+        mAllocWaitTime = MIN(mAllocWaitTime * 2, ALLOC_WAIT_MAX_TIME);
+
+        return true;
+    }
+
 private:
     /* override function on ExynosListerInterface */
-    bool processDone(ExynosBufferInfo input, ExynosBufferInfo output) override;
+    bool processDone(ExynosBufferInfo &input, ExynosBufferInfo &output) override;
     void eventReceived(std::shared_ptr<ExynosListenerEvent> event) override;
 
     /* override function on ExynosFilterBase. function for thread pool owned by self */
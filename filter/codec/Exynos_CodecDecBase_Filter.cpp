@@ -81,14 +81,17 @@ bool ExynosCodecDecBaseFilter::onSetup(std::shared_ptr<ExynosBuffer> buffer) {
         }
     }
 
+    /* output format is known. prepare buffers ahead of the first request */
+    warmUpOutBuffers();
+
     /* generate a param for requesting configuration update */
     {
-        auto param = std::make_shared<ExynosParam<ParamRequestParamUpdate>>();
+        auto param = MakePooledShared<ExynosParam<ParamRequestParamUpdate>>();
         param->m.flags = (ExynosRequestedParamFlag)(REQUESTED_TYPE_PIC_SIZE |
                                                     REQUESTED_TYPE_MAX_PIC_SIZE |
                                                     REQUESTED_TYPE_MIN_DPB_CNT);
 
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamRequestParamUpdate>>(param);
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamRequestParamUpdate>>(param);
         filterParam->registTargetFilter(TARGET_OWNER_COMPONENT);
 
         auto filterParams = std::static_pointer_cast<ExynosFilterParams>(buffer->mParams);
@@ -106,13 +109,13 @@ bool ExynosCodecDecBaseFilter::onSetup(std::shared_ptr<ExynosBuffer> buffer) {
             auto update = updateParam->m.func;
 
             if (update.get() != nullptr) {
-                auto filterParam = std::make_shared<ExynosFilterParam<ParamOutputDelay>>();
+                auto filterParam = MakePooledShared<ExynosFilterParam<ParamOutputDelay>>();
                 auto param = std::static_pointer_cast<ExynosParam<ParamOutputDelay>>(filterParam->getBaseParam());
 
                 param->m.delay = mNumMinDPB;
                 filterParam->registTargetFilter(TARGET_OWNER_COMPONENT);
 
-                auto filterParams = std::make_shared<ExynosFilterParams>();
+                auto filterParams = MakePooledShared<ExynosFilterParams>();
                 filterParams->addParam(filterParam);
 
                 (*update)(filterParams);
@@ -216,7 +219,7 @@ void ExynosCodecDecBaseFilter::onAdditionalWorkForParam(
     return;
 }
 
-bool ExynosCodecDecBaseFilter::onProcessDone(ExynosBufferInfo input, ExynosBufferInfo output) {
+bool ExynosCodecDecBaseFilter::onProcessDone(ExynosBufferInfo &input, ExynosBufferInfo &output) {
     ExynosLogFunctionTrace();
 
     std::shared_ptr<ExynosBuffer> inbuffer = input.obj;
@@ -240,7 +243,7 @@ bool ExynosCodecDecBaseFilter::onProcessDone(ExynosBufferInfo input, ExynosBuffe
     bool needUpdate = ((mNumMaxOutput < mNumMinDPB) || mRequestUpdate || forceUpdate);
 
     if (forceUpdate) {
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamRequestParamUpdate>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamRequestParamUpdate>>();
         filterParam->registTargetFilter(TARGET_OWNER_COMPONENT);
 
         auto param       = std::static_pointer_cast<ExynosParam<ParamRequestParamUpdate>>(filterParam->getBaseParam());
@@ -252,7 +255,7 @@ bool ExynosCodecDecBaseFilter::onProcessDone(ExynosBufferInfo input, ExynosBuffe
     }
 
     if (needUpdate) {  /* number of required DPB is over than max num for allocating on filter */
-        auto filterParam = std::make_shared<ExynosFilterParam<ParamOutputDelay>>();
+        auto filterParam = MakePooledShared<ExynosFilterParam<ParamOutputDelay>>();
         filterParam->registTargetFilter(TARGET_OWNER_COMPONENT);
 
         auto param = std::static_pointer_cast<ExynosParam<ParamOutputDelay>>(filterParam->getBaseParam());
@@ -269,7 +272,7 @@ bool ExynosCodecDecBaseFilter::onProcessDone(ExynosBufferInfo input, ExynosBuffe
         {
             auto param = std::static_pointer_cast<ExynosParam<ParamBlackBarInfo>>(output.params.getParam(ExynosParamIndex::BlackBarInfoIndex));
             if (param.get() != nullptr) {
-                auto filterParam = std::make_shared<ExynosFilterParam<ParamBlackBarInfo>>(param);
+                auto filterParam = MakePooledShared<ExynosFilterParam<ParamBlackBarInfo>>(param);
                 filterParam->registTargetFilter(TARGET_OWNER_COMPONENT);
 
                 filterParams->addParam(filterParam);
@@ -389,6 +392,7 @@ bool ExynosCodecDecBaseFilter::allocOutBuffer() {
     arg.limit       = mNumMinDPB;
     arg.checkLimit  = nullptr;
     arg.allocCount  = 0;
+    arg.waitTime    = mAllocWaitTime;
 
     int32_t refBufCount    = shCodec->getRefBufCount();
     int32_t regBufCount    = shCodec->getRegBufCount();
@@ -468,14 +472,11 @@ bool ExynosCodecDecBaseFilter::allocOutBuffer() {
                 /* except for display order decoding in resource mode(buffer queue)
                  * set timeout about retry.
                  */
-                if ((mIsDecodeOrder) ||
-                    (mAllocMode != AllocMode::PreferResources)) {
-                    if ((*mReqAllocCnt) > (ALLOC_RETRY_TIME / WAIT_ALLOC_TIME)) {
-                        return false;
-                    }
+                bool useDeadline = ((mIsDecodeOrder) ||
+                                    (mAllocMode != AllocMode::PreferResources));
+                if (!markAllocRetry(useDeadline)) {
+                    return false;
                 }
-
-                (*mReqAllocCnt)++;  /* mark */
             }
 
             int32_t reqTaskCnt = ((int32_t)mReqAllocCnt.use_count()) - 1;
@@ -497,7 +498,7 @@ bool ExynosCodecDecBaseFilter::allocOutBuffer() {
 
     std::shared_ptr<ExynosBuffer> outbuffer = ret.second;
 
-    (*mReqAllocCnt) = 0;  /* clear */
+    resetAllocWait();
 
     auto adjustDelayFunc = [&]()->int32_t {
                                 /* get delayable time based on history */
@@ -543,11 +544,80 @@ bool ExynosCodecDecBaseFilter::reconfigOutput() {
     mAllocDuration.clear();
     mDelayableTimeMs = 0;
 
+    warmUpOutBuffers();
+
     auto ret = fillOutBuffers();
 
     return ret;
 }
 
+void ExynosCodecDecBaseFilter::warmUpOutBuffers() {
+    ExynosLogFunctionTrace();
+
+    if (mAllocMode == AllocMode::PreferResources) {
+        /* buffers are not kept in advance */
+        return;
+    }
+
+    auto shThreadPool = mAllocThreadPool;
+
+    if (shThreadPool.get() == nullptr) {
+        /* obj is released */
+        ExynosLogT("[%s] obj is released", __FUNCTION__);
+        return;
+    }
+
+    /* it is handled ahead of doFillOutBuffers() on the same thread */
+    auto func = [wkOwner = weak_from_this()]()->bool {
+                    if (wkOwner.expired()) {
+                        return false;
+                    }
+
+                    auto shOwner = std::static_pointer_cast<ExynosCodecDecBaseFilter>(wkOwner.lock());
+
+                    if (shOwner.get() != nullptr) {
+                        return shOwner->doWarmUpOutBuffers();
+                    }
+
+                    return false;
+                };
+
+    shThreadPool->toss(std::string("ExynosCodecDecBaseFilter::doWarmUpOutBuffers"), std::move(func));
+}
+
+bool ExynosCodecDecBaseFilter::doWarmUpOutBuffers() {
+    ExynosLogFunctionTrace();
+
+    std::lock_guard<std::mutex> lock(mReconfigMutex);  /* wait while reconfiguring output */
+
+    std::shared_ptr<BufferAllocFnType> allocFunc = mFnBufferAlloc.lock();
+
+    if (allocFunc.get() == nullptr) {
+        ExynosLogT("[%s] obj is released", __FUNCTION__);
+        return false;
+    }
+
+    GraphicBufferAttribute attr;
+    attr.mWidth  = mWidth;
+    attr.mHeight = mHeight;
+    attr.mFormat = mFormat;
+    attr.mUsage  = 0;
+
+    AllocArg arg;
+    arg.attr        = attr;
+    arg.limit       = 0;
+    arg.checkLimit  = nullptr;
+    arg.allocCount  = 0;
+    arg.warmUpCount = mNumMinDPB + ExynosUtils::GetWarmPoolExtraCnt();
+
+    ExynosLogD("[%s] warm up output buffers : width(%d), height(%d), format(0x%x), count(%d)", __FUNCTION__,
+                attr.mWidth, attr.mHeight, attr.mFormat, arg.warmUpCount);
+
+    auto ret = (*allocFunc)(arg);
+
+    return (ret.first == EXYNOS_ERROR_NONE);
+}
+
 bool ExynosCodecDecBaseFilter::outputBufferEnqueue(std::shared_ptr<ExynosBuffer> outbuffer) {
     ExynosLogFunctionTrace();
 
@@ -586,7 +656,7 @@ bool ExynosCodecDecBaseFilter::outputBufferEnqueue(std::shared_ptr<ExynosBuffer>
                 output.nFD[0], output.obj.get());
 
     /* enqueue an output */
-    auto err = shCodec->outputEnqueue(output);
+    auto err = shCodec->outputEnqueue(std::move(output));
     if (err != true) {
         /* TODO : error handling */
         ExynosLogE("[%s] outputEnqueue() is failed", __FUNCTION__);
@@ -53,7 +53,7 @@ protected:
     bool onFlush() override;
     virtual void onApplyConfig(ExynosBufferInfo &info, std::shared_ptr<ExynosParams> params) override;
     virtual void onAdditionalWorkForParam(ExynosParamIndex index, std::shared_ptr<ExynosParamBase> param) override;
-    virtual bool onProcessDone(ExynosBufferInfo input, ExynosBufferInfo output) override;
+    virtual bool onProcessDone(ExynosBufferInfo &input, ExynosBufferInfo &output) override;
     virtual void onEventReceived(std::shared_ptr<ExynosListenerEvent> event) override;
     bool onFillOutBuffers() override;
     int onCheckNeedMoreBuffer() override;
@@ -72,6 +72,8 @@ private:
     /* add function for ExynosCodecDecBaseFilter */
     bool allocOutBuffer();
     bool reconfigOutput();
+    void warmUpOutBuffers();
+    bool doWarmUpOutBuffers();
 
     std::mutex          mReconfigMutex;
     ExynosDurationCalc  mAllocDuration;
@@ -160,7 +160,7 @@ void ExynosCodecEncBaseFilter::onAdditionalWorkForParam(
     return;
 }
 
-bool ExynosCodecEncBaseFilter::onProcessDone(ExynosBufferInfo input, ExynosBufferInfo output) {
+bool ExynosCodecEncBaseFilter::onProcessDone(ExynosBufferInfo &input, ExynosBufferInfo &output) {
     ExynosLogFunctionTrace();
 
     std::shared_ptr<ExynosBuffer> inbuffer = input.obj;
@@ -222,7 +222,7 @@ bool ExynosCodecEncBaseFilter::onProcessDone(ExynosBufferInfo input, ExynosBuffe
             auto param = std::static_pointer_cast<ExynosParam<ParamAverageQpInfo>>(
                                     output.params.getParam(ExynosParamIndex::AverageQpInfoIndex));
             if (param.get() != nullptr) {
-                auto filterParam = std::make_shared<ExynosFilterParam<ParamAverageQpInfo>>(param);
+                auto filterParam = MakePooledShared<ExynosFilterParam<ParamAverageQpInfo>>(param);
                 filterParam->registTargetFilter(TARGET_OWNER_COMPONENT);
 
                 filterParams->addParam(filterParam);
@@ -335,6 +335,7 @@ bool ExynosCodecEncBaseFilter::allocOutBuffer() {
     arg.limit       = 0;
     arg.checkLimit  = nullptr;
     arg.allocCount  = 0;
+    arg.waitTime    = mAllocWaitTime;
 
     if (mFnBufferAlloc.expired()) {
         ExynosLogT("[%s] obj is released", __FUNCTION__);
@@ -357,11 +358,9 @@ bool ExynosCodecEncBaseFilter::allocOutBuffer() {
              * therefore, quit to request allocating a buffer.
              */
             if (mNumOutput > 0) {  /* since number of output is decided */
-                if ((*mReqAllocCnt) > (ALLOC_RETRY_TIME / WAIT_ALLOC_TIME)) {
+                if (!markAllocRetry(true)) {
                     return false;
                 }
-
-                (*mReqAllocCnt)++;  /* mark */
             }
 
             /* try again. allocating a buffer could be failed due to resource limitation */
@@ -386,7 +385,7 @@ bool ExynosCodecEncBaseFilter::allocOutBuffer() {
 
     std::shared_ptr<ExynosBuffer> outbuffer = ret.second;
 
-    (*mReqAllocCnt) = 0;  /* clear */
+    resetAllocWait();
 
     ExynosBufferInfo output;
     ExynosBufferInfo::reset(output);
@@ -410,7 +409,7 @@ bool ExynosCodecEncBaseFilter::allocOutBuffer() {
                  output.nFD[0], output.obj.get());
 
     /* enqueue an output */
-    auto err = shCodec->outputEnqueue(output);
+    auto err = shCodec->outputEnqueue(std::move(output));
     if (err != true) {
         /* TODO : error handling */
         ExynosLogE("[%s] outputEnqueue() is failed", __FUNCTION__);
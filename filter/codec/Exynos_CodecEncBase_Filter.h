@@ -45,7 +45,7 @@ protected:
     bool onFlush() override;
     void onApplyConfig(ExynosBufferInfo &info, std::shared_ptr<ExynosParams> params) override;
     virtual void onAdditionalWorkForParam(ExynosParamIndex index, std::shared_ptr<ExynosParamBase> param) override;
-    virtual bool onProcessDone(ExynosBufferInfo input, ExynosBufferInfo output) override;
+    virtual bool onProcessDone(ExynosBufferInfo &input, ExynosBufferInfo &output) override;
     bool onFillOutBuffers() override;
     int onCheckNeedMoreBuffer() override;
     bool onSetInputBufferInfo(ExynosBufferInfo &input, std::shared_ptr<ExynosBuffer> buffer) override;
@@ -41,7 +41,7 @@ bool ExynosAv1DecFilter::onSetup(std::shared_ptr<ExynosBuffer> buffer) {
             auto params = std::static_pointer_cast<ExynosFilterParams>(buffer->mParams);
 
             if (mPiledParams.get() == nullptr) {
-                mPiledParams = std::make_shared<ExynosFilterParams>();
+                mPiledParams = MakePooledShared<ExynosFilterParams>();
             }
 
             mPiledParams->append(params);
@@ -92,7 +92,7 @@ bool ExynosAv1DecFilter::onProcess(std::shared_ptr<ExynosBuffer> buffer) {
     return ExynosCodecDecBaseFilter::onProcess(buffer);
 }
 
-bool ExynosAv1DecFilter::onProcessDone(ExynosBufferInfo input, ExynosBufferInfo output) {
+bool ExynosAv1DecFilter::onProcessDone(ExynosBufferInfo &input, ExynosBufferInfo &output) {
     ExynosLogFunctionTrace();
 
     std::shared_ptr<ExynosBuffer> inbuffer = input.obj;
@@ -117,7 +117,7 @@ bool ExynosAv1DecFilter::onProcessDone(ExynosBufferInfo input, ExynosBufferInfo
             auto param = std::static_pointer_cast<ExynosParam<ParamFilmGrainInfo>>(
                                 output.params.getParam(ExynosParamIndex::FilmGrainInfoIndex));
             if (param.get() != nullptr) {
-                auto filterParam = std::make_shared<ExynosFilterParam<ParamFilmGrainInfo>>(param);
+                auto filterParam = MakePooledShared<ExynosFilterParam<ParamFilmGrainInfo>>(param);
                 filterParam->registTargetFilter(TARGET_FILTER_ALL);  /* TODO */
 
                 filterParams->addParam(filterParam);
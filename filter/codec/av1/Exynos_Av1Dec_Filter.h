@@ -41,7 +41,7 @@ private:
     /* override function on ExynosCodecBaseFilter */
     bool onSetup(std::shared_ptr<ExynosBuffer> buffer) override;
     bool onProcess(std::shared_ptr<ExynosBuffer> buffer) override;
-    bool onProcessDone(ExynosBufferInfo input, ExynosBufferInfo output) override;
+    bool onProcessDone(ExynosBufferInfo &input, ExynosBufferInfo &output) override;
 
     /* add function for ExynosAv1DecFilter */
 
@@ -47,7 +47,7 @@ void ExynosHevcEncFilter::onApplyConfig(ExynosBufferInfo &info, std::shared_ptr<
     return;
 }
 
-bool ExynosHevcEncFilter::onProcessDone(ExynosBufferInfo input, ExynosBufferInfo output) {
+bool ExynosHevcEncFilter::onProcessDone(ExynosBufferInfo &input, ExynosBufferInfo &output) {
     ExynosLogFunctionTrace();
 
     auto ret = ExynosCodecEncBaseFilter::onProcessDone(input, output);
@@ -69,7 +69,7 @@ bool ExynosHevcEncFilter::onProcessDone(ExynosBufferInfo input, ExynosBufferInfo
                 auto param = std::static_pointer_cast<ExynosParam<ParamHDR10PlusStatInfo>>(
                                 output.params.getParam(ExynosParamIndex::HDR10PlusStatInfoIndex));
                 if (param.get() != nullptr) {
-                    auto filterParam = std::make_shared<ExynosFilterParam<ParamHDR10PlusStatInfo>>(param);
+                    auto filterParam = MakePooledShared<ExynosFilterParam<ParamHDR10PlusStatInfo>>(param);
 
                     filterParam->registTargetFilter(TARGET_FILTER_ALL); /* TODO */
 
@@ -95,7 +95,7 @@ bool ExynosHevcEncFilter::onProcessDone(ExynosBufferInfo input, ExynosBufferInfo
                     auto param = std::static_pointer_cast<ExynosParam<ParamHdrDynamicInfo>>(
                                     input.params.getParam(ParamHdrDynamicInfo::INDEX));
                     if (param.get() != nullptr) {
-                        auto filterParam = std::make_shared<ExynosFilterParam<ParamHdrDynamicInfo>>(param);
+                        auto filterParam = MakePooledShared<ExynosFilterParam<ParamHdrDynamicInfo>>(param);
 
                         filterParam->registTargetFilter(TARGET_FILTER_ALL); /* TODO */
 
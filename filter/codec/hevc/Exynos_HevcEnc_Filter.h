@@ -38,7 +38,7 @@ public:
 private:
     /* override function on ExynosCodecBaseFilter */
     void onApplyConfig(ExynosBufferInfo &info, std::shared_ptr<ExynosParams> params) override;
-    bool onProcessDone(ExynosBufferInfo input, ExynosBufferInfo output) override;
+    bool onProcessDone(ExynosBufferInfo &input, ExynosBufferInfo &output) override;
 
     /* add function for ExynosHevcEncFilter */
 };
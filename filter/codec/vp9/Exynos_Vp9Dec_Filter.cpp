@@ -63,7 +63,7 @@ bool ExynosVp9DecFilter::onSetup(std::shared_ptr<ExynosBuffer> buffer) {
             auto params = std::static_pointer_cast<ExynosFilterParams>(buffer->mParams);
 
             if (mPiledParams.get() == nullptr) {
-                mPiledParams = std::make_shared<ExynosFilterParams>();
+                mPiledParams = MakePooledShared<ExynosFilterParams>();
             }
 
             mPiledParams->append(params);
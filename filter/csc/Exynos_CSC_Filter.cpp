@@ -297,11 +297,11 @@ bool ExynosCSCFilter::doProcess(std::shared_ptr<ExynosBuffer> buffer) {
         arg.checkLimit  = nullptr;
         arg.allocCount  = 0;
 
-        auto optBuffer = allocBuffer(arg);
-        if (!optBuffer) {
+        auto allocRet = allocBuffer(arg);
+        if (allocRet.first != EXYNOS_ERROR_NONE) {
             return false;
         }
-        std::shared_ptr<ExynosBuffer> outbuffer = *optBuffer;
+        std::shared_ptr<ExynosBuffer> outbuffer = allocRet.second;
 
         setPortBufferInfo(output, dstInfo, outbuffer, dataspace, buffer->mImageInfo, Port::Output);
 
@@ -175,11 +175,11 @@ bool ExynosGDCFilter::doProcess(std::shared_ptr<ExynosBuffer> buffer) {
         arg.checkLimit  = nullptr;
         arg.allocCount  = 0;
 
-        auto optBuffer = allocBuffer(arg);
-        if (!optBuffer) {
+        auto allocRet = allocBuffer(arg);
+        if (allocRet.first != EXYNOS_ERROR_NONE) {
             return false;
         }
-        std::shared_ptr<ExynosBuffer> outbuffer = *optBuffer;
+        std::shared_ptr<ExynosBuffer> outbuffer = allocRet.second;
 
         output.eDataInfo = DataInfo::NoData;
         setBufferInfo(output, outbuffer, false);
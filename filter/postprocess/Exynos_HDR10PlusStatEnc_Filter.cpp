@@ -167,7 +167,7 @@ bool ExynosHDR10PlusStatEncImpl::run(
     {
         auto filterParams = std::static_pointer_cast<ExynosFilterParams>(buffer->mParams);
         if (filterParams.get() != nullptr) {
-            auto filterParam = std::make_shared<ExynosFilterParam<ParamHdrDynamicInfo>>();
+            auto filterParam = MakePooledShared<ExynosFilterParam<ParamHdrDynamicInfo>>();
             filterParam->registTargetFilter(TARGET_OWNER_COMPONENT);
 
             auto param = std::static_pointer_cast<ExynosParam<ParamHdrDynamicInfo>>(filterParam->getBaseParam());
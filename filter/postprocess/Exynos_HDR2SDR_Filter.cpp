@@ -563,11 +563,11 @@ bool ExynosHDR2SDRFilter::onProcess(std::shared_ptr<ExynosBuffer> buffer) {
     arg.checkLimit  = nullptr;
     arg.allocCount  = 0;
 
-    auto optBuffer = allocBuffer(arg);
-    if (!optBuffer) {
+    auto allocRet = allocBuffer(arg);
+    if (allocRet.first != EXYNOS_ERROR_NONE) {
         return false;
     }
-    std::shared_ptr<ExynosBuffer> outbuffer = *optBuffer;
+    std::shared_ptr<ExynosBuffer> outbuffer = allocRet.second;
 
     auto ret = mHDR2SDRImpl->run(buffer, outbuffer, mMode, mFrameCount);
     /* update output information to buffer */
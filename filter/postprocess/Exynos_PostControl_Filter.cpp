@@ -189,7 +189,7 @@ static void setActualFormatToCSCForHdr2Sdr(
         (format == HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_SPN_10B_SBWC) ||
         (format == HAL_PIXEL_FORMAT_EXYNOS_YCbCr_P010_M) ||
         (format == HAL_PIXEL_FORMAT_YCBCR_P010)) {
-        auto param = std::make_shared<ExynosFilterParam<ParamActualFormat>>();
+        auto param = MakePooledShared<ExynosFilterParam<ParamActualFormat>>();
         auto baseParam = std::static_pointer_cast<ExynosParam<ParamActualFormat>>(param->getBaseParam());
 
         baseParam->m.format = HAL_PIXEL_FORMAT_EXYNOS_YCbCr_P010_M;
@@ -208,7 +208,7 @@ static void setActualFormatToCSCForHdr2Sdr(
          */
         if (param->m.format == HAL_PIXEL_FORMAT_YV12) {
             /* update to src format */
-            auto updateFilterParam = std::make_shared<ExynosFilterParam<ParamActualFormat>>();
+            auto updateFilterParam = MakePooledShared<ExynosFilterParam<ParamActualFormat>>();
             updateFilterParam->registTargetFilter(CSCFilterID);
 
             auto updateParam = std::static_pointer_cast<ExynosParam<ParamActualFormat>>(updateFilterParam->getBaseParam());
@@ -240,7 +240,7 @@ static void setActualFormatToCSCForFilmGrain(
          */
         if (param->m.format == HAL_PIXEL_FORMAT_YV12) {
             /* update to YV12M */
-            auto updateFilterParam = std::make_shared<ExynosFilterParam<ParamActualFormat>>();
+            auto updateFilterParam = MakePooledShared<ExynosFilterParam<ParamActualFormat>>();
             updateFilterParam->registTargetFilter(CSCFilterID);
 
             auto updateParam = std::static_pointer_cast<ExynosParam<ParamActualFormat>>(updateFilterParam->getBaseParam());
@@ -284,7 +284,7 @@ static void setActualFormatToCSCForFilmGrain(
     }();
 
     if (format != reqFormat) {
-        auto param = std::make_shared<ExynosFilterParam<ParamActualFormat>>();
+        auto param = MakePooledShared<ExynosFilterParam<ParamActualFormat>>();
         auto baseParam = std::static_pointer_cast<ExynosParam<ParamActualFormat>>(param->getBaseParam());
 
         baseParam->m.format = reqFormat;
@@ -366,7 +366,7 @@ bool ExynosPostCtrlFilter::doProcess(std::shared_ptr<ExynosBuffer> buffer) {
     if (filterParams.get() == nullptr) {
         ExynosLogD("[%s] filterParams is invalid. make filterParams", __FUNCTION__);
 
-        filterParams = std::make_shared<ExynosFilterParams>();
+        filterParams = MakePooledShared<ExynosFilterParams>();
 
         buffer->mParams = std::static_pointer_cast<ExynosParams>(filterParams);
     }
@@ -378,7 +378,7 @@ bool ExynosPostCtrlFilter::doProcess(std::shared_ptr<ExynosBuffer> buffer) {
         ((mHDR2SDRFilterID > 0) &&
          (mHDR2SDRImpl.get() != nullptr) &&
          (mHDR2SDRImpl->query() == true))) {
-        auto param = std::make_shared<ExynosFilterParam<ParamHDR2SDR>>();
+        auto param = MakePooledShared<ExynosFilterParam<ParamHDR2SDR>>();
         auto baseParam = std::static_pointer_cast<ExynosParam<ParamHDR2SDR>>(param->getBaseParam());
 
         baseParam->m.enable = 1;
@@ -405,7 +405,7 @@ bool ExynosPostCtrlFilter::doProcess(std::shared_ptr<ExynosBuffer> buffer) {
     /* for increasing number of internal buffer */
     int usedFilterNum = (mUseCSC && mUseFilmGrain)? 2:((mUseCSC || mUseFilmGrain)? 1:0);
     if (mUsedFilterNum < usedFilterNum) {
-        auto param = std::make_shared<ExynosFilterParam<ParamEnabledFilterNum>>();
+        auto param = MakePooledShared<ExynosFilterParam<ParamEnabledFilterNum>>();
         auto baseParam = std::static_pointer_cast<ExynosParam<ParamEnabledFilterNum>>(param->getBaseParam());
 
         baseParam->m.num = usedFilterNum;
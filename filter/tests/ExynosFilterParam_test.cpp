@@ -0,0 +1,93 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "ExynosFilterParam.h"
+
+namespace {
+
+std::shared_ptr<ExynosFilterParam<ParamDataSpace>> MakeDataSpace(int dataSpace, uint32_t target) {
+    auto param = MakePooledShared<ExynosFilterParam<ParamDataSpace>>();
+
+    std::static_pointer_cast<ExynosParam<ParamDataSpace>>(param->getBaseParam())->m.dataspace = dataSpace;
+    param->registTargetFilter(target);
+
+    return param;
+}
+
+int DataSpaceOf(std::shared_ptr<ExynosParamBase> param) {
+    return std::static_pointer_cast<ExynosParam<ParamDataSpace>>(param)->m.dataspace;
+}
+
+}  // namespace
+
+TEST(ExynosFilterParamsTest, AppendedParamsTakePrecedence) {
+    auto params = MakePooledShared<ExynosFilterParams>();
+    params->addParam(MakeDataSpace(1, FIRST_FILTER_ID));
+    params->addParam(MakePooledShared<ExynosFilterParam<ParamColorAspects>>());
+
+    auto appended = MakePooledShared<ExynosFilterParams>();
+    appended->addParam(MakeDataSpace(2, FIRST_FILTER_ID + 1));
+    appended->addParam(MakePooledShared<ExynosFilterParam<ParamHdrStaticInfo>>());
+
+    params->append(appended);
+
+    EXPECT_EQ(3, params->size());
+
+    /* the appended one replaces the param and its target */
+    EXPECT_EQ(nullptr, params->getParam(ParamDataSpace::INDEX, FIRST_FILTER_ID));
+
+    auto param = params->getParam(ParamDataSpace::INDEX, FIRST_FILTER_ID + 1);
+    ASSERT_NE(nullptr, param);
+    EXPECT_EQ(2, DataSpaceOf(param->getBaseParam()));
+
+    /* base params follow the filter params */
+    EXPECT_EQ(2, DataSpaceOf(params->ExynosParams::getParam(ParamDataSpace::INDEX)));
+    EXPECT_NE(nullptr, params->ExynosParams::getParam(ParamColorAspects::INDEX));
+    EXPECT_NE(nullptr, params->ExynosParams::getParam(ParamHdrStaticInfo::INDEX));
+
+    /* the appended one is not changed */
+    EXPECT_EQ(2, appended->size());
+}
+
+TEST(ExynosFilterParamsTest, QueryIsInOrderOfIndex) {
+    auto params = MakePooledShared<ExynosFilterParams>();
+
+    auto first = MakePooledShared<ExynosFilterParams>();
+    first->addParam(MakeDataSpace(1, TARGET_FILTER_ALL));
+
+    auto second = MakePooledShared<ExynosFilterParams>();
+    auto aspects = MakePooledShared<ExynosFilterParam<ParamColorAspects>>();
+    aspects->registTargetFilter(TARGET_FILTER_ALL);
+    second->addParam(aspects);
+
+    params->append(first);
+    params->append(second);
+
+    ParamIndex prev = ExynosParamIndex::UnknownIndex;
+    for (int i = 0; i < params->size(); i++) {
+        ParamIndex index = params->queryParam(FIRST_FILTER_ID, i);
+
+        EXPECT_GT(index, prev);
+        prev = index;
+    }
+
+    /* a copy has the same params */
+    ExynosFilterParams copy(*params);
+    EXPECT_EQ(params->size(), copy.size());
+    EXPECT_EQ(1, DataSpaceOf(copy.getParam(ParamDataSpace::INDEX, FIRST_FILTER_ID)->getBaseParam()));
+}
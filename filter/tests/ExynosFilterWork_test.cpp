@@ -0,0 +1,168 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "Exynos_Filter.h"
+#include "ExynosFilterParam.h"
+
+#define TEST_WARM_UP_FRAMES  16
+#define TEST_FRAMES          10000
+
+/* heap allocations made by the thread under measurement */
+static thread_local bool  tCountAlloc = false;
+static thread_local long  tAllocCnt   = 0;
+
+void* operator new(size_t size) {
+    if (tCountAlloc) {
+        tAllocCnt++;
+    }
+
+    void *ptr = malloc((size > 0)? size:1);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+    free(ptr);
+}
+
+namespace {
+
+/* FilterWorkInfo is for filters only */
+class FilterAccess : public ExynosFilterBase {
+public:
+    using ExynosFilterBase::FilterWorkInfo;
+};
+
+class AllocCounter {
+public:
+    AllocCounter() {
+        tAllocCnt   = 0;
+        tCountAlloc = true;
+    }
+
+    ~AllocCounter() {
+        tCountAlloc = false;
+    }
+
+    long count() {
+        return tAllocCnt;
+    }
+};
+
+template<typename T>
+std::shared_ptr<ExynosFilterParam<T>> MakeFilterParam(uint32_t target) {
+    auto param = MakePooledShared<ExynosFilterParam<T>>();
+    param->registTargetFilter(target);
+
+    return param;
+}
+
+/* what a component and filters make on every frame */
+void RunFrame(std::shared_ptr<ExynosBuffer> &in, std::shared_ptr<ExynosBuffer> &out) {
+    /* params of a frame, and the ones merged on the way */
+    auto params = MakePooledShared<ExynosFilterParams>();
+    params->addParam(MakeFilterParam<ParamColorAspects>(TARGET_FILTER_ALL));
+    params->addParam(MakeFilterParam<ParamHdrStaticInfo>(FIRST_FILTER_ID));
+    params->addParam(MakeFilterParam<ParamDataSpace>(FIRST_FILTER_ID + 1));
+
+    auto pending = MakePooledShared<ExynosFilterParams>(*params);
+    pending->append(params);
+
+    /* a work passed to the next filter */
+    auto work = std::make_unique<ExynosFilter::FilterWork>();
+    work->buffers.push_back(in);
+    work->buffers.push_back(out);
+
+    auto workInfo = MakePooledShared<FilterAccess::FilterWorkInfo>(1, 1, std::move(work));
+    ASSERT_EQ(2u, workInfo->work->buffers.size());
+}
+
+}  // namespace
+
+TEST(ExynosFilterWorkTest, SteadyStateFramesDoNotAllocateFromHeap) {
+    auto in  = std::make_shared<ExynosBuffer>();
+    auto out = std::make_shared<ExynosBuffer>();
+
+    for (int i = 0; i < TEST_WARM_UP_FRAMES; i++) {
+        RunFrame(in, out);
+    }
+
+    uint64_t hit = 0, miss = 0;
+    ExynosMemoryPool::getInstance().getStatistics(hit, miss);
+
+    long allocCnt = 0;
+    {
+        AllocCounter counter;
+
+        for (int i = 0; i < TEST_FRAMES; i++) {
+            RunFrame(in, out);
+        }
+
+        allocCnt = counter.count();
+    }
+
+    uint64_t hitAfter = 0, missAfter = 0;
+    ExynosMemoryPool::getInstance().getStatistics(hitAfter, missAfter);
+
+    EXPECT_EQ(0, allocCnt) << ((double)allocCnt / TEST_FRAMES) << " allocations per frame";
+    EXPECT_EQ(miss, missAfter);
+    EXPECT_GT(hitAfter, hit);
+}
+
+TEST(ExynosFilterWorkTest, FramesReleasedOnOtherThreadDoNotAllocateFromHeap) {
+    auto in  = std::make_shared<ExynosBuffer>();
+    auto out = std::make_shared<ExynosBuffer>();
+
+    /* a work made by a filter is released by the next filter's thread */
+    auto runOnOtherThread = [&](int frames, long *allocCnt) {
+        std::unique_ptr<ExynosFilter::FilterWork> work;
+
+        for (int i = 0; i < frames; i++) {
+            {
+                AllocCounter counter;
+
+                work = std::make_unique<ExynosFilter::FilterWork>();
+                work->buffers.push_back(in);
+                work->buffers.push_back(out);
+
+                *allocCnt += counter.count();
+            }
+
+            std::thread([&work]() { work.reset(); }).join();
+        }
+    };
+
+    long warmUpCnt = 0;
+    runOnOtherThread(TEST_WARM_UP_FRAMES, &warmUpCnt);
+
+    long allocCnt = 0;
+    runOnOtherThread(1000, &allocCnt);
+
+    EXPECT_EQ(0, allocCnt);
+}
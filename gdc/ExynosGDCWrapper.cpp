@@ -531,7 +531,7 @@ bool ExynosGDCWrapper::GDCImpl::dequeue() {
     return true;
 }
 
-bool ExynosGDCWrapper::process(ExynosBufferInfo input, ExynosBufferInfo output) {
+bool ExynosGDCWrapper::process(ExynosBufferInfo &input, ExynosBufferInfo &output) {
     ExynosLogFunctionTrace();
 
     if (mImpl.get() == nullptr) {
@@ -39,7 +39,7 @@ public:
         }
     }
 
-    bool process(ExynosBufferInfo input, ExynosBufferInfo output);
+    bool process(ExynosBufferInfo &input, ExynosBufferInfo &output);
     bool flush();
 
 private:
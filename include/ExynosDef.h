@@ -76,8 +76,50 @@
 
 #define EXTRA_INTERNAL_BUFFER_NUM 3
 
+#define SW_CSC_DEFAULT_THREAD_CNT     1  /* more threads are opt-in by vendor.debug.c2.csc.threads */
+#define SW_CSC_DEFAULT_STRIPE_HEIGHT 64
+
+#define WORK_DONE_BATCH_DEFAULT_TIME 0  /* us, 0 : onWorkDone per c2work */
+#define WORK_DONE_BATCH_MAX_CNT 8
+
+#define STAGE_STAT_MAX_SAMPLE_CNT 4096
+
+#define TONE_MAPPING_MODE_AUTO 0  /* GPU, CPU when GPU is unavailable or overloaded */
+#define TONE_MAPPING_MODE_GPU  1
+#define TONE_MAPPING_MODE_CPU  2
+#define TONE_MAPPING_DEFAULT_THREAD_CNT 4
+#define TONE_MAPPING_DEFAULT_STRIPE_HEIGHT 64
+#define TONE_MAPPING_DEFAULT_IN_FLIGHT_CNT 3  /* works submitted to GPU at once */
+#define TONE_MAPPING_GPU_OVERLOAD_TIME 50  /* ms */
+#define TONE_MAPPING_GPU_OVERLOAD_CNT 3    /* successive frames over the time to fall back to CPU */
+
 #define BASE_BUFFER_MAX_PLANES 3
 
+#define LOG_RING_RECORD_CNT 128  /* per thread, power of 2 */
+#define LOG_RING_TAG_SIZE 48
+#define LOG_RING_MSG_SIZE 256
+#define LOG_ASYNC_DRAIN_TIME 5  /* ms */
+
+#define MAP_CACHE_MAX_IDLE_CNT 32  /* mappings kept after unmap() */
+
+#define ALLOC_WAIT_MIN_TIME 1  /* ms, waiting for a buffer release is doubled on every failure */
+#define ALLOC_WAIT_MAX_TIME 16  /* ms */
+#define ALLOC_WAIT_DEFAULT_TIMEOUT 10000  /* ms, total waiting time before a filter gives up */
+
+#define REF_TABLE_SHARD_CNT 8
+#define REF_TABLE_FD_CNT 1024  /* fds over it are converted by fstat() */
+
+#define SWAP_SLAB_DEFAULT_CNT 64  /* grows if it is exhausted */
+#define SWAP_HANDLE_INDEX_BITS 12
+
+#define WARM_POOL_DEFAULT_EXTRA_CNT 2  /* buffers prepared over min DPB */
+#define WARM_POOL_MAX_IDLE_CNT 32
+
+#define MEMORY_POOL_BLOCK_ALIGN 16
+#define MEMORY_POOL_MAX_BLOCK_SIZE 256
+#define MEMORY_POOL_MAX_FREE_CNT 256  /* per size class */
+#define MEMORY_POOL_THREAD_CACHE_CNT 32  /* per size class of a thread */
+
 #define MAX_TEMPORAL_LAYERS 7
 #define MAX_TEMPORAL_B_LAYERS 5
 #define MAX_VPX_TEMPORAL_LAYERS 3
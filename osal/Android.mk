@@ -62,3 +62,197 @@ LOCAL_CFLAGS +=	-fPIC \
 LOCAL_CFLAGS += $(EXYNOS_GLOBAL_CFLAGS)
 
 include $(BUILD_STATIC_LIBRARY)
+
+##########################
+####  ExynosC2OSALTest  ###
+##########################
+include $(CLEAR_VARS)
+
+LOCAL_CFLAGS :=
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_SRC_FILES := \
+        tests/ExynosThreadPool_test.cpp \
+        tests/ExynosQueue_test.cpp \
+        tests/ExynosMemoryPool_test.cpp \
+        tests/ExynosMapCache_test.cpp \
+        tests/ExynosInFlightQueue_test.cpp \
+        tests/ExynosFlatMap_test.cpp \
+        tests/ExynosBufferInfo_test.cpp \
+        tests/ExynosLog_test.cpp \
+        tests/ExynosRefTable_test.cpp \
+        tests/ExynosBufferManager_test.cpp
+
+LOCAL_MODULE := ExynosC2OSALTest
+LOCAL_LICENSE_KINDS := SPDX-license-identifier-Apache-2.0
+LOCAL_LICENSE_CONDITIONS := notice
+LOCAL_NOTICE_FILE := $(LOCAL_PATH)/NOTICE
+
+LOCAL_PROPRIETARY_MODULE := true
+
+LOCAL_HEADER_LIBRARIES := libexynosc2_base_headers libexynosc2_osal_headers
+LOCAL_HEADER_LIBRARIES += $(EXYNOS_VENDOR_HEADER_LIBS)
+
+LOCAL_STATIC_LIBRARIES := libExynosC2OSAL
+
+LOCAL_SHARED_LIBRARIES := \
+        liblog \
+        libutils \
+        libcutils
+LOCAL_SHARED_LIBRARIES += $(EXYNOS_VENDOR_SHARED_LIBS)
+
+LOCAL_CFLAGS +=	-O2 \
+                -Werror \
+                -Wall \
+                -Wno-deprecated-enum-enum-conversion \
+                -std=gnu++1z \
+                -std=c++2a
+LOCAL_CFLAGS += $(EXYNOS_GLOBAL_CFLAGS)
+
+include $(BUILD_NATIVE_TEST)
+
+######################################
+####  ExynosC2ThreadPoolBenchmark  ###
+######################################
+include $(CLEAR_VARS)
+
+LOCAL_CFLAGS :=
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_SRC_FILES := \
+        benchmark/Exynos_ThreadPool_Benchmark.cpp
+
+LOCAL_MODULE := ExynosC2ThreadPoolBenchmark
+LOCAL_LICENSE_KINDS := SPDX-license-identifier-Apache-2.0
+LOCAL_LICENSE_CONDITIONS := notice
+LOCAL_NOTICE_FILE := $(LOCAL_PATH)/NOTICE
+
+LOCAL_PROPRIETARY_MODULE := true
+
+LOCAL_HEADER_LIBRARIES := libexynosc2_base_headers libexynosc2_osal_headers
+LOCAL_HEADER_LIBRARIES += $(EXYNOS_VENDOR_HEADER_LIBS)
+
+LOCAL_STATIC_LIBRARIES := libExynosC2OSAL
+
+LOCAL_SHARED_LIBRARIES := \
+        liblog \
+        libutils \
+        libcutils
+LOCAL_SHARED_LIBRARIES += $(EXYNOS_VENDOR_SHARED_LIBS)
+
+LOCAL_CFLAGS +=	-O3 \
+                -Werror \
+                -Wall \
+                -Wno-deprecated-enum-enum-conversion \
+                -std=gnu++1z \
+                -std=c++2a
+LOCAL_CFLAGS += $(EXYNOS_GLOBAL_CFLAGS)
+
+include $(BUILD_EXECUTABLE)
+
+#################################
+####  ExynosC2QueueBenchmark  ###
+#################################
+include $(CLEAR_VARS)
+
+LOCAL_CFLAGS :=
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_SRC_FILES := \
+        benchmark/Exynos_Queue_Benchmark.cpp
+
+LOCAL_MODULE := ExynosC2QueueBenchmark
+LOCAL_LICENSE_KINDS := SPDX-license-identifier-Apache-2.0
+LOCAL_LICENSE_CONDITIONS := notice
+LOCAL_NOTICE_FILE := $(LOCAL_PATH)/NOTICE
+
+LOCAL_PROPRIETARY_MODULE := true
+
+LOCAL_HEADER_LIBRARIES := libexynosc2_osal_headers
+
+LOCAL_CFLAGS +=	-O3 \
+                -Werror \
+                -Wall \
+                -std=gnu++1z \
+                -std=c++2a
+LOCAL_CFLAGS += $(EXYNOS_GLOBAL_CFLAGS)
+
+include $(BUILD_EXECUTABLE)
+
+###################################
+####  ExynosC2FlatMapBenchmark  ###
+###################################
+include $(CLEAR_VARS)
+
+LOCAL_CFLAGS :=
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_SRC_FILES := \
+        benchmark/Exynos_FlatMap_Benchmark.cpp
+
+LOCAL_MODULE := ExynosC2FlatMapBenchmark
+LOCAL_LICENSE_KINDS := SPDX-license-identifier-Apache-2.0
+LOCAL_LICENSE_CONDITIONS := notice
+LOCAL_NOTICE_FILE := $(LOCAL_PATH)/NOTICE
+
+LOCAL_PROPRIETARY_MODULE := true
+
+LOCAL_HEADER_LIBRARIES := libexynosc2_base_headers libexynosc2_osal_headers
+LOCAL_HEADER_LIBRARIES += $(EXYNOS_VENDOR_HEADER_LIBS)
+
+LOCAL_STATIC_LIBRARIES := libExynosC2OSAL
+
+LOCAL_SHARED_LIBRARIES := \
+        liblog \
+        libutils \
+        libcutils
+LOCAL_SHARED_LIBRARIES += $(EXYNOS_VENDOR_SHARED_LIBS)
+
+LOCAL_CFLAGS +=	-O3 \
+                -Werror \
+                -Wall \
+                -Wno-deprecated-enum-enum-conversion \
+                -std=gnu++1z \
+                -std=c++2a
+LOCAL_CFLAGS += $(EXYNOS_GLOBAL_CFLAGS)
+
+include $(BUILD_EXECUTABLE)
+
+######################################
+####  ExynosC2BufferInfoBenchmark  ###
+######################################
+include $(CLEAR_VARS)
+
+LOCAL_CFLAGS :=
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_SRC_FILES := \
+        benchmark/Exynos_BufferInfo_Benchmark.cpp
+
+LOCAL_MODULE := ExynosC2BufferInfoBenchmark
+LOCAL_LICENSE_KINDS := SPDX-license-identifier-Apache-2.0
+LOCAL_LICENSE_CONDITIONS := notice
+LOCAL_NOTICE_FILE := $(LOCAL_PATH)/NOTICE
+
+LOCAL_PROPRIETARY_MODULE := true
+
+LOCAL_HEADER_LIBRARIES := libexynosc2_base_headers libexynosc2_osal_headers
+LOCAL_HEADER_LIBRARIES += $(EXYNOS_VENDOR_HEADER_LIBS)
+
+LOCAL_STATIC_LIBRARIES := libExynosC2OSAL
+
+LOCAL_SHARED_LIBRARIES := \
+        liblog \
+        libutils \
+        libcutils
+LOCAL_SHARED_LIBRARIES += $(EXYNOS_VENDOR_SHARED_LIBS)
+
+LOCAL_CFLAGS +=	-O3 \
+                -Werror \
+                -Wall \
+                -Wno-deprecated-enum-enum-conversion \
+                -std=gnu++1z \
+                -std=c++2a
+LOCAL_CFLAGS += $(EXYNOS_GLOBAL_CFLAGS)
+
+include $(BUILD_EXECUTABLE)
@@ -34,6 +34,7 @@
 #include "ExynosParam.h"
 
 #include "ExynosETC.h"
+#include "ExynosMapCache.h"
 
 #define LOG_ON
 #include "ExynosLog.h"
@@ -54,6 +55,8 @@ struct AllocArg {
     int limit;
     int allocCount;
     std::function<int32_t(int32_t, int32_t)> checkLimit;
+    int32_t waitTime = 0;  /* ms, how long to wait for a buffer to be released if none is available. 0: default */
+    int32_t warmUpCount = 0;  /* if it is set, buffers are prepared in the warm pool up to it and none is returned */
 };
 
 struct BufferAddressInfo {
@@ -97,7 +100,9 @@ public:
         mMetaSize = 0;
         memset(&mAddressInfo, 0, sizeof(mAddressInfo));
         memset(&mImageInfo, 0, sizeof(mImageInfo));
+        memset(mPlaneIno, 0, sizeof(mPlaneIno));
         mStIno = std::nullopt;
+        mMapOwner = 0;
     }
 
     virtual ~ExynosBuffer() {
@@ -199,6 +204,22 @@ public:
         return mStIno;
     }
 
+    /* instance which the mappings belong to in ExynosMapCache, see ExynosMapCache::drop() */
+    void setMapOwner(uint64_t owner) {
+        mMapOwner = owner;
+    }
+
+    /* the buffer is freed. mappings cached for it are dropped */
+    void invalidateMapping() {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        for (int i = 0; i < BASE_BUFFER_MAX_PLANES; i++) {
+            if (mPlaneIno[i] != 0) {  /* it has been mapped */
+                ExynosMapCache::getInstance().invalidate(mPlaneIno[i]);
+            }
+        }
+    }
+
     void setDestroyNotify(std::shared_ptr<std::function<bool(uint32_t)>> func) {
         std::lock_guard<std::mutex> lock(mMutex);
 
@@ -236,9 +257,10 @@ public:
         mFlags |= MAPPED;  /* mark */
 
         if (mDataType == LINEAR) {
-            auto addr = (void *)mmap(nullptr, mSize, PROT_READ | PROT_WRITE, MAP_SHARED, mHandle->data[0], 0);
+            auto addr = ExynosMapCache::getInstance().acquire(mHandle->data[0], getPlaneIno(0), 0, mSize, mMapOwner);
             if (addr == nullptr) {
                 /* mmap() is failed */
+                mFlags &= ~(MAPPED);
                 return false;
             }
 
@@ -254,9 +276,11 @@ public:
             mAddressInfo.num = cnt;
 
             for (int i = 0; i < cnt; i++) {
-                auto addr = (void *)mmap(nullptr, size[i], PROT_READ | PROT_WRITE, MAP_SHARED, mHandle->data[i], 0);
+                auto addr = ExynosMapCache::getInstance().acquire(mHandle->data[i], getPlaneIno(i), 0, size[i], mMapOwner);
                 if (addr == nullptr) {
                     /* mmap() is failed */
+                    releaseMapping();
+                    mFlags &= ~(MAPPED);
                     return false;
                 }
 
@@ -274,13 +298,7 @@ public:
         std::lock_guard<std::mutex> lock(mMutex);
 
         if (mFlags & MAPPED) {
-            for (int i = 0; i < mAddressInfo.num; i++) {
-                if (mAddressInfo.plane[i] != nullptr) {
-                    munmap(mAddressInfo.plane[i], mAddressInfo.size[i]);
-                }
-            }
-
-            memset(&mAddressInfo, 0, sizeof(mAddressInfo));
+            releaseMapping();
             mFlags &= ~(MAPPED);  /* clear */
         }
     }
@@ -348,6 +366,11 @@ public:
         return nullptr;
     }
 
+    /* allocated height of luma. planes of a single-fd buffer are placed by it */
+    virtual int vstride() {
+        return (int)mHeight;
+    }
+
     /* extra information : attributes information of data owned by buffer */
     ImageInfo mImageInfo;
 
@@ -370,6 +393,30 @@ protected:
         }
     }
 
+    /* inode of dmabuf to identify the mapping of plane in ExynosMapCache */
+    uint64_t getPlaneIno(int plane) {
+        if (mPlaneIno[plane] == 0) {
+            if ((plane == 0) && mStIno) {
+                mPlaneIno[plane] = *mStIno;
+            } else {
+                mPlaneIno[plane] = ExynosMapCache::getStIno(mHandle->data[plane]);
+            }
+        }
+
+        return mPlaneIno[plane];
+    }
+
+    /* mMutex should be held */
+    void releaseMapping() {
+        for (int i = 0; i < mAddressInfo.num; i++) {
+            if (mAddressInfo.plane[i] != nullptr) {
+                ExynosMapCache::getInstance().release(mAddressInfo.plane[i], mAddressInfo.size[i]);
+            }
+        }
+
+        memset(&mAddressInfo, 0, sizeof(mAddressInfo));
+    }
+
     /* inborn information */
     ExynosBufferHandle *mHandle = nullptr;
 
@@ -391,6 +438,8 @@ protected:
     std::mutex          mMutex;
     BufferAddressInfo   mAddressInfo;
     std::optional<uint64_t> mStIno;
+    uint64_t            mPlaneIno[BASE_BUFFER_MAX_PLANES];
+    uint64_t            mMapOwner;
 };
 
 template<typename T>
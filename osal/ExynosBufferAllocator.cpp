@@ -75,6 +75,7 @@ public:
         }
 
         mType = Type::ALLOC;
+        mExported = false;
 
         mBlock.id = C2BlockPool::BASIC_LINEAR;
         mBlock.c2block = c2block;
@@ -101,6 +102,7 @@ public:
         }
 
         mType = Type::ALLOC;
+        mExported = false;
 
         mBlock.id = C2BlockPool::BASIC_GRAPHIC;
         mBlock.c2block = c2block;
@@ -117,6 +119,9 @@ public:
         mParams     = nullptr;
 
         setGrallocMetadata(mHandle, true);
+
+        /* identity of buffer for fixed fds and ref DPB, not to look up on every queueing */
+        setStIno(ExynosMapCache::getStIno(mHandle->data[0]));
     }
 
     ExynosBufferImpl(std::shared_ptr<C2Buffer> c2buffer, ExynosBufferHandle *handle, uint32_t capacity) {
@@ -131,6 +136,7 @@ public:
         C2ConstLinearBlock c2block = data.linearBlocks().front();
 
         mType = Type::IMPORT;
+        mExported = false;
 
         mHandle = handle;
 
@@ -155,6 +161,7 @@ public:
         }
 
         mType = Type::IMPORT;
+        mExported = false;
 
         mHandle = handle;
 
@@ -200,11 +207,34 @@ public:
                 /* TODO : error handling */
                 break;
             }
+
+            mExported = (mBuffer.get() != nullptr);
         }
 
         return mBuffer;
     }
 
+    /* takes the block out to be reused, if nobody else is holding it.
+     * a block handed over to the client(C2Buffer) or held as a reference(origin) is not.
+     */
+    std::optional<BufferWarmPool::Block> detachBlock() {
+        if ((mType != Type::ALLOC) ||
+            (mExported == true)) {
+            return std::nullopt;
+        }
+
+        bool isUnique = std::visit([](auto &c2block)->bool { return ((c2block.get() != nullptr) && (c2block.use_count() == 1)); },
+                                   mBlock.c2block);
+        if (!isUnique) {
+            return std::nullopt;
+        }
+
+        BufferWarmPool::Block block = std::move(mBlock.c2block);
+        mType = Type::INVALID;
+
+        return { std::move(block) };
+    }
+
     void reset() {
         if (mType == Type::ALLOC) {
             switch (mBlock.id) {
@@ -266,6 +296,16 @@ public:
         return ret;
     }
 
+    int vstride() override {
+        if ((mDataType != GRAPHIC) ||
+            (mHandle == nullptr)) {
+            return ExynosBuffer::vstride();
+        }
+
+        /* gralloc could align it more than the height */
+        return ExynosGraphicBufferMeta::get_vstride((buffer_handle_t)mHandle);
+    }
+
     bool destroy(uint32_t val) override {
         std::lock_guard<std::mutex> lock(mMutex);
 
@@ -363,6 +403,7 @@ private:
     }
 
     Type mType;
+    bool mExported;  /* C2Buffer has been created */
     C2Block mBlock;
     std::shared_ptr<C2Buffer> mBuffer;
 
@@ -385,6 +426,13 @@ ExynosBufferAllocator::ExynosBufferAllocator(
     }
 
     mBufferCount = std::make_shared<BufferCount>();
+
+    /* blocks of a buffer queue belong to the surface, they are not kept */
+    if ((ExynosUtils::GetWarmPoolType() == true) &&
+        (mAllocStoreID != C2AllocatorStore::BAD_ID) &&
+        (mAllocStoreID != C2PlatformAllocatorStore::BUFFERQUEUE)) {
+        mWarmPool = std::make_shared<BufferWarmPool>(WARM_POOL_MAX_IDLE_CNT);
+    }
 }
 
 BufferAllocRetType ExynosBufferAllocator::alloc(AllocArg &argument) {
@@ -395,6 +443,20 @@ BufferAllocRetType ExynosBufferAllocator::alloc(AllocArg &argument) {
         return std::make_pair(EXYNOS_ERROR_BAD_STATE, nullptr);
     }
 
+    if (argument.warmUpCount > 0) {
+        return warmUp(argument);
+    }
+
+    /* taken before checking, so that a release in between is not missed */
+    uint64_t released = (mBufferCount.get() != nullptr)? mBufferCount->getReleased():0;
+    auto waitRelease = [&](std::chrono::milliseconds timeout) {
+                            if (mBufferCount.get() != nullptr) {
+                                mBufferCount->waitRelease(released, timeout);
+                            } else {
+                                std::this_thread::sleep_for(timeout);
+                            }
+                       };
+
     if (argument.checkLimit != nullptr) {
         int32_t allocCount = (mBufferCount.get() != nullptr)? mBufferCount->get():0;
         argument.limit = argument.checkLimit(allocCount, argument.limit);
@@ -402,22 +464,14 @@ BufferAllocRetType ExynosBufferAllocator::alloc(AllocArg &argument) {
 
     if ((argument.limit > 0) &&
         (getAllocCount() >= argument.limit)) {
-        std::this_thread::sleep_for(WAIT_ALLOC_TIME);
+        /* wakes up as soon as one of buffers allocated by us is released */
+        waitRelease((argument.waitTime > 0)? (argument.waitTime * 1ms):WAIT_ALLOC_TIME);
         ExynosLogT("[%s] allocation is failed due to over limit", __FUNCTION__);
         return std::make_pair(EXYNOS_ERROR_TRY_AGAIN, nullptr);
     }
 
     void *handle = nullptr;
-    auto delfunc = [bufferCount = mBufferCount](ExynosBuffer *p) {
-                        if (p != nullptr) {
-                            if (bufferCount.get() != nullptr) {
-                                StaticExynosLog(Level::Trace, "ExynosBufferAllocator",
-                                                "[free : %p] buffer count: %d", p, bufferCount->dec());
-                            }
-
-                            delete (static_cast<ExynosBufferImpl*>(p));
-                        }
-                   };
+    BufferWarmPool::Key key = {};
     std::shared_ptr<ExynosBuffer> buffer = nullptr;
 
     switch (mAllocStoreID) {
@@ -427,20 +481,26 @@ BufferAllocRetType ExynosBufferAllocator::alloc(AllocArg &argument) {
         [[fallthrough]];
     case C2AllocatorStore::DEFAULT_LINEAR:
     {
-        std::shared_ptr<C2LinearBlock> c2block = nullptr;
+        BufferWarmPool::Block block;
         auto attribute = std::get<LinearBufferAttribute>(argument.attr);
 
         ExynosLogV("[%s] alloc linear buffer : size(%d), usage(%x)", __FUNCTION__, attribute.mSize, mUsage);
 
-        auto capacity = attribute.mSize + HW_EXTRA_BYTES;
+        key = getWarmPoolKey(argument);
 
-        c2_status_t err = shBlockPool->fetchLinearBlock(capacity, mUsage, &c2block);
+        auto capacity = key.width;
+
+        c2_status_t err = fetchBlock(shBlockPool, key, block, true);
         if (err != C2_OK) {
             /* TODO : error handling */
             ExynosLogE("[%s] fetchLinearBlock(%d, 0x%llx) is failed() : 0x%x", __FUNCTION__, capacity, mUsage.expected, err);
+            if (argument.waitTime > 0) {
+                waitRelease(argument.waitTime * 1ms);
+            }
             return std::make_pair(EXYNOS_ERROR_TRY_AGAIN, nullptr);
         }
 
+        auto c2block = std::get<std::shared_ptr<C2LinearBlock>>(block);
         if (c2block.get() == nullptr) {
             /* TODO : error handling */
             return std::make_pair(EXYNOS_ERROR_UNKNOWN, nullptr);
@@ -455,24 +515,15 @@ BufferAllocRetType ExynosBufferAllocator::alloc(AllocArg &argument) {
         [[fallthrough]];
     case C2AllocatorStore::DEFAULT_GRAPHIC:
     {
-        std::shared_ptr<C2GraphicBlock> c2block = nullptr;
+        BufferWarmPool::Block block;
         auto attribute = std::get<GraphicBufferAttribute>(argument.attr);
 
-        if (mUsage.expected & VendorC2Config::MAY_CPU_READ) {
-            mUsage.expected = mUsage.expected & (~VendorC2Config::MAY_CPU_READ);
-
-            /* if output is not compressed format, CPU could read output */
-            if (!ExynosUtils::CheckCompressedFormat(attribute.mFormat)) {
-                mUsage.expected = mUsage.expected | C2MemoryUsage::CPU_READ;
-            }
-        }
-
-        mUsage.expected = mUsage.expected | attribute.mUsage;
+        key = getWarmPoolKey(argument);
 
         ExynosLogV("[%s] alloc graphic buffer : width(%d), height(%d), format(0x%x), usage(0x%llx)",
                         __FUNCTION__, attribute.mWidth, attribute.mHeight, attribute.mFormat, mUsage.expected);
 
-        c2_status_t err = shBlockPool->fetchGraphicBlock(attribute.mWidth, attribute.mHeight, attribute.mFormat, mUsage, &c2block);
+        c2_status_t err = fetchBlock(shBlockPool, key, block, true);
         if (err != C2_OK) {
             if (mAllocStoreID == C2PlatformAllocatorStore::BUFFERQUEUE) {
                 ExynosLogV("[%s] fetchGraphicBlock(%d, %d, 0x%x, 0x%llx) is failed() : 0x%x", __FUNCTION__,
@@ -482,9 +533,15 @@ BufferAllocRetType ExynosBufferAllocator::alloc(AllocArg &argument) {
                             attribute.mWidth, attribute.mHeight, attribute.mFormat, mUsage.expected, err);
             }
 
+            if ((err == C2_BLOCKING) &&
+                (argument.waitTime > 0)) {
+                waitRelease(argument.waitTime * 1ms);
+            }
+
             return std::make_pair((err == C2_BLOCKING)? EXYNOS_ERROR_TRY_AGAIN:EXYNOS_ERROR_BAD_STATE, nullptr);
         }
 
+        auto c2block = std::get<std::shared_ptr<C2GraphicBlock>>(block);
         if (c2block.get() == nullptr) {
             /* TODO : error handling */
             return std::make_pair(EXYNOS_ERROR_UNKNOWN, nullptr);
@@ -503,7 +560,39 @@ BufferAllocRetType ExynosBufferAllocator::alloc(AllocArg &argument) {
         return std::make_pair(EXYNOS_ERROR_INVALID_PARAM, nullptr);
     }
 
+    /* blocks of a buffer queue go back to the surface and come again, their mappings are kept */
+    bool ownMemory = (mAllocStoreID != C2PlatformAllocatorStore::BUFFERQUEUE);
+
+    auto delfunc = [bufferCount = mBufferCount, wkWarmPool = std::weak_ptr<BufferWarmPool>(mWarmPool), key, ownMemory](ExynosBuffer *p) {
+                        if (p != nullptr) {
+                            if (bufferCount.get() != nullptr) {
+                                StaticExynosLog(Level::Trace, "ExynosBufferAllocator",
+                                                "[free : %p] buffer count: %d", p, bufferCount->dec());
+                            }
+
+                            auto impl = static_cast<ExynosBufferImpl*>(p);
+
+                            /* a block which is not used by others goes to the warm pool for the next alloc() */
+                            auto block = impl->detachBlock();
+                            if (block) {
+                                auto shWarmPool = wkWarmPool.lock();
+                                bool kept = ((shWarmPool.get() != nullptr) &&
+                                             (shWarmPool->put(key, std::move(*block))));
+
+                                /* otherwise, it is the last reference and dmabuf is released with it.
+                                 * its mappings should not pin the memory.
+                                 */
+                                if ((!kept) && (ownMemory)) {
+                                    impl->invalidateMapping();
+                                }
+                            }
+
+                            delete impl;
+                        }
+                   };
+
     buffer = std::shared_ptr<ExynosBuffer>(static_cast<ExynosBuffer*>(handle), std::move(delfunc));
+    buffer->setMapOwner(mMapOwner);
 
     if ((buffer.get() != nullptr) &&
         (mBufferCount.get() != nullptr)) {
@@ -514,6 +603,116 @@ BufferAllocRetType ExynosBufferAllocator::alloc(AllocArg &argument) {
     return std::make_pair(EXYNOS_ERROR_NONE, buffer);
 }
 
+BufferAllocRetType ExynosBufferAllocator::warmUp(AllocArg &argument) {
+    ExynosLogFunctionTrace();
+
+    if (mWarmPool.get() == nullptr) {
+        /* disabled */
+        return std::make_pair(EXYNOS_ERROR_NONE, nullptr);
+    }
+
+    auto shBlockPool = GET_SHARED_PTR(mBlockPool);
+    if (!CHECK_SHARED_PTR(shBlockPool)) {
+        return std::make_pair(EXYNOS_ERROR_BAD_STATE, nullptr);
+    }
+
+    auto key = getWarmPoolKey(argument);
+
+    /* blocks kept from the previous geometry are useless */
+    int32_t idleCount = (int32_t)mWarmPool->prepare(key);
+    int32_t count = 0;
+
+    for (; (idleCount + count) < argument.warmUpCount; count++) {
+        BufferWarmPool::Block block;
+
+        c2_status_t err = fetchBlock(shBlockPool, key, block, false);
+        if (err != C2_OK) {
+            /* the rest will be fetched on demand */
+            ExynosLogW("[%s] fetch is failed : 0x%x", __FUNCTION__, err);
+            break;
+        }
+
+        if (!mWarmPool->put(key, std::move(block))) {
+            /* full */
+            break;
+        }
+    }
+
+    ExynosLogD("[%s] warm pool : prepared(%d), idle(%d), requested(%d) : width(%d), height(%d), format(0x%x)",
+                __FUNCTION__, count, idleCount, argument.warmUpCount, key.width, key.height, key.format);
+
+    return std::make_pair(EXYNOS_ERROR_NONE, nullptr);
+}
+
+BufferWarmPool::Key ExynosBufferAllocator::getWarmPoolKey(const AllocArg &argument) {
+    if (std::holds_alternative<LinearBufferAttribute>(argument.attr)) {
+        auto attribute = std::get<LinearBufferAttribute>(argument.attr);
+
+        return { attribute.mSize + HW_EXTRA_BYTES, 0, 0, mUsage.expected };
+    }
+
+    auto attribute = std::get<GraphicBufferAttribute>(argument.attr);
+
+    if (mUsage.expected & VendorC2Config::MAY_CPU_READ) {
+        mUsage.expected = mUsage.expected & (~VendorC2Config::MAY_CPU_READ);
+
+        /* if output is not compressed format, CPU could read output */
+        if (!ExynosUtils::CheckCompressedFormat(attribute.mFormat)) {
+            mUsage.expected = mUsage.expected | C2MemoryUsage::CPU_READ;
+        }
+    }
+
+    mUsage.expected = mUsage.expected | attribute.mUsage;
+
+    return { attribute.mWidth, attribute.mHeight, attribute.mFormat, mUsage.expected };
+}
+
+c2_status_t ExynosBufferAllocator::fetchBlock(
+    std::shared_ptr<C2BlockPool>    blockPool,
+    const BufferWarmPool::Key      &key,
+    BufferWarmPool::Block          &block,
+    bool                            useWarmPool) {
+    if ((useWarmPool == true) &&
+        (mWarmPool.get() != nullptr)) {
+        auto pooled = mWarmPool->get(key);
+        if (pooled) {
+            block = std::move(*pooled);
+            return C2_OK;
+        }
+    }
+
+    auto fetch = [&]()->c2_status_t {
+                    c2_status_t err = C2_OK;
+
+                    if (key.height == 0) {
+                        std::shared_ptr<C2LinearBlock> c2block = nullptr;
+
+                        err = blockPool->fetchLinearBlock(key.width, mUsage, &c2block);
+                        block = c2block;
+                    } else {
+                        std::shared_ptr<C2GraphicBlock> c2block = nullptr;
+
+                        err = blockPool->fetchGraphicBlock(key.width, key.height, key.format, mUsage, &c2block);
+                        block = c2block;
+                    }
+
+                    return err;
+                 };
+
+    c2_status_t err = fetch();
+
+    if ((err == C2_NO_MEMORY) &&
+        (useWarmPool == true) &&
+        (mWarmPool.get() != nullptr) &&
+        (mWarmPool->trim(0) > 0)) {
+        /* under memory pressure, idle blocks are given back and try again */
+        ExynosLogW("[%s] warm pool is trimmed due to lack of memory", __FUNCTION__);
+        err = fetch();
+    }
+
+    return err;
+}
+
 void ExynosBufferAllocator::free(std::shared_ptr<ExynosBuffer> buffer) {
     ExynosLogFunctionTrace();
 
@@ -22,7 +22,11 @@
 #include <C2Buffer.h>
 #include <C2BufferPriv.h>
 #include <memory>
+#include <chrono>
+#include <condition_variable>
+#include <optional>
 #include <variant>
+#include <vector>
 #include <utility>
 
 #include "ExynosDef.h"
@@ -37,6 +41,7 @@ class BufferCount {
 public:
     BufferCount() {
         count = 0;
+        released = 0;
     }
 
     ~BufferCount() = default;
@@ -54,12 +59,179 @@ public:
     int dec() {
         std::lock_guard<std::mutex> lock(mutex);
 
+        released++;
+        signal.notify_all();
+
         return --count;
     }
 
+    /* number of releases so far. it is used as a starting point of waitRelease() */
+    uint64_t getReleased() {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        return released;
+    }
+
+    /* waits for any buffer to be released after 'since' */
+    bool waitRelease(uint64_t since, std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        return signal.wait_for(lock, timeout, [&]()->bool { return (released != since); });
+    }
+
 private:
     std::mutex mutex;
+    std::condition_variable signal;
     int count;
+    uint64_t released;
+};
+
+/*
+ * blocks which are fetched but not handed over to the client.
+ * it keeps blocks of the current geometry only,
+ * they are reused without fetching from the block pool(ex, after flush).
+ */
+class BufferWarmPool {
+public:
+    using Block = std::variant<std::shared_ptr<C2LinearBlock>, std::shared_ptr<C2GraphicBlock>>;
+
+    struct Key {
+        uint32_t width;  /* capacity on linear */
+        uint32_t height; /* 0 on linear */
+        uint32_t format;
+        uint64_t usage;
+
+        bool operator==(const Key &other) const {
+            return ((width == other.width) && (height == other.height) &&
+                    (format == other.format) && (usage == other.usage));
+        }
+
+        bool operator!=(const Key &other) const {
+            return !(*this == other);
+        }
+    };
+
+    BufferWarmPool(size_t maxIdleCnt) : mKey{}, mMaxIdleCnt(maxIdleCnt), mHitCnt(0), mMissCnt(0) {}
+
+    ~BufferWarmPool() {
+        invalidateMapping(mBlocks);
+    }
+
+    /* blocks of other geometry are dropped. returns number of idle blocks */
+    size_t prepare(const Key &key) {
+        std::vector<Block> dropped;
+        size_t idleCnt = 0;
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            switchKey(key, dropped);
+            idleCnt = mBlocks.size();
+        }
+
+        invalidateMapping(dropped);
+
+        return idleCnt;
+    }
+
+    std::optional<Block> get(const Key &key) {
+        std::vector<Block> dropped;
+        std::optional<Block> ret = std::nullopt;
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            switchKey(key, dropped);
+
+            if (mBlocks.empty()) {
+                mMissCnt++;
+            } else {
+                mHitCnt++;
+
+                ret = std::move(mBlocks.back());
+                mBlocks.pop_back();
+            }
+        }
+
+        invalidateMapping(dropped);
+
+        return ret;
+    }
+
+    /* false if it is not taken. then, the block is freed by the caller */
+    bool put(const Key &key, Block &&block) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if ((key != mKey) ||
+            (mBlocks.size() >= mMaxIdleCnt)) {
+            return false;
+        }
+
+        mBlocks.push_back(std::move(block));
+
+        return true;
+    }
+
+    /* returns number of dropped blocks */
+    size_t trim(size_t keepCnt) {
+        std::vector<Block> dropped;
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            while (mBlocks.size() > keepCnt) {
+                dropped.push_back(std::move(mBlocks.back()));
+                mBlocks.pop_back();
+            }
+        }
+
+        /* blocks are freed out of the lock */
+        invalidateMapping(dropped);
+
+        return dropped.size();
+    }
+
+    void getStatistics(uint64_t &hit, uint64_t &miss) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        hit  = mHitCnt;
+        miss = mMissCnt;
+    }
+
+private:
+    /* blocks leave the pool. their mappings should not pin the memory */
+    static void invalidateMapping(std::vector<Block> &blocks) {
+        for (auto &block : blocks) {
+            const C2Handle *handle = std::visit([](auto &c2block)->const C2Handle* {
+                                                    return (c2block.get() != nullptr)? c2block->handle():nullptr;
+                                                }, block);
+            if (handle == nullptr) {
+                continue;
+            }
+
+            for (int i = 0; i < handle->numFds; i++) {
+                auto ino = ExynosMapCache::getStIno(handle->data[i]);
+                if (ino != 0) {
+                    ExynosMapCache::getInstance().invalidate(ino);
+                }
+            }
+        }
+    }
+
+    void switchKey(const Key &key, std::vector<Block> &dropped) {
+        if (key != mKey) {
+            /* geometry is changed. blocks are freed by the caller out of the lock */
+            dropped.swap(mBlocks);
+            mKey = key;
+        }
+    }
+
+    std::mutex mMutex;
+    std::vector<Block> mBlocks;
+    Key mKey;
+    size_t mMaxIdleCnt;
+    uint64_t mHitCnt;
+    uint64_t mMissCnt;
 };
 
 class ExynosBufferAllocator : public ExynosLog {
@@ -78,14 +250,33 @@ public:
     static android::C2PlatformAllocatorStore::id_t getAllocatorID(android::C2PlatformAllocatorStore::id_t allocStoreID);
     static std::shared_ptr<ExynosBufferAllocator> makeAllocator(std::shared_ptr<const C2Component> component, android::C2PlatformAllocatorStore::id_t allocStoreID, C2BlockPool::local_id_t poolID, C2MemoryUsage usage, std::shared_ptr<C2BlockPool> *blockPool);
 
+    /* buffers allocated from now on have mappings owned by the owner, see ExynosMapCache::drop() */
+    void setMapOwner(uint64_t owner) {
+        mMapOwner = owner;
+    }
+
+    /* gives idle blocks in the warm pool back except for keepCnt */
+    void trimWarmPool(size_t keepCnt = 0) {
+        if (mWarmPool.get() != nullptr) {
+            mWarmPool->trim(keepCnt);
+        }
+    }
+
 private:
     ExynosBufferAllocator(std::shared_ptr<C2BlockPool> blockPool, android::C2PlatformAllocatorStore::id_t allocStoreID, C2MemoryUsage usage);
 
+    BufferAllocRetType warmUp(AllocArg &argument);
+    BufferWarmPool::Key getWarmPoolKey(const AllocArg &argument);
+    c2_status_t fetchBlock(std::shared_ptr<C2BlockPool> blockPool, const BufferWarmPool::Key &key,
+                           BufferWarmPool::Block &block, bool useWarmPool);
+
     std::weak_ptr<C2BlockPool>                  mBlockPool;
     android::C2PlatformAllocatorStore::id_t     mAllocStoreID;
     C2MemoryUsage                               mUsage;
 
     std::shared_ptr<BufferCount> mBufferCount;
+    std::shared_ptr<BufferWarmPool> mWarmPool;  /* nullptr if it is disabled */
+    uint64_t mMapOwner = 0;
 
     /* disable default constructor */
     ExynosBufferAllocator() = delete;
@@ -40,58 +40,43 @@ fds_t BufferFdManager::getFixedFds(std::shared_ptr<ExynosBuffer> buffer) {
         StaticExynosLog(Level::Trace, "BufferFdManager", "[%s] buffer info : fd(%d)", __FUNCTION__, nFD[i]);
     }
 
-    auto optKey = buffer->getStIno();
-    if (!optKey) {
-        fds.key = getStIno(nFD[0]);
-        buffer->setStIno(fds.key);
-    } else {
-        fds.key = *optKey;
-    }
+    fds.key = getKey(buffer);
 
     int count = 0;
 
-    if (mFdMap.size() > GARBAGE_CLEANUP_BASELINE) {
-        /* clear reserved FDs */
-        int cnt = 0;
-
-        for (auto it = mFdMap.begin(); it != mFdMap.end(); ) {
-            if (it->second.dupCount > 0) {
-                it++;
-                continue;
-            }
-
-            for (int i = 0; i < it->second.plane; i++) {
-                close(it->second.fd[i]);
-            }
-
-            it = mFdMap.erase(it);
-            cnt++;
-        }
-
-        StaticExynosLog(Level::Trace, "BufferFdManager", "[%s] clear reserved FDs (%d)", __FUNCTION__, cnt);
-    }
-
     auto search = mFdMap.find(fds.key);
     if (search == mFdMap.end()) {
+        mMissCnt++;
+
         fds.plane = plane;
         count = fds.dupCount = 1;
         for (int i = 0; i< fds.plane; i++) {
             fds.fd[i] = dup(nFD[i]);
         }
-        mFdMap.emplace(fds.key, fds);
+
+        fd_entry entry;
+        entry.fds  = fds;
+        entry.idle = false;
+        mFdMap.emplace(fds.key, entry);
     } else {
-        fds.plane = search->second.plane;
-        for (int i = 0; i < search->second.plane; i++) {
-            if (fixedFd(nFD[i], search->second.fd[i]) >= 0) {
-                fds.fd[i] = search->second.fd[i];
+        mHitCnt++;
+
+        auto &entry = search->second;
+
+        fds.plane = entry.fds.plane;
+        for (int i = 0; i < entry.fds.plane; i++) {
+            if (fixedFd(nFD[i], entry.fds.fd[i]) >= 0) {
+                fds.fd[i] = entry.fds.fd[i];
             } else {
-                StaticExynosLog(Level::Trace, "BufferFdManager", "[%s] Someone intercepted fd:%d.", __FUNCTION__, search->second.fd[i]);
-                fds.fd[i] = search->second.fd[i] = dup(nFD[i]);
-                StaticExynosLog(Level::Trace, "BufferFdManager", "[%s] New fixed fd:%d.", __FUNCTION__, search->second.fd[i]);
+                StaticExynosLog(Level::Trace, "BufferFdManager", "[%s] Someone intercepted fd:%d.", __FUNCTION__, entry.fds.fd[i]);
+                fds.fd[i] = entry.fds.fd[i] = dup(nFD[i]);
+                StaticExynosLog(Level::Trace, "BufferFdManager", "[%s] New fixed fd:%d.", __FUNCTION__, entry.fds.fd[i]);
             }
         }
-        search->second.dupCount++;
-        count = search->second.dupCount;
+
+        setBusy(entry);
+        entry.fds.dupCount++;
+        count = entry.fds.dupCount;
     }
 
     StaticExynosLog(Level::Trace, "BufferFdManager", "[%s] getFixedFds inode number:%zu, fd[0]:%d, fd[1]:%d, fd[2]:%d, plane:%d, mapSize:%zu, dupCount:%d",
@@ -103,27 +88,28 @@ fds_t BufferFdManager::getFixedFds(std::shared_ptr<ExynosBuffer> buffer) {
 void BufferFdManager::returnFixedFds(uint64_t key) {
     auto search = mFdMap.find(key);
     if (search != mFdMap.end()) {
-        if (search->second.dupCount == 1) {
-            for (int i = 0; i < search->second.plane; i++) {
-                if (fixedFd(STDOUT_FILENO, search->second.fd[i]) < 0) {
-                    search->second.fd[i] = -1;
+        auto &entry = search->second;
 
-                    for (int i = 0; i < search->second.plane; i++) {
-                        if (search->second.fd[i] >= 0)
-                            close(search->second.fd[i]);
-                    }
+        if (entry.fds.dupCount == 1) {
+            for (int i = 0; i < entry.fds.plane; i++) {
+                if (fixedFd(STDOUT_FILENO, entry.fds.fd[i]) < 0) {
+                    entry.fds.fd[i] = -1;
 
-                    mFdMap.erase(search);
+                    closeEntry(search);
                     StaticExynosLog(Level::Trace, "BufferFdManager", "[%s] Someone intercepted fd. keep failed.", __FUNCTION__);
 
                     return;
                 }
             }
         }
-        search->second.dupCount--;
-        search->second.dupCount = (search->second.dupCount < 0) ? 0 : search->second.dupCount;
+        entry.fds.dupCount--;
+        entry.fds.dupCount = (entry.fds.dupCount < 0) ? 0 : entry.fds.dupCount;
 
-        StaticExynosLog(Level::Trace, "BufferFdManager", "[%s] returnFixedFds inode number:%zu, dupCount:%d", __FUNCTION__, key, search->second.dupCount);
+        StaticExynosLog(Level::Trace, "BufferFdManager", "[%s] returnFixedFds inode number:%zu, dupCount:%d", __FUNCTION__, key, entry.fds.dupCount);
+
+        if (entry.fds.dupCount == 0) {
+            setIdle(key, entry);
+        }
     }
 }
 
@@ -133,33 +119,76 @@ void BufferFdManager::returnFixedFds(std::shared_ptr<ExynosBuffer> buffer) {
         return;
     }
 
-    auto handle = buffer->handle();
-    auto plane = buffer->plane();
-    unsigned long nFD[BASE_BUFFER_MAX_PLANES] = {0, 0, 0};
+    returnFixedFds(getKey(buffer));
+}
 
-    for (int i = 0; i < plane; i++) {
-        nFD[i]       = handle->data[i];
-        StaticExynosLog(Level::Trace, "BufferFdManager", "[%s] output buffer info : fd(%d)", __FUNCTION__, nFD[i]);
+void BufferFdManager::allFdClear() {
+    StaticExynosLog(Level::Trace, "[%s] BufferFdManager", "[%s] allFdClear++", __FUNCTION__);
+    while (!mFdMap.empty()) {
+        closeEntry(mFdMap.begin());
     }
+    StaticExynosLog(Level::Trace, "BufferFdManager", "[%s] allFdClear--", __FUNCTION__);
+}
 
-    struct stat statInfo;
-    fstat(nFD[0], &statInfo);
-    uint64_t key = (uint64_t)statInfo.st_ino;
+void BufferFdManager::getStatistics(uint64_t &hit, uint64_t &miss) {
+    hit  = mHitCnt;
+    miss = mMissCnt;
+}
+
+uint64_t BufferFdManager::getKey(std::shared_ptr<ExynosBuffer> buffer) {
+    /* the identity is kept in buffer after the first lookup */
+    auto optKey = buffer->getStIno();
+    if (optKey) {
+        return *optKey;
+    }
 
-    returnFixedFds(key);
+    auto key = getStIno(buffer->handle()->data[0]);
+    buffer->setStIno(key);
+
+    return key;
 }
 
-void BufferFdManager::allFdClear() {
-    StaticExynosLog(Level::Trace, "[%s] BufferFdManager", "[%s] allFdClear++", __FUNCTION__);
-    if (mFdMap.size() > 0) {
-        for (auto it = mFdMap.begin(); it != mFdMap.end(); ) {
-            for (int i = 0; i < it->second.plane; i++) {
-                close(it->second.fd[i]);
-            }
-            it = mFdMap.erase(it);
+void BufferFdManager::setIdle(uint64_t key, fd_entry &entry) {
+    if (entry.idle) {
+        return;
+    }
+
+    entry.idle    = true;
+    entry.idlePos = mIdleList.insert(mIdleList.end(), key);
+
+    /* release the least recently used one instead of sweeping all */
+    while (mIdleList.size() > GARBAGE_CLEANUP_BASELINE) {
+        auto victim = mFdMap.find(mIdleList.front());
+        if (victim == mFdMap.end()) {
+            mIdleList.pop_front();
+            continue;
         }
+
+        StaticExynosLog(Level::Trace, "BufferFdManager", "[%s] clear reserved FDs of inode:%zu", __FUNCTION__, victim->first);
+        closeEntry(victim);
     }
-    StaticExynosLog(Level::Trace, "BufferFdManager", "[%s] allFdClear--", __FUNCTION__);
+}
+
+void BufferFdManager::setBusy(fd_entry &entry) {
+    if (!entry.idle) {
+        return;
+    }
+
+    mIdleList.erase(entry.idlePos);
+    entry.idle = false;
+}
+
+void BufferFdManager::closeEntry(std::map<uint64_t, fd_entry>::iterator it) {
+    auto &entry = it->second;
+
+    for (int i = 0; i < entry.fds.plane; i++) {
+        if (entry.fds.fd[i] >= 0)
+            close(entry.fds.fd[i]);
+    }
+
+    setBusy(entry);
+    ExynosMapCache::getInstance().invalidate(it->first);
+    mFdMap.erase(it);
 }
 
 int BufferFdManager::fixedFd(int orgFd, int targetFd) {
@@ -184,21 +213,96 @@ int BufferFdManager::fixedFd(int orgFd, int targetFd) {
 }
 
 uint64_t BufferFdManager::getStIno(int fd) {
-    struct stat statInfo;
+    return ExynosMapCache::getStIno(fd);
+}
+
+
+/* index is stored with +1, so that a handle is never nullptr */
+static inline void* makeSwapHandle(int index, uint32_t generation) {
+    return (void *)(uintptr_t)((generation << SWAP_HANDLE_INDEX_BITS) | (uint32_t)(index + 1));
+}
+
+void SharedPtrManager::initSlab() {
+    mSlab.clear();
+    mSlab.reserve(SWAP_SLAB_DEFAULT_CNT);
+    mFreeHead = -1;
+    mUsedCnt  = 0;
+}
+
+void* SharedPtrManager::allocSwapData(std::shared_ptr<ExynosBuffer> shPtr, ExynosParams *params) {
+    int index = mFreeHead;
+
+    if (index < 0) {
+        if (mSlab.size() >= SWAP_HANDLE_INDEX_MASK) {
+            StaticExynosLog(Level::Error, "SharedPtrManager", "[%s] swap records are exhausted(%zu)", __FUNCTION__, mSlab.size());
+            return nullptr;
+        }
+
+        if (mSlab.size() == mSlab.capacity()) {
+            StaticExynosLog(Level::Warning, "SharedPtrManager", "[%s] swap records are grown over %zu", __FUNCTION__, mSlab.size());
+        }
 
-    fstat(fd, &statInfo);
+        mSlab.emplace_back();
+        index = (int)mSlab.size() - 1;
 
-    return (uint64_t)statInfo.st_ino;
+        mSlab[index].generation = 0;
+    } else {
+        mFreeHead = mSlab[index].nextFree;
+    }
+
+    auto &swapData = mSlab[index];
+
+    swapData.mShPtr   = std::move(shPtr);
+    swapData.nextFree = -1;
+    swapData.used     = true;
+
+    if (params != nullptr) {
+        swapData.params = std::move(*params);
+    }
+
+    mUsedCnt++;
+
+    return makeSwapHandle(index, swapData.generation);
 }
 
+SharedPtrManager::swap_data* SharedPtrManager::getSwapData(void *handle) {
+    uint32_t value = (uint32_t)(uintptr_t)handle;
+    int index = (int)(value & SWAP_HANDLE_INDEX_MASK) - 1;
+
+    if ((index < 0) ||
+        (index >= (int)mSlab.size())) {
+        StaticExynosLog(Level::Error, "SharedPtrManager", "[%s] invalid handle(%p)", __FUNCTION__, handle);
+        return nullptr;
+    }
+
+    auto &swapData = mSlab[index];
+
+    if ((!swapData.used) ||
+        (makeSwapHandle(index, swapData.generation) != handle)) {
+        StaticExynosLog(Level::Warning, "SharedPtrManager", "[%s] stale handle(%p)", __FUNCTION__, handle);
+        return nullptr;
+    }
+
+    return &swapData;
+}
+
+void SharedPtrManager::freeSwapData(swap_data &swapData) {
+    int index = (int)(&swapData - mSlab.data());
+
+    swapData.mShPtr.reset();
+    swapData.params = ExynosParams();
+    swapData.used   = false;
+    swapData.generation++;  /* handles given before become stale */
+
+    swapData.nextFree = mFreeHead;
+    mFreeHead = index;
+
+    mUsedCnt--;
+}
 
 void* SharedPtrManager::swapSharedPtrToPtr(std::shared_ptr<ExynosBuffer> shPtr, fds_t &fds) {
     std::lock_guard<std::mutex> lock(mMutex);
-    if (shPtr.get() != nullptr) {
-        auto swapData = std::make_shared<swap_data>();
-        swapData.get()->mShPtr = shPtr;
-        mQueue.enqueue((uint64_t)shPtr.get(), swapData);
-    }
+    void *handle = nullptr;
 
     memset(&fds, 0, sizeof(fds));
 
@@ -206,18 +310,16 @@ void* SharedPtrManager::swapSharedPtrToPtr(std::shared_ptr<ExynosBuffer> shPtr,
         fds = getFixedFds(shPtr);
     }
 
-    return static_cast<void*>(shPtr.get());
+    if (shPtr.get() != nullptr) {
+        handle = allocSwapData(std::move(shPtr), nullptr);
+    }
+
+    return handle;
 }
 
 void* SharedPtrManager::swapSharedPtrToPtr(std::shared_ptr<ExynosBuffer> shPtr, fds_t &fds, ExynosParams params) {
     std::lock_guard<std::mutex> lock(mMutex);
-    if (shPtr.get() != nullptr) {
-        auto swapData = std::make_shared<swap_data>();
-        swapData.get()->mShPtr = shPtr;
-        swapData.get()->params = params;
-
-        mQueue.enqueue((uint64_t)shPtr.get(), swapData);
-    }
+    void *handle = nullptr;
 
     memset(&fds, 0, sizeof(fds));
 
@@ -225,19 +327,22 @@ void* SharedPtrManager::swapSharedPtrToPtr(std::shared_ptr<ExynosBuffer> shPtr,
         fds = getFixedFds(shPtr);
     }
 
-    return static_cast<void*>(shPtr.get());
+    if (shPtr.get() != nullptr) {
+        handle = allocSwapData(std::move(shPtr), &params);
+    }
+
+    return handle;
 }
 
 std::shared_ptr<ExynosBuffer> SharedPtrManager::swapPtrToSharedPtr(void *ptr, bool bDelayReturn) {
     std::lock_guard<std::mutex> lock(mMutex);
-    std::shared_ptr<swap_data> swapData = nullptr;
     std::shared_ptr<ExynosBuffer> shPtr = nullptr;
 
     if (ptr != nullptr) {
-        if (true == mQueue.dequeue((uint64_t)ptr, swapData)) {
-            if (swapData.get() != nullptr) {
-                shPtr = swapData.get()->mShPtr;
-            }
+        auto swapData = getSwapData(ptr);
+        if (swapData != nullptr) {
+            shPtr = std::move(swapData->mShPtr);
+            freeSwapData(*swapData);
         }
     }
 
@@ -256,15 +361,14 @@ EXIT:
 
 std::shared_ptr<ExynosBuffer> SharedPtrManager::swapPtrToSharedPtr(void *ptr, ExynosParams &params, bool bDelayReturn) {
     std::lock_guard<std::mutex> lock(mMutex);
-    std::shared_ptr<swap_data> swapData = nullptr;
     std::shared_ptr<ExynosBuffer> shPtr = nullptr;
 
     if (ptr != nullptr) {
-        if (true == mQueue.dequeue((uint64_t)ptr, swapData)) {
-            if (swapData.get() != nullptr) {
-                shPtr = swapData.get()->mShPtr;
-                params = swapData.get()->params;
-            }
+        auto swapData = getSwapData(ptr);
+        if (swapData != nullptr) {
+            shPtr  = std::move(swapData->mShPtr);
+            params = std::move(swapData->params);
+            freeSwapData(*swapData);
         }
     }
 
@@ -283,10 +387,16 @@ EXIT:
 
 void SharedPtrManager::eraseSharedPtr(std::shared_ptr<ExynosBuffer> shPtr) {
     std::lock_guard<std::mutex> lock(mMutex);
-    std::shared_ptr<swap_data> temp = nullptr;
 
+    /* it is not on the frame path(ex, failure of queueing), so that records are searched */
     if (shPtr != nullptr) {
-        mQueue.dequeue((uint64_t)shPtr.get(), temp);
+        for (auto &swapData : mSlab) {
+            if ((swapData.used) &&
+                (swapData.mShPtr == shPtr)) {
+                freeSwapData(swapData);
+                break;
+            }
+        }
     }
 
     if (mFixedFDEnable == true) {
@@ -296,8 +406,12 @@ void SharedPtrManager::eraseSharedPtr(std::shared_ptr<ExynosBuffer> shPtr) {
 
 void SharedPtrManager::reset() {
     std::lock_guard<std::mutex> lock(mMutex);
-    mQueue.clear();
 
+    for (auto &swapData : mSlab) {
+        if (swapData.used) {
+            freeSwapData(swapData);
+        }
+    }
 
     if (mFixedFDEnable == true) {
         allFdClear();
@@ -306,7 +420,7 @@ void SharedPtrManager::reset() {
 
 int SharedPtrManager::size() {
     std::lock_guard<std::mutex> lock(mMutex);
-    return mQueue.size();
+    return mUsedCnt;
 }
 
 int SharedPtrManager::refSize() {
@@ -314,6 +428,7 @@ int SharedPtrManager::refSize() {
 }
 
 void SharedPtrManager::delayReturn(uint64_t key) {
+    std::lock_guard<std::mutex> lock(mMutex);
     if (mFixedFDEnable == true) {
         returnFixedFds(key);
     }
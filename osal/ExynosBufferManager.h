@@ -21,18 +21,23 @@
 #include <mutex>
 #include <atomic>
 #include <map>
+#include <list>
+#include <vector>
 #include <sys/mman.h>
 
 #include "ExynosQueue.h"
 #include "ExynosMutex.h"
 #include "ExynosDef.h"
 #include "ExynosBuffer.h"
+#include "ExynosMapCache.h"
 
 #define LOG_ON
 #include "ExynosLog.h"
 
 #define MAX_PLANE 3
 
+#define SWAP_HANDLE_INDEX_MASK ((1u << SWAP_HANDLE_INDEX_BITS) - 1)  /* also the max number of swap records */
+
 typedef struct fds_t {
     int dupCount;
     int plane;
@@ -53,27 +58,49 @@ public:
     void returnFixedFds(uint64_t key);
     void returnFixedFds(std::shared_ptr<ExynosBuffer> buffer);
     void allFdClear();
+    void getStatistics(uint64_t &hit, uint64_t &miss);
     static uint64_t getStIno(int fd);
 
 private:
+    typedef struct fd_entry_t {
+        fds_t fds;
+        bool  idle;
+        std::list<uint64_t>::iterator idlePos;
+    } fd_entry;
+
     int fixedFd(int orgFd, int targetFd);
+    uint64_t getKey(std::shared_ptr<ExynosBuffer> buffer);
+    void setIdle(uint64_t key, fd_entry &entry);
+    void setBusy(fd_entry &entry);
+    void closeEntry(std::map<uint64_t, fd_entry>::iterator it);
+
+    std::map<uint64_t, fd_entry> mFdMap;
+    std::list<uint64_t> mIdleList;  /* entries of which dupCount is 0. front is the least recently used */
 
-    std::map<uint64_t, fds_t> mFdMap;
+    uint64_t mHitCnt = 0;
+    uint64_t mMissCnt = 0;
 };
 
 
+/*
+ * ExynosBuffer is passed to video API as a handle of the swap record instead of the raw pointer.
+ * records are kept in a slab and recycled, so that the conversion doesn't allocate or hash.
+ * handle has the generation of record, a handle which is released(ex, flush) is detected as stale.
+ */
 class SharedPtrManager : public BufferFdManager {
 public:
     SharedPtrManager() {
         mFixedFDEnable = false;
+        initSlab();
     }
 
     SharedPtrManager(bool bFixedFDEnable) {
         mFixedFDEnable = bFixedFDEnable;
+        initSlab();
     }
 
     virtual ~SharedPtrManager() {
-        mQueue.clear();
+        mSlab.clear();
     }
 
     virtual void* swapSharedPtrToPtr(std::shared_ptr<ExynosBuffer> shPtr, fds_t &fds);
@@ -92,11 +119,22 @@ private:
     typedef struct  swap_data_t {
         std::shared_ptr<ExynosBuffer> mShPtr;
         ExynosParams params;
+        uint32_t generation;
+        int      nextFree;   /* -1 if it is in use or the last one */
+        bool     used;
     } swap_data;
 
+    /* mMutex should be held */
+    void initSlab();
+    void* allocSwapData(std::shared_ptr<ExynosBuffer> shPtr, ExynosParams *params);
+    swap_data* getSwapData(void *handle);
+    void freeSwapData(swap_data &swapData);
+
     bool mFixedFDEnable;
 
-    ExynosMap<uint64_t, std::shared_ptr<swap_data>> mQueue;
+    std::vector<swap_data> mSlab;
+    int mFreeHead;
+    int mUsedCnt;
 };
 
 #endif // EXYNOS_BUFFER_MANAGER_H
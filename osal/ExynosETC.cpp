@@ -291,6 +291,8 @@ void ExynosUtils::GetYUVPlaneInfo(
     }
         break;
 /* user format */
+    case HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_SP:  /* single-fd NV12, same size as NV21 */
+        [[fallthrough]];
     case HAL_PIXEL_FORMAT_YCrCb_420_SP:
     {
         int stride  = ALIGN(width, 2);
@@ -299,6 +301,8 @@ void ExynosUtils::GetYUVPlaneInfo(
                         + HW_EXTRA_BYTES;
     }
         break;
+    case HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_P:  /* single-fd I420, same size as YV12 */
+        [[fallthrough]];
     case HAL_PIXEL_FORMAT_YV12:
     {
 #ifdef YV12_ALIGN
@@ -402,6 +406,8 @@ void ExynosUtils::GetYUVImageInfo(
     }
         break;
 /* user format */
+    case HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_SP:  /* single-fd NV12, same size as NV21 */
+        [[fallthrough]];
     case HAL_PIXEL_FORMAT_YCrCb_420_SP:
     {
         int stride  = ALIGN(width, 2);
@@ -409,6 +415,8 @@ void ExynosUtils::GetYUVImageInfo(
         size[0]     = ((stride * height) + (stride * height / 2));
     }
         break;
+    case HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_P:  /* single-fd I420, same size as YV12 */
+        [[fallthrough]];
     case HAL_PIXEL_FORMAT_YV12:
     {
 #ifdef YV12_ALIGN
@@ -530,8 +538,12 @@ int ExynosUtils::GetPlaneCnt(int format) {
         [[fallthrough]];
     case HAL_PIXEL_FORMAT_EXYNOS_420_SPN_10B_64_SBWC_L:
         [[fallthrough]];
+    case HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_SP:
+        [[fallthrough]];
     case HAL_PIXEL_FORMAT_YCrCb_420_SP:
         [[fallthrough]];
+    case HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_P:
+        [[fallthrough]];
     case HAL_PIXEL_FORMAT_YV12:
         [[fallthrough]];
     case HAL_PIXEL_FORMAT_YCBCR_P010:
@@ -564,6 +576,8 @@ int ExynosUtils::GetImagePlaneCnt(int format) {
         [[fallthrough]];
     case HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_PN:
         [[fallthrough]];
+    case HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_P:
+        [[fallthrough]];
     case HAL_PIXEL_FORMAT_YV12:
     {
         cnt = 3;
@@ -1070,3 +1084,73 @@ uint64_t ExynosUtils::GetUsageType() {
 
     return val;
 }
+
+bool ExynosUtils::GetSWCSCSimdType() {
+    bool val = property_get_bool("vendor.debug.c2.csc.simd.disable", false);
+
+    return !val;
+}
+
+uint32_t ExynosUtils::GetSWCSCThreadCnt() {
+    int val = property_get_int32("vendor.debug.c2.csc.threads", SW_CSC_DEFAULT_THREAD_CNT);
+
+    return (val > 0)? val:1;
+}
+
+uint32_t ExynosUtils::GetSWCSCStripeHeight() {
+    int val = property_get_int32("vendor.debug.c2.csc.stripe", SW_CSC_DEFAULT_STRIPE_HEIGHT);
+
+    return (val > 0)? val:SW_CSC_DEFAULT_STRIPE_HEIGHT;
+}
+
+uint32_t ExynosUtils::GetWorkDoneBatchTime() {
+    int val = property_get_int32("vendor.debug.c2.workdone.batch", WORK_DONE_BATCH_DEFAULT_TIME);
+
+    return (val > 0)? val:0;
+}
+
+uint32_t ExynosUtils::GetAllocWaitTimeout() {
+    int val = property_get_int32("vendor.debug.c2.alloc.timeout", ALLOC_WAIT_DEFAULT_TIMEOUT);
+
+    return (val > 0)? val:ALLOC_WAIT_DEFAULT_TIMEOUT;
+}
+
+bool ExynosUtils::GetStageStatEnable() {
+    return property_get_bool("vendor.debug.c2.stat.enable", false);
+}
+
+uint32_t ExynosUtils::GetToneMappingMode() {
+    int val = property_get_int32("vendor.debug.c2.tonemap.mode", TONE_MAPPING_MODE_AUTO);
+
+    return ((val >= TONE_MAPPING_MODE_AUTO) && (val <= TONE_MAPPING_MODE_CPU))? val:TONE_MAPPING_MODE_AUTO;
+}
+
+uint32_t ExynosUtils::GetToneMappingThreadCnt() {
+    int val = property_get_int32("vendor.debug.c2.tonemap.threads", TONE_MAPPING_DEFAULT_THREAD_CNT);
+
+    return (val > 0)? val:1;
+}
+
+uint32_t ExynosUtils::GetToneMappingInFlightCnt() {
+    int val = property_get_int32("vendor.debug.c2.tonemap.inflight", TONE_MAPPING_DEFAULT_IN_FLIGHT_CNT);
+
+    return (val > 0)? val:1;
+}
+
+bool ExynosUtils::GetWarmPoolType() {
+    bool val = property_get_bool("vendor.debug.c2.warmpool.disable", false);
+
+    return !val;
+}
+
+uint32_t ExynosUtils::GetWarmPoolExtraCnt() {
+    int val = property_get_int32("vendor.debug.c2.warmpool.extra", WARM_POOL_DEFAULT_EXTRA_CNT);
+
+    return (val > 0)? val:0;
+}
+
+bool ExynosUtils::GetEncFastDRCType() {
+    bool val = property_get_bool("vendor.debug.c2.enc.fastdrc.enable", false);
+
+    return val;
+}
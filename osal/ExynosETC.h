@@ -314,6 +314,18 @@ namespace ExynosUtils {
     uint32_t GetMinQuality();
     bool GetFilmgrainType();
     uint64_t GetUsageType();
+    bool GetSWCSCSimdType();
+    uint32_t GetSWCSCThreadCnt();
+    uint32_t GetSWCSCStripeHeight();
+    uint32_t GetWorkDoneBatchTime();
+    uint32_t GetAllocWaitTimeout();
+    bool GetStageStatEnable();
+    uint32_t GetToneMappingMode();
+    uint32_t GetToneMappingThreadCnt();
+    uint32_t GetToneMappingInFlightCnt();
+    bool GetWarmPoolType();
+    uint32_t GetWarmPoolExtraCnt();
+    bool GetEncFastDRCType();
 }; // namespace ExynosUtils
 
 #endif // EXYNOS_ETC_H
@@ -0,0 +1,150 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EXYNOS_FLAT_MAP_H
+#define EXYNOS_FLAT_MAP_H
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "ExynosMemoryPool.h"
+
+/*
+ * map on a vector sorted by key.
+ * it is for a few entries which are copied and merged often(ex, params of a frame),
+ * entries are in a block, so that a copy is an allocation and a lookup does not chase nodes.
+ * an iterator is invalidated by insertion, unlike std::map.
+ */
+template<typename Key, typename Value, size_t InitialCapacity = 8>
+class ExynosFlatMap {
+public:
+    using value_type     = std::pair<Key, Value>;
+    using container_type = std::vector<value_type, ExynosPoolAllocator<value_type>>;
+    using iterator       = typename container_type::iterator;
+    using const_iterator = typename container_type::const_iterator;
+
+    ExynosFlatMap() = default;
+    ~ExynosFlatMap() = default;
+
+    ExynosFlatMap(const ExynosFlatMap&) = default;
+    ExynosFlatMap(ExynosFlatMap&&) noexcept = default;
+    ExynosFlatMap& operator=(const ExynosFlatMap&) = default;
+    ExynosFlatMap& operator=(ExynosFlatMap&&) noexcept = default;
+
+    iterator begin() { return mEntries.begin(); }
+    iterator end()   { return mEntries.end(); }
+    const_iterator begin() const { return mEntries.begin(); }
+    const_iterator end() const   { return mEntries.end(); }
+
+    bool empty() const { return mEntries.empty(); }
+    size_t size() const { return mEntries.size(); }
+
+    /* keeps its block to be refilled */
+    void clear() { mEntries.clear(); }
+
+    iterator find(const Key &key) {
+        auto it = lowerBound(mEntries.begin(), mEntries.end(), key);
+
+        return ((it != mEntries.end()) && (it->first == key))? it:mEntries.end();
+    }
+
+    const_iterator find(const Key &key) const {
+        auto it = lowerBound(mEntries.begin(), mEntries.end(), key);
+
+        return ((it != mEntries.end()) && (it->first == key))? it:mEntries.end();
+    }
+
+    /* same as std::map, second is false if the value of key is replaced */
+    template<typename V>
+    std::pair<iterator, bool> insert_or_assign(const Key &key, V &&value) {
+        auto it = lowerBound(mEntries.begin(), mEntries.end(), key);
+
+        if ((it != mEntries.end()) && (it->first == key)) {
+            it->second = std::forward<V>(value);
+            return std::make_pair(it, false);
+        }
+
+        if (mEntries.capacity() == 0) {
+            size_t pos = std::distance(mEntries.begin(), it);
+
+            mEntries.reserve(InitialCapacity);
+            it = mEntries.begin() + pos;
+        }
+
+        it = mEntries.emplace(it, key, std::forward<V>(value));
+
+        return std::make_pair(it, true);
+    }
+
+    /* values of other take precedence over own values on the same key */
+    void merge(const ExynosFlatMap &other) {
+        if (other.empty()) {
+            return;
+        }
+
+        if (empty()) {
+            mEntries = other.mEntries;
+            return;
+        }
+
+        container_type merged;
+        merged.reserve(mEntries.size() + other.mEntries.size());
+
+        auto own = mEntries.begin();
+        auto in  = other.mEntries.begin();
+
+        while ((own != mEntries.end()) && (in != other.mEntries.end())) {
+            if (own->first < in->first) {
+                merged.push_back(std::move(*own++));
+            } else {
+                if (!(in->first < own->first)) {
+                    own++;  /* the same key */
+                }
+
+                merged.push_back(*in++);
+            }
+        }
+
+        std::move(own, mEntries.end(), std::back_inserter(merged));
+        std::copy(in, other.mEntries.end(), std::back_inserter(merged));
+
+        mEntries = std::move(merged);
+    }
+
+private:
+    /* a linear scan is faster than a binary search on a few entries */
+    template<typename It>
+    static It lowerBound(It first, It last, const Key &key) {
+        if (std::distance(first, last) <= kLinearScanCnt) {
+            while ((first != last) && (first->first < key)) {
+                first++;
+            }
+
+            return first;
+        }
+
+        return std::lower_bound(first, last, key,
+                                [](const value_type &entry, const Key &k) { return (entry.first < k); });
+    }
+
+    static constexpr int kLinearScanCnt = 16;
+
+    container_type mEntries;
+};
+
+#endif // EXYNOS_FLAT_MAP_H
@@ -0,0 +1,141 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EXYNOS_IN_FLIGHT_QUEUE_H
+#define EXYNOS_IN_FLIGHT_QUEUE_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+/*
+ * works in flight between a submitter and a completer.
+ * the submitter takes a room when it takes a work(take), and hands it over after starting it(submit).
+ * the completer gets works in order of submission(pop), and returns the room after delivering it(done).
+ * a work holds its room from take() until done(), so waitIdle() returns when
+ * every work which has been taken is delivered.
+ * there should be one submitter.
+ */
+template<class T>
+class ExynosInFlightQueue {
+public:
+    ExynosInFlightQueue() = default;
+    ~ExynosInFlightQueue() = default;
+
+    /* starts a new session */
+    void start(uint32_t maxInFlight) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mMaxInFlight = (maxInFlight > 0)? maxInFlight:1;
+        mInFlightCnt = 0;
+        mClosed      = false;
+        mItems.clear();
+    }
+
+    /* no more submission, the completer returns after delivering the rest */
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mClosed = true;
+        }
+
+        mCondition.notify_all();
+    }
+
+    /* submitter : waits until a room is available */
+    void waitRoom() {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        mCondition.wait(lock, [this]() {
+                                  return (mInFlightCnt < mMaxInFlight);
+                              });
+    }
+
+    /* submitter : a work is taken, it should be called in the same critical section as taking the work */
+    void take() {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mInFlightCnt++;
+    }
+
+    /* submitter : a work taken is started */
+    void submit(T item) {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mItems.push_back(std::move(item));
+        }
+
+        mCondition.notify_all();
+    }
+
+    /* completer : the oldest one. returns false if it is closed and nothing is left */
+    bool pop(T &item) {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        mCondition.wait(lock, [this]() {
+                                  return ((mClosed) || (!mItems.empty()));
+                              });
+
+        if (mItems.empty()) {
+            return false;
+        }
+
+        item = std::move(mItems.front());
+        mItems.pop_front();
+
+        return true;
+    }
+
+    /* completer : a work popped is delivered */
+    void done() {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            if (mInFlightCnt > 0) {
+                mInFlightCnt--;
+            }
+        }
+
+        mCondition.notify_all();
+    }
+
+    /* waits until every work taken is delivered */
+    void waitIdle() {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        mCondition.wait(lock, [this]() {
+                                  return (mInFlightCnt == 0);
+                              });
+    }
+
+    uint32_t inFlightCnt() {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return mInFlightCnt;
+    }
+
+private:
+    std::mutex              mMutex;
+    std::condition_variable mCondition;
+
+    std::deque<T> mItems;             /* submitted, not popped yet */
+    uint32_t      mMaxInFlight = 1;
+    uint32_t      mInFlightCnt = 0;   /* taken, not delivered yet */
+    bool          mClosed = false;
+};
+
+#endif // EXYNOS_IN_FLIGHT_QUEUE_H
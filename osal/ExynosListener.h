@@ -47,7 +47,7 @@ public:
     ExynosListenerInterface() = default;
     virtual ~ExynosListenerInterface() = default;
 
-    virtual bool processDone(ExynosBufferInfo input, ExynosBufferInfo output) = 0;
+    virtual bool processDone(ExynosBufferInfo &input, ExynosBufferInfo &output) = 0;
     virtual void eventReceived(std::shared_ptr<ExynosListenerEvent> event) = 0;
 };
 
@@ -67,7 +67,7 @@ public:
 
     ~ExynosListener() = default;
 
-    bool processDone(ExynosBufferInfo input, ExynosBufferInfo output) {
+    bool processDone(ExynosBufferInfo &input, ExynosBufferInfo &output) {
         ExynosLogFunctionTrace();
 
         std::lock_guard<std::mutex> lock(mMutex);
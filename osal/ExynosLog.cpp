@@ -15,11 +15,18 @@
  * limitations under the License.
  */
 #include <map>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+#include <unistd.h>
 #include <log/log.h>
 #include <cutils/properties.h>
 
 #include "ExynosDef.h"
 #include "ExynosLog.h"
+#include "ExynosLogRing.h"
 
 static std::map<std::string, unsigned int> LevelMap = {
     { std::string("disable"),   Level::Unknown },
@@ -33,6 +40,136 @@ static std::map<std::string, unsigned int> LevelMap = {
 };
 
 static unsigned int gLogLevel = (Level::Error | Level::Warning | Level::Info);  /* default */
+static std::atomic<bool> gAsyncLog(false);
+
+/* set when the ring of a thread is closed on its exit. trivially destructible,
+ * so that it is still valid while other thread_local objects are destroyed.
+ */
+static thread_local bool gRingClosed = false;
+
+static int GetLogPriority(Level level) {
+    switch (level) {
+    case Level::Error:
+        return ANDROID_LOG_ERROR;
+    case Level::Warning:
+        return ANDROID_LOG_WARN;
+    case Level::Info:
+        [[fallthrough]];
+    case Level::Essential:
+        return ANDROID_LOG_INFO;
+    case Level::Debug:
+        return ANDROID_LOG_DEBUG;
+    case Level::Trace:
+        [[fallthrough]];
+    default:
+        return ANDROID_LOG_VERBOSE;
+    }
+}
+
+/*
+ * async mode(vendor.debug.c2.log.async).
+ * a thread puts a formatted message into its own ring and returns without writing to logd,
+ * the drainer thread emits them periodically. a message is dropped if the ring is full.
+ */
+class ExynosLogDrainer {
+public:
+    static ExynosLogDrainer& getInstance() {
+        /* not destroyed, since threads could write logs until the process exits */
+        static ExynosLogDrainer *instance = new ExynosLogDrainer();
+        return *instance;
+    }
+
+    /* nullptr if the thread is exiting and its ring is closed */
+    ExynosLogRing* getRing() {
+        if (gRingClosed) {
+            return nullptr;
+        }
+
+        thread_local RingHolder holder;
+
+        if (holder.ring == nullptr) {
+            holder.ring = new ExynosLogRing(gettid());
+
+            std::lock_guard<std::mutex> lock(mMutex);
+            mRings.push_back(holder.ring);
+        }
+
+        return holder.ring;
+    }
+
+private:
+    /* the ring of an exited thread is released by the drainer after draining */
+    struct RingHolder {
+        ExynosLogRing *ring = nullptr;
+
+        ~RingHolder() {
+            if (ring != nullptr) {
+                ring->close();
+                ring = nullptr;  /* the drainer could release it at any time */
+            }
+
+            gRingClosed = true;
+        }
+    };
+
+    ExynosLogDrainer() {
+        std::thread(&ExynosLogDrainer::run, this).detach();
+    }
+
+    void run() {
+        pthread_setname_np(pthread_self(), "ExynosLogDrainer");
+
+        std::vector<ExynosLogRing *> rings;
+
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                rings.assign(mRings.begin(), mRings.end());
+            }
+
+            for (auto ring : rings) {
+                /* checked before draining, so that nothing is left after the last drain */
+                bool isClosed = ring->isClosed();
+
+                ring->drain([](const ExynosLogRing::Record &record) {
+                                __android_log_print(record.priority, record.tag, "[tid:%d] %s", record.tid, record.msg);
+                            });
+
+                uint64_t dropCnt = ring->takeDropCnt();
+                if (dropCnt > 0) {
+                    __android_log_print(ANDROID_LOG_WARN, "ExynosLog", "[tid:%d] %llu messages are dropped",
+                                        ring->getTid(), (unsigned long long)dropCnt);
+                }
+
+                if (isClosed) {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    mRings.erase(std::find(mRings.begin(), mRings.end(), ring));
+                    delete ring;
+                }
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(LOG_ASYNC_DRAIN_TIME));
+        }
+    }
+
+    std::mutex mMutex;
+    std::vector<ExynosLogRing *> mRings;
+};
+
+static void PrintLog(Level level, const char *tag, const char *msg, va_list argptr) {
+    if (gAsyncLog.load(std::memory_order_relaxed)) {
+        ExynosLogRing *ring = ExynosLogDrainer::getInstance().getRing();
+
+        if (ring != nullptr) {
+            ring->push(GetLogPriority(level), tag, msg, argptr);
+            return;
+        }
+
+        /* logs of an exiting thread(ex, from a destructor of thread_local) are written directly */
+    }
+
+    __android_log_vprint(GetLogPriority(level), tag, msg, argptr);
+}
 
 /* static */
 bool ExynosTraceObject::isFunctionTrace() {
@@ -57,29 +194,7 @@ void ExynosLog::ExynosLogPrint(Level level, const char *msg, ...) {
     va_list argptr;
     va_start(argptr, msg);
 
-    switch (level) {
-    case Level::Error:
-        __android_log_vprint(ANDROID_LOG_ERROR, mObjName.c_str(), msg, argptr);
-        break;
-    case Level::Warning:
-        __android_log_vprint(ANDROID_LOG_WARN, mObjName.c_str(), msg, argptr);
-        break;
-    case Level::Info:
-        __android_log_vprint(ANDROID_LOG_INFO, mObjName.c_str(), msg, argptr);
-        break;
-    case Level::Essential:
-        __android_log_vprint(ANDROID_LOG_INFO, mObjName.c_str(), msg, argptr);
-        break;
-    case Level::Debug:
-        __android_log_vprint(ANDROID_LOG_DEBUG, mObjName.c_str(), msg, argptr);
-        break;
-    case Level::Trace:
-        __android_log_vprint(ANDROID_LOG_VERBOSE, mObjName.c_str(), msg, argptr);
-        break;
-    default:
-        __android_log_vprint(ANDROID_LOG_VERBOSE, mObjName.c_str(), msg, argptr);
-        break;
-    }
+    PrintLog(level, mObjName.c_str(), msg, argptr);
 
     va_end(argptr);
 
@@ -109,6 +224,8 @@ void StaticExynosLogUpdateLevel() {
     } else {
         gLogLevel = (Level::Error | Level::Warning | Level::Info);
     }
+
+    gAsyncLog = property_get_bool("vendor.debug.c2.log.async", false);
 }
 
 void StaticExynosLogPrint(Level level, const char *objName, const char *msg, ...) {
@@ -120,29 +237,7 @@ void StaticExynosLogPrint(Level level, const char *objName, const char *msg, ...
     va_list argptr;
     va_start(argptr, msg);
 
-    switch (level) {
-    case Level::Error:
-        __android_log_vprint(ANDROID_LOG_ERROR, objName, msg, argptr);
-        break;
-    case Level::Warning:
-        __android_log_vprint(ANDROID_LOG_WARN, objName, msg, argptr);
-        break;
-    case Level::Info:
-        __android_log_vprint(ANDROID_LOG_INFO, objName, msg, argptr);
-        break;
-    case Level::Essential:
-        __android_log_vprint(ANDROID_LOG_INFO, objName, msg, argptr);
-        break;
-    case Level::Debug:
-        __android_log_vprint(ANDROID_LOG_DEBUG, objName, msg, argptr);
-        break;
-    case Level::Trace:
-        __android_log_vprint(ANDROID_LOG_VERBOSE, objName, msg, argptr);
-        break;
-    default:
-        __android_log_vprint(ANDROID_LOG_VERBOSE, objName, msg, argptr);
-        break;
-    }
+    PrintLog(level, objName, msg, argptr);
 
     va_end(argptr);
 
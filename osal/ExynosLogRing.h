@@ -0,0 +1,116 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EXYNOS_LOG_RING_H
+#define EXYNOS_LOG_RING_H
+
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <sys/types.h>
+
+#include "ExynosDef.h"
+
+/*
+ * ring of log records written by a thread and read by the drainer.
+ * there is one writer and one reader, so that head and tail are enough without a lock.
+ * a message is formatted into the slot by the writer, since arguments(ex, %s) are not valid later.
+ * a record is dropped and counted if the ring is full, the writer never waits for the reader.
+ */
+class ExynosLogRing {
+public:
+    struct Record {
+        int     priority;
+        pid_t   tid;
+        char    tag[LOG_RING_TAG_SIZE];
+        char    msg[LOG_RING_MSG_SIZE];
+    };
+
+    ExynosLogRing(pid_t tid) : mTid(tid), mHead(0), mTail(0), mDropCnt(0), mClosed(false) {}
+    ~ExynosLogRing() = default;
+
+    /* writer */
+    bool push(int priority, const char *tag, const char *msg, va_list argptr) {
+        uint32_t head = mHead.load(std::memory_order_relaxed);
+
+        if ((head - mTail.load(std::memory_order_acquire)) >= LOG_RING_RECORD_CNT) {
+            mDropCnt.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        Record &record = mRecords[head & (LOG_RING_RECORD_CNT - 1)];
+
+        record.priority = priority;
+        record.tid      = mTid;
+        strncpy(record.tag, (tag != nullptr)? tag:"", sizeof(record.tag) - 1);
+        record.tag[sizeof(record.tag) - 1] = '\0';
+        vsnprintf(record.msg, sizeof(record.msg), msg, argptr);
+
+        mHead.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /* writer. the ring is released by the reader after draining the rest */
+    void close() {
+        mClosed.store(true, std::memory_order_release);
+    }
+
+    /* reader. returns number of records emitted */
+    template<typename F>
+    uint32_t drain(F &&emit) {
+        uint32_t tail = mTail.load(std::memory_order_relaxed);
+        uint32_t head = mHead.load(std::memory_order_acquire);
+        uint32_t count = head - tail;
+
+        for (; tail != head; tail++) {
+            emit(mRecords[tail & (LOG_RING_RECORD_CNT - 1)]);
+        }
+
+        mTail.store(tail, std::memory_order_release);
+
+        return count;
+    }
+
+    /* reader. returns number of records dropped since the last call */
+    uint64_t takeDropCnt() {
+        return mDropCnt.exchange(0, std::memory_order_relaxed);
+    }
+
+    bool isClosed() {
+        return mClosed.load(std::memory_order_acquire);
+    }
+
+    pid_t getTid() {
+        return mTid;
+    }
+
+private:
+    static_assert((LOG_RING_RECORD_CNT & (LOG_RING_RECORD_CNT - 1)) == 0, "LOG_RING_RECORD_CNT should be power of 2");
+
+    pid_t mTid;
+
+    /* kept apart not to bounce a cache line between the writer and the reader */
+    alignas(64) std::atomic<uint32_t> mHead;
+    alignas(64) std::atomic<uint32_t> mTail;
+    std::atomic<uint64_t> mDropCnt;
+    std::atomic<bool> mClosed;
+
+    Record mRecords[LOG_RING_RECORD_CNT];
+};
+
+#endif // EXYNOS_LOG_RING_H
@@ -0,0 +1,251 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EXYNOS_MAP_CACHE_H
+#define EXYNOS_MAP_CACHE_H
+
+#include <mutex>
+#include <list>
+#include <map>
+#include <tuple>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "ExynosDef.h"
+
+#define LOG_ON
+#include "ExynosLog.h"
+
+/*
+ * cache of dmabuf mappings shared by all ExynosBuffers in the process.
+ * a mapping is identified by the inode of dmabuf and offset/size of the plane,
+ * so that the same buffer which is recycled by wrapping again reuses the mapping.
+ * unused mappings are kept in LRU order up to MAP_CACHE_MAX_IDLE_CNT.
+ */
+class ExynosMapCache {
+public:
+    static ExynosMapCache& getInstance() {
+        static ExynosMapCache instance;
+        return instance;
+    }
+
+    ~ExynosMapCache() {
+        clear();
+    }
+
+    static uint64_t getStIno(int fd) {
+        struct stat statInfo;
+
+        if (fstat(fd, &statInfo) != 0) {
+            return 0;
+        }
+
+        return (uint64_t)statInfo.st_ino;
+    }
+
+    /* returns the address mapped, nullptr on failure. have to be paired with release().
+     * owner is an identity of the instance using it(ex, component), 0 if none.
+     */
+    void* acquire(int fd, uint64_t ino, off_t offset, size_t size, uint64_t owner = 0) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if ((fd < 0) || (size == 0)) {
+            return nullptr;
+        }
+
+        if (ino != 0) {
+            auto search = mEntries.find(Key(ino, offset, size));
+            if (search != mEntries.end()) {
+                auto &entry = search->second;
+                if (entry.refCount++ == 0) {
+                    mIdleList.erase(entry.idlePos);
+                }
+
+                if (owner != 0) {
+                    /* the last user owns it */
+                    entry.owner = owner;
+                }
+
+                mHitCnt++;
+
+                return entry.addr;
+            }
+        }
+
+        mMissCnt++;
+
+        auto addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, offset);
+        if (addr == MAP_FAILED) {
+            StaticExynosLog(Level::Error, "ExynosMapCache", "[%s] mmap(fd:%d, size:%zu) is failed", __FUNCTION__, fd, size);
+            return nullptr;
+        }
+
+        if (ino == 0) {
+            /* can not be identified, it is not cached */
+            return addr;
+        }
+
+        Entry entry;
+        entry.addr      = addr;
+        entry.size      = size;
+        entry.refCount  = 1;
+        entry.stale     = false;
+        entry.owner     = owner;
+
+        mEntries.emplace(Key(ino, offset, size), entry);
+        mAddrIndex.emplace(addr, Key(ino, offset, size));
+
+        return addr;
+    }
+
+    void release(void *addr, size_t size) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (addr == nullptr) {
+            return;
+        }
+
+        auto index = mAddrIndex.find(addr);
+        if (index == mAddrIndex.end()) {
+            /* not cached */
+            munmap(addr, size);
+            return;
+        }
+
+        auto search = mEntries.find(index->second);
+        auto &entry = search->second;
+
+        if (--entry.refCount > 0) {
+            return;
+        }
+
+        if (entry.stale) {
+            munmap(entry.addr, entry.size);
+            mAddrIndex.erase(index);
+            mEntries.erase(search);
+            return;
+        }
+
+        entry.idlePos = mIdleList.insert(mIdleList.end(), search->first);
+
+        while (mIdleList.size() > MAP_CACHE_MAX_IDLE_CNT) {
+            evict(mIdleList.front());
+        }
+    }
+
+    /* the fd of dmabuf is released. drops all mappings of it */
+    void invalidate(uint64_t ino) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        auto it = mEntries.lower_bound(Key(ino, 0, 0));
+        while ((it != mEntries.end()) &&
+               (std::get<0>(it->first) == ino)) {
+            auto &entry = it->second;
+
+            if (entry.refCount > 0) {
+                /* in use. it will be unmapped at the last release() */
+                entry.stale = true;
+                it++;
+                continue;
+            }
+
+            mIdleList.erase(entry.idlePos);
+            munmap(entry.addr, entry.size);
+            mAddrIndex.erase(entry.addr);
+            it = mEntries.erase(it);
+        }
+    }
+
+    /* drops mappings not in use except for the recent keepCnt */
+    void trim(size_t keepCnt) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        while (mIdleList.size() > keepCnt) {
+            evict(mIdleList.front());
+        }
+    }
+
+    /* drops mappings not in use which are owned by the owner */
+    void drop(uint64_t owner) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        auto it = mIdleList.begin();
+        while (it != mIdleList.end()) {
+            auto key = *(it++);  /* evict() erases the current one */
+
+            auto search = mEntries.find(key);
+            if ((search != mEntries.end()) &&
+                (search->second.owner == owner)) {
+                evict(key);
+            }
+        }
+    }
+
+    /* drops all mappings not in use */
+    void clear() {
+        trim(0);
+    }
+
+    void getStatistics(uint64_t &hit, uint64_t &miss) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        hit  = mHitCnt;
+        miss = mMissCnt;
+    }
+
+private:
+    ExynosMapCache() = default;
+
+    ExynosMapCache(const ExynosMapCache&) = delete;
+    ExynosMapCache& operator=(const ExynosMapCache&) = delete;
+
+    /* inode, offset, size */
+    typedef std::tuple<uint64_t, off_t, size_t> Key;
+
+    struct Entry {
+        void   *addr;
+        size_t  size;
+        int     refCount;
+        bool    stale;
+        uint64_t owner;
+        std::list<Key>::iterator idlePos;
+    };
+
+    /* mMutex should be held */
+    void evict(const Key key) {
+        auto search = mEntries.find(key);
+        if (search == mEntries.end()) {
+            return;
+        }
+
+        mIdleList.erase(search->second.idlePos);
+        munmap(search->second.addr, search->second.size);
+        mAddrIndex.erase(search->second.addr);
+        mEntries.erase(search);
+    }
+
+    std::mutex mMutex;
+
+    std::map<Key, Entry>   mEntries;
+    std::map<void *, Key>  mAddrIndex;
+    std::list<Key>         mIdleList;   /* front is the least recently used */
+
+    uint64_t mHitCnt = 0;
+    uint64_t mMissCnt = 0;
+};
+
+#endif // EXYNOS_MAP_CACHE_H
@@ -0,0 +1,238 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EXYNOS_MEMORY_POOL_H
+#define EXYNOS_MEMORY_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "ExynosDef.h"
+#include "ExynosQueue.h"
+
+/*
+ * blocks recycled through free lists, a list per size class.
+ * small objects made on every frame(params, filter works, nodes of containers)
+ * are allocated from here, so that the heap is not touched at a steady state.
+ * it is shared by the process. blocks bigger than MEMORY_POOL_MAX_BLOCK_SIZE
+ * are not pooled, and free blocks are kept up to MEMORY_POOL_MAX_FREE_CNT per class
+ * on the shared list in addition to caches of threads.
+ */
+class ExynosMemoryPool {
+public:
+    static ExynosMemoryPool& getInstance() {
+        /* never destroyed, blocks may be released after static objects are gone */
+        static ExynosMemoryPool *instance = new ExynosMemoryPool();
+        return *instance;
+    }
+
+    void* allocate(size_t size) {
+        if ((size == 0) ||
+            (size > MEMORY_POOL_MAX_BLOCK_SIZE)) {
+            return ::operator new(size);
+        }
+
+        size_t index = getClassIndex(size);
+
+        /* a thread takes blocks from own cache first, without a lock */
+        auto &cache = getThreadCache().freeLists[index];
+        if (cache.head != nullptr) {
+            Node *node = cache.head;
+            cache.head = node->next;
+            cache.cnt--;
+            mHitCnt.fetch_add(1, std::memory_order_relaxed);
+
+            return node;
+        }
+
+        Node *node = nullptr;
+        if (mFreeLists[index]->dequeue(node)) {
+            mHitCnt.fetch_add(1, std::memory_order_relaxed);
+
+            return node;
+        }
+
+        mMissCnt.fetch_add(1, std::memory_order_relaxed);
+
+        /* a block always has the size of class to be reused by others in the class */
+        return ::operator new(getClassSize(size));
+    }
+
+    void release(void *ptr, size_t size) {
+        if (ptr == nullptr) {
+            return;
+        }
+
+        if ((size == 0) ||
+            (size > MEMORY_POOL_MAX_BLOCK_SIZE)) {
+            ::operator delete(ptr);
+            return;
+        }
+
+        size_t index = getClassIndex(size);
+        Node *node = static_cast<Node *>(ptr);
+
+        auto &cache = getThreadCache().freeLists[index];
+        if (cache.cnt < MEMORY_POOL_THREAD_CACHE_CNT) {
+            node->next = cache.head;
+            cache.head = node;
+            cache.cnt++;
+
+            return;
+        }
+
+        if (pushFreeList(index, node)) {
+            return;
+        }
+
+        ::operator delete(ptr);
+    }
+
+    /* blocks reused and blocks allocated from the heap */
+    void getStatistics(uint64_t &hit, uint64_t &miss) {
+        hit  = mHitCnt.load(std::memory_order_relaxed);
+        miss = mMissCnt.load(std::memory_order_relaxed);
+    }
+
+private:
+    static_assert(MEMORY_POOL_BLOCK_ALIGN >= sizeof(void *), "block is too small to be linked");
+
+    static constexpr size_t kClassCnt = (MEMORY_POOL_MAX_BLOCK_SIZE / MEMORY_POOL_BLOCK_ALIGN);
+
+    ExynosMemoryPool() {
+        for (size_t index = 0; index < kClassCnt; index++) {
+            mFreeLists[index] = std::make_unique<ExynosRingQueue<Node *>>(MEMORY_POOL_MAX_FREE_CNT);
+        }
+    }
+    ~ExynosMemoryPool() = default;
+
+    ExynosMemoryPool(const ExynosMemoryPool&) = delete;
+    ExynosMemoryPool& operator=(const ExynosMemoryPool&) = delete;
+
+    static size_t getClassIndex(size_t size) {
+        return ((size - 1) / MEMORY_POOL_BLOCK_ALIGN);
+    }
+
+    static size_t getClassSize(size_t size) {
+        return ALIGN(size, MEMORY_POOL_BLOCK_ALIGN);
+    }
+
+    struct Node {
+        Node *next;
+    };
+
+    /*
+     * blocks released by a thread are kept in its own cache up to MEMORY_POOL_THREAD_CACHE_CNT.
+     * a block could be released by a thread which did not allocate it(ex, a work done on other filter),
+     * then it goes to the shared free list when the cache is full.
+     */
+    struct ThreadCache {
+        struct FreeList {
+            Node  *head = nullptr;
+            size_t cnt  = 0;
+        };
+
+        ~ThreadCache() {
+            auto &pool = ExynosMemoryPool::getInstance();
+
+            for (size_t index = 0; index < kClassCnt; index++) {
+                while (freeLists[index].head != nullptr) {
+                    Node *node = freeLists[index].head;
+                    freeLists[index].head = node->next;
+
+                    if (!pool.pushFreeList(index, node)) {
+                        ::operator delete(node);
+                    }
+                }
+            }
+        }
+
+        FreeList freeLists[kClassCnt];
+    };
+
+    static ThreadCache& getThreadCache() {
+        static thread_local ThreadCache cache;
+        return cache;
+    }
+
+    /* fails when the shared list is full */
+    bool pushFreeList(size_t index, Node *node) {
+        return mFreeLists[index]->enqueue(std::move(node));
+    }
+
+    /* shared by threads releasing blocks they did not allocate, so it is lock-free */
+    std::unique_ptr<ExynosRingQueue<Node *>> mFreeLists[kClassCnt];
+
+    std::atomic<uint64_t> mHitCnt{0};
+    std::atomic<uint64_t> mMissCnt{0};
+};
+
+/* allocator for std containers and std::allocate_shared */
+template<typename T>
+class ExynosPoolAllocator {
+public:
+    using value_type = T;
+
+    ExynosPoolAllocator() noexcept = default;
+
+    template<typename U>
+    ExynosPoolAllocator(const ExynosPoolAllocator<U>&) noexcept {
+    }
+
+    T* allocate(size_t n) {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned type can not be pooled");
+
+        return static_cast<T *>(ExynosMemoryPool::getInstance().allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T *ptr, size_t n) noexcept {
+        ExynosMemoryPool::getInstance().release(ptr, (n * sizeof(T)));
+    }
+
+    template<typename U>
+    bool operator==(const ExynosPoolAllocator<U>&) const noexcept {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const ExynosPoolAllocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+/* std::make_shared whose object and control block are in a pooled block */
+template<typename T, typename... Args>
+std::shared_ptr<T> MakePooledShared(Args&&... args) {
+    return std::allocate_shared<T>(ExynosPoolAllocator<T>(), std::forward<Args>(args)...);
+}
+
+/* base of a class whose objects made by new/make_unique are pooled */
+template<typename T>
+class ExynosPooledObject {
+public:
+    static void* operator new(size_t size) {
+        return ExynosMemoryPool::getInstance().allocate(size);
+    }
+
+    static void operator delete(void *ptr, size_t size) {
+        ExynosMemoryPool::getInstance().release(ptr, size);
+    }
+};
+
+#endif // EXYNOS_MEMORY_POOL_H
@@ -23,6 +23,7 @@
 
 #include "ExynosDef.h"
 #include "ExynosLog.h"
+#include "ExynosFlatMap.h"
 
 typedef int32_t ParamIndex;
 
@@ -64,12 +65,21 @@ public:
         mParams.clear();
     }
 
+    ExynosParams(const ExynosParams &rhs) = default;
+    ExynosParams(ExynosParams &&rhs) noexcept = default;
+
     ExynosParams& operator=(const ExynosParams &rhs) {
         this->mParams = rhs.mParams;
 
         return *this;
     }
 
+    ExynosParams& operator=(ExynosParams &&rhs) noexcept {
+        this->mParams = std::move(rhs.mParams);
+
+        return *this;
+    }
+
     virtual ~ExynosParams() {
         mParams.clear();
     }
@@ -99,6 +109,15 @@ public:
         return nullptr;
     }
 
+    /* in order of index */
+    auto begin() {
+        return mParams.begin();
+    }
+
+    auto end() {
+        return mParams.end();
+    }
+
     virtual bool empty() {
         return mParams.empty();
     }
@@ -112,7 +131,10 @@ public:
     }
 
 protected:
-    std::map<ParamIndex, std::shared_ptr<ExynosParamBase>> mParams;
+    /* a frame has a few params, they are copied with a buffer info */
+    using ParamMap = ExynosFlatMap<ParamIndex, std::shared_ptr<ExynosParamBase>>;
+
+    ParamMap mParams;
 };
 
 enum ExynosParamIndex : ParamIndex {
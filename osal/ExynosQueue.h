@@ -19,6 +19,8 @@
 
 #include <mutex>
 #include <list>
+#include <vector>
+#include <atomic>
 #include <unordered_map>
 #include <functional>
 #include <utility>
@@ -75,13 +77,13 @@ public:
             if (condfunc != nullptr) {
                 for (auto it = mList.begin(); it != mList.end(); it++) {
                     if (condfunc(*it) == true) {
-                        element = (*it);
+                        element = std::move(*it);
                         mList.erase(it);
                         return true;
                     }
                 }
             } else {
-                element = mList.front();
+                element = std::move(mList.front());
                 mList.pop_front();
                 return true;
             }
@@ -137,6 +139,151 @@ private:
     std::list<T> mList;
 };
 
+/*
+ * bounded lock-free queue for multiple producers and consumers.
+ * it has no condfunc based lookup, so it could be used instead of ExynosQueue
+ * only when elements are always handled in FIFO order.
+ * enqueue() fails if the queue is full.
+ */
+template<class T>
+class ExynosRingQueue {
+public:
+    ExynosRingQueue(size_t capacity = 64) {
+        size_t num = 2;
+
+        /* cells are indexed by mask, so rounds capacity up to power of two */
+        while (num < capacity) {
+            num <<= 1;
+        }
+
+        mMask = num - 1;
+        mCells = std::vector<Cell>(num);
+
+        for (size_t i = 0; i < num; i++) {
+            mCells[i].seq.store(i, std::memory_order_relaxed);
+        }
+
+        mEnqueuePos.store(0, std::memory_order_relaxed);
+        mDequeuePos.store(0, std::memory_order_relaxed);
+    }
+
+    ~ExynosRingQueue() {
+        clear();
+    }
+
+    bool enqueue(T &element) {
+        T copied = element;
+
+        return enqueue(std::move(copied));
+    }
+
+    bool enqueue(T &&element) {
+        Cell *cell = nullptr;
+        size_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+
+        while (true) {
+            cell = &mCells[pos & mMask];
+
+            size_t seq = cell->seq.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+            if (diff == 0) {
+                if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                /* full */
+                return false;
+            } else {
+                pos = mEnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->data = std::move(element);
+        cell->seq.store(pos + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /* element is moved out, nothing is copied */
+    bool dequeue(T &element) {
+        Cell *cell = nullptr;
+        size_t pos = mDequeuePos.load(std::memory_order_relaxed);
+
+        while (true) {
+            cell = &mCells[pos & mMask];
+
+            size_t seq = cell->seq.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+            if (diff == 0) {
+                if (mDequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                /* empty */
+                return false;
+            } else {
+                pos = mDequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        element = std::move(cell->data);
+        cell->data = T();  /* release resources owned by element right away */
+        cell->seq.store(pos + mMask + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /* it could be stale when other threads are working on the queue */
+    int size() {
+        size_t enqueuePos = mEnqueuePos.load(std::memory_order_acquire);
+        size_t dequeuePos = mDequeuePos.load(std::memory_order_acquire);
+
+        return (enqueuePos > dequeuePos)? (int)(enqueuePos - dequeuePos):0;
+    }
+
+    bool empty() {
+        return (size() == 0);
+    }
+
+    size_t capacity() {
+        return (mMask + 1);
+    }
+
+    void clear() {
+        T element;
+
+        while (dequeue(element)) {
+            element = T();
+        }
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> seq;
+        T data;
+
+        Cell() : seq(0), data() {
+        }
+
+        /* only for creating the vector of cells */
+        Cell(Cell &&cell) : seq(cell.seq.load(std::memory_order_relaxed)), data(std::move(cell.data)) {
+        }
+    };
+
+    std::vector<Cell> mCells;
+    size_t mMask;
+
+    /* producers and consumers do not share a cache line */
+    alignas(64) std::atomic<size_t> mEnqueuePos;
+    alignas(64) std::atomic<size_t> mDequeuePos;
+
+    /* disable copy constructors */
+    ExynosRingQueue(const ExynosRingQueue<T>&) = delete;
+    void operator=(const ExynosRingQueue<T>&) = delete;
+};
+
 template<class T, class R>
 class ExynosMap {
 public:
@@ -0,0 +1,177 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EXYNOS_REF_TABLE_H
+#define EXYNOS_REF_TABLE_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "ExynosDef.h"
+
+/*
+ * reference count of objects keyed by the identity of buffer(ex, inode of dmabuf).
+ * keys are spread over shards, so that threads working on other buffers don't wait for each other.
+ * numbers of registered/referenced entries and fds bound to keys are read without a lock.
+ */
+template<typename T>
+class ExynosRefTable {
+public:
+    ExynosRefTable() : mRegisteredCnt(0), mReferencedCnt(0) {
+        unbindFds();
+    }
+
+    ~ExynosRefTable() = default;
+
+    /* returns the count after increase */
+    int add(uint64_t key, std::shared_ptr<T> obj) {
+        Shard &shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        auto search = shard.map.find(key);
+        if (search == shard.map.end()) {
+            search = shard.map.emplace(key, Entry{ std::move(obj), 0 }).first;
+            mRegisteredCnt.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (++(search->second.count) == 2) {
+            mReferencedCnt.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        return search->second.count;
+    }
+
+    /* returns the count after decrease, -1 if it is not registered */
+    int del(uint64_t key) {
+        std::shared_ptr<T> dropped;
+        int count = -1;
+
+        {
+            Shard &shard = getShard(key);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+
+            auto search = shard.map.find(key);
+            if (search == shard.map.end()) {
+                return -1;
+            }
+
+            if ((search->second.count)-- == 2) {
+                mReferencedCnt.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            count = search->second.count;
+
+            if (count <= 0) {
+                dropped = std::move(search->second.obj);
+                shard.map.erase(search);
+                mRegisteredCnt.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        /* the object is freed out of the lock */
+        return count;
+    }
+
+    bool find(uint64_t key) {
+        Shard &shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        return (shard.map.count(key) > 0);
+    }
+
+    void clear() {
+        for (auto &shard : mShards) {
+            std::unordered_map<uint64_t, Entry> dropped;
+
+            {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+
+                for (const auto &[key, entry] : shard.map) {
+                    if (entry.count > 1) {
+                        mReferencedCnt.fetch_sub(1, std::memory_order_relaxed);
+                    }
+                }
+
+                mRegisteredCnt.fetch_sub((int)shard.map.size(), std::memory_order_relaxed);
+                dropped.swap(shard.map);
+            }
+        }
+
+        unbindFds();
+    }
+
+    /*
+     * an fd is bound to the key of the buffer which is queued with it at last,
+     * the driver reports the fd of the buffer it holds. fds out of the range are not bound.
+     */
+    void bindFd(int fd, uint64_t key) {
+        if ((fd >= 0) && (fd < REF_TABLE_FD_CNT)) {
+            mFdKeys[fd].store(key, std::memory_order_release);
+        }
+    }
+
+    std::optional<uint64_t> getKeyOfFd(int fd) {
+        if ((fd >= 0) && (fd < REF_TABLE_FD_CNT)) {
+            uint64_t key = mFdKeys[fd].load(std::memory_order_acquire);
+            if (key != 0) {
+                return { key };
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    int registeredCount() {
+        return mRegisteredCnt.load(std::memory_order_relaxed);
+    }
+
+    int referencedCount() {
+        return mReferencedCnt.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Entry {
+        std::shared_ptr<T> obj;
+        int count;
+    };
+
+    /* apart not to share a cache line between shards */
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::unordered_map<uint64_t, Entry> map;
+    };
+
+    Shard& getShard(uint64_t key) {
+        return mShards[key % REF_TABLE_SHARD_CNT];
+    }
+
+    void unbindFds() {
+        for (auto &key : mFdKeys) {
+            key.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    Shard mShards[REF_TABLE_SHARD_CNT];
+    std::atomic<uint64_t> mFdKeys[REF_TABLE_FD_CNT];
+    std::atomic<int> mRegisteredCnt;
+    std::atomic<int> mReferencedCnt;
+};
+
+#endif // EXYNOS_REF_TABLE_H
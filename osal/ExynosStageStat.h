@@ -0,0 +1,135 @@
+/*
+ *
+ * Copyright 2020 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EXYNOS_STAGE_STAT_H
+#define EXYNOS_STAGE_STAT_H
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <time.h>
+
+#include "ExynosDef.h"
+
+using std::chrono::steady_clock;
+
+/*
+ * statistics of a stage in the pipeline.
+ * latency of the latest STAGE_STAT_MAX_SAMPLE_CNT works is kept to get percentiles,
+ * and the report is a line of json in order to be parsed by tools.
+ */
+class ExynosStageStat {
+public:
+    ExynosStageStat() {
+        mSamples.reserve(STAGE_STAT_MAX_SAMPLE_CNT);
+        reset();
+    }
+
+    ~ExynosStageStat() = default;
+
+    static int64_t getThreadCpuTime() {
+        struct timespec ts;
+
+        if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+            return 0;
+        }
+
+        return ((int64_t)ts.tv_sec * 1000000LL) + (ts.tv_nsec / 1000);  /* us */
+    }
+
+    void reset() {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mSamples.clear();
+        mPos       = 0;
+        mFrameCnt  = 0;
+        mCpuTime   = 0;
+        mStartTime = steady_clock::now();
+        mLastTime  = mStartTime;
+    }
+
+    void addLatency(steady_clock::time_point queuedTime) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mLastTime = steady_clock::now();
+
+        int64_t latency = std::chrono::duration_cast<std::chrono::microseconds>(mLastTime - queuedTime).count();
+
+        if (mSamples.size() < STAGE_STAT_MAX_SAMPLE_CNT) {
+            mSamples.push_back(latency);
+        } else {
+            mSamples[mPos] = latency;
+            mPos = (mPos + 1) % STAGE_STAT_MAX_SAMPLE_CNT;
+        }
+
+        mFrameCnt++;
+    }
+
+    void addCpuTime(int64_t cpuTime) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mCpuTime += cpuTime;
+    }
+
+    uint64_t getFrameCnt() {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return mFrameCnt;
+    }
+
+    std::string report(const std::string &name) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        std::vector<int64_t> sorted(mSamples);
+        std::sort(sorted.begin(), sorted.end());
+
+        auto percentile = [&sorted](int p)->int64_t {
+            if (sorted.empty()) {
+                return 0;
+            }
+
+            return sorted[((sorted.size() - 1) * p) / 100];
+        };
+
+        double elapsed = std::chrono::duration<double>(mLastTime - mStartTime).count();
+        double fps     = (elapsed > 0)? (mFrameCnt / elapsed):0;
+
+        char buf[256] = { 0, };
+        snprintf(buf, sizeof(buf),
+                 "{\"stage\":\"%s\",\"frames\":%llu,\"fps\":%.2f,\"p50_us\":%lld,\"p99_us\":%lld,\"max_us\":%lld,\"cpu_us_per_frame\":%lld}",
+                 name.c_str(), (unsigned long long)mFrameCnt, fps,
+                 (long long)percentile(50), (long long)percentile(99),
+                 (long long)(sorted.empty()? 0:sorted.back()),
+                 (long long)((mFrameCnt > 0)? (mCpuTime / (int64_t)mFrameCnt):0));
+
+        return std::string(buf);
+    }
+
+private:
+    std::mutex mMutex;
+
+    std::vector<int64_t> mSamples;  /* us */
+    size_t   mPos;
+    uint64_t mFrameCnt;
+    int64_t  mCpuTime;  /* us */
+
+    steady_clock::time_point mStartTime;
+    steady_clock::time_point mLastTime;
+};
+
+#endif // EXYNOS_STAGE_STAT_H
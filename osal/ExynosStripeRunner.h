@@ -0,0 +1,129 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EXYNOS_STRIPE_RUNNER_H
+#define EXYNOS_STRIPE_RUNNER_H
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ExynosDef.h"
+#include "ExynosThreadPool.h"
+
+#include "ExynosLog.h"  /* LOG_ON is up to the including .cpp */
+
+/*
+ * splits a frame into stripes of rows and runs them on own worker threads.
+ * stripe height is kept as even, so that a stripe always starts
+ * at the first row of chroma on 4:2:0 formats.
+ */
+class ExynosStripeRunner {
+public:
+    ExynosStripeRunner(std::string name) : mName(name), mThreadPool(nullptr), mStripeHeight(0) {
+    }
+
+    ~ExynosStripeRunner() {
+        if (mThreadPool.get() != nullptr) {
+            mThreadPool->stop();
+            mThreadPool.reset();
+        }
+    }
+
+    void setThreadInfo(uint32_t threads, uint32_t stripeHeight) {
+        if (mThreadPool.get() != nullptr) {
+            mThreadPool->stop();
+            mThreadPool.reset();
+        }
+
+        /* a caller's thread also runs a stripe */
+        if (threads > 1) {
+            mThreadPool = std::make_shared<ExynosThreadPool>(ExynosThreadPool::Policy::WORK_STEALING,
+                                                             (threads - 1), mName + "-Stripe");
+        }
+
+        mStripeHeight = ALIGN(MAX(stripeHeight, 2), 2);
+
+        StaticExynosLog(Level::Info, "ExynosStripeRunner", "[%s] %s : threads(%d), stripe height(%d)", __FUNCTION__,
+                            mName.c_str(), (threads > 1)? threads:1, mStripeHeight);
+    }
+
+    /* func(start, end) handles rows in [start, end) */
+    void run(int height, const std::function<void(int, int)> &func) const {
+        auto shThreadPool = mThreadPool;
+
+        if ((shThreadPool.get() == nullptr) ||
+            (height <= (int)mStripeHeight)) {
+            func(0, height);
+            return;
+        }
+
+        /* a stripe is run by the one claiming it first, the caller takes ones which are not run by the pool */
+        auto stripes = std::make_shared<std::vector<Stripe>>((height - 1) / mStripeHeight);
+
+        std::vector<std::future<bool>> results;
+        results.reserve(stripes->size());
+
+        for (size_t i = 0; i < stripes->size(); i++) {
+            (*stripes)[i].start = (int)(i * mStripeHeight);
+            (*stripes)[i].end   = (*stripes)[i].start + mStripeHeight;
+
+            auto stripe = [&func, stripes, i]()->bool {
+                              auto &info = (*stripes)[i];
+
+                              if (info.claimed.exchange(true)) {
+                                  return false;
+                              }
+
+                              func(info.start, info.end);
+                              return true;
+                          };
+
+            results.emplace_back(shThreadPool->post(std::string("ExynosStripeRunner::stripe"), std::move(stripe)));
+        }
+
+        /* the last stripe */
+        func((int)(stripes->size() * mStripeHeight), height);
+
+        for (size_t i = 0; i < stripes->size(); i++) {
+            auto &info = (*stripes)[i];
+
+            if (!info.claimed.exchange(true)) {
+                /* not posted or not run yet(ex, the pool has exited) */
+                func(info.start, info.end);
+            } else if (results[i].valid()) {
+                /* it is running on a worker */
+                WaitGetResultFromFuture(results[i], false, 0);
+            }
+        }
+    }
+
+private:
+    struct Stripe {
+        int start = 0;
+        int end   = 0;
+        std::atomic<bool> claimed{false};
+    };
+
+    std::string mName;
+    std::shared_ptr<ExynosThreadPool> mThreadPool;
+    uint32_t mStripeHeight;
+};
+
+#endif // EXYNOS_STRIPE_RUNNER_H
@@ -23,6 +23,9 @@
 
 #include <mutex>
 #include <list>
+#include <map>
+#include <deque>
+#include <atomic>
 #include <condition_variable>
 
 #include <future>
@@ -47,18 +50,45 @@
 
 class ExynosThreadPool : public ExynosLog {
 public:
+    enum class Policy {
+        SHARED_QUEUE,   /* one FIFO shared by all workers */
+        WORK_STEALING,  /* a deque per worker, idle workers steal from others */
+    };
+
     inline ExynosThreadPool(size_t num = 1, std::string name = "ExynosThreadPool") : ExynosThreadPool(false, num, name) {
     }
 
-    inline ExynosThreadPool(bool useSession = false, size_t num = 1, std::string name = "ExynosThreadPool") : ExynosLog(name + "-ThreadPool"),
-                                                                                     mExit(false),
-                                                                                     mIsSessionMode(useSession) {
+    /*
+     * WORK_STEALING does not keep a global order between tasks,
+     * so session mode and callers relying on FIFO have to use SHARED_QUEUE.
+     */
+    inline ExynosThreadPool(Policy policy, size_t num, std::string name = "ExynosThreadPool") : ExynosThreadPool(false, num, name, policy) {
+    }
+
+    inline ExynosThreadPool(bool useSession = false, size_t num = 1, std::string name = "ExynosThreadPool",
+                            Policy policy = Policy::SHARED_QUEUE) : ExynosLog(name + "-ThreadPool"),
+                                                                    mExit(false),
+                                                                    mIsSessionMode(useSession),
+                                                                    mIsWorkStealing((policy == Policy::WORK_STEALING) && (!useSession)) {
         mbLogOff = LOG_ONOFF;
 
         ExynosLogFunctionTrace();
 
         mSessionNumber = std::make_shared<SessionNumber>();
 
+        if (mIsWorkStealing) {
+            for (size_t i = 0; i < num; i++) {
+                mWorkers.emplace_back(std::make_unique<WORKER>());
+            }
+
+            for (size_t i = 0; i < num; i++) {
+                /* create a thread having its own deque */
+                mThreads.emplace_back([this, i]() { this->runWorkStealing(i); });
+            }
+
+            return;
+        }
+
         for (size_t i = 0; i < num; i++) {
             /* create a thread */
             mThreads.emplace_back(
@@ -73,7 +103,7 @@ public:
 
                                                 /* wait for getting a task */
                                                 if ((!this->mExit) &&
-                                                    (this->mTasks.empty())) {
+                                                    (!this->hasRunnableTask())) {
                                                     ret = false;
                                                 }
 
@@ -83,23 +113,12 @@ public:
                             this->mTaskCondition.wait(lock, std::move(condfunc));
 
                             if ((this->mExit) &&
-                                (this->mTasks.empty())) {
+                                (!this->hasRunnableTask())) {
                                 break;
                             }
 
                             /* get a task */
-                            if (mIsSessionMode) {
-                                for (auto it = this->mTasks.begin(); it != this->mTasks.end(); it++) {
-                                    if ((*it)->mSession == this->mSessionNumber->getCur()) {
-                                        task = std::move(*it);
-                                        this->mTasks.erase(it);
-                                        break;
-                                    }
-                                }
-                            } else {
-                                task = std::move(this->mTasks.front());
-                                this->mTasks.pop_front();
-                            }
+                            task = this->popRunnableTask();
                         }
 
                         /* run a task */
@@ -127,6 +146,31 @@ public:
         ExynosLogFunctionTrace();
 
         std::lock_guard<std::mutex> lock(mCancelMutex);
+
+        if (mIsWorkStealing) {
+            for (auto &worker : mWorkers) {
+                std::deque<std::shared_ptr<TASK_PACKAGE>> tasks;
+                {
+                    std::lock_guard<std::mutex> lock(worker->mMutex);
+
+                    tasks.swap(worker->mTasks);
+                    mPendingTasks -= tasks.size();
+                }
+
+                /* remove all piled elements */
+                for (auto &task : tasks) {
+                    if (task.get() != nullptr) {
+                        ExynosLogT("[%s] discard a task :: name(%s)", __FUNCTION__, (task->mName->size() > 0)? task->mName->c_str():"unnamed");
+
+                        std::function<void(bool)> fn = std::move(task->mFn);
+                        fn(true);  /* discard */
+                    }
+                }
+            }
+
+            return;
+        }
+
         {
             std::unique_lock<std::mutex> lock(mTaskMutex);
 
@@ -142,6 +186,9 @@ public:
                     fn(true);  /* discard */
                 }
             }
+
+            /* drop every session bucket at once */
+            discardSessionTasks();
         }
     }
 
@@ -162,13 +209,15 @@ public:
         }
 
         /* wait for thread termination */
-        for (std::thread &thread : mThreads) {
-            if (thread.get_id() != std::this_thread::get_id()) {  /* prevent a deadlock from resource release on shared ptr */
-                if (thread.joinable() == true) {
-                    thread.join();
+        for (auto it = mThreads.begin(); it != mThreads.end(); ) {
+            if (it->get_id() != std::this_thread::get_id()) {  /* prevent a deadlock from resource release on shared ptr */
+                if (it->joinable() == true) {
+                    it->join();
                 }
 
-                mThreads.erase(mThreads.begin());
+                it = mThreads.erase(it);
+            } else {
+                it++;
             }
         }
 
@@ -222,13 +271,20 @@ public:
         if ((mIsSessionMode) &&
             (mSessionNumber.get() != nullptr)) {
             mSessionNumber->incCur();
+
+            /* tasks of the new session may be already piled */
+            {
+                std::unique_lock<std::mutex> lock(mTaskMutex);
+            }
+
+            mTaskCondition.notify_all();
         }
     }
 
     inline uint64_t getCurSession() {
         if ((mIsSessionMode) &&
             (mSessionNumber.get() != nullptr)) {
-            mSessionNumber->getCur();
+            return mSessionNumber->getCur();
         }
 
         return 0;
@@ -237,7 +293,16 @@ public:
     inline void clearSession() {
         if ((mIsSessionMode) &&
             (mSessionNumber.get() != nullptr)) {
-            mSessionNumber->clear();
+            std::lock_guard<std::mutex> lock(mCancelMutex);
+            {
+                std::unique_lock<std::mutex> lock(mTaskMutex);
+
+                /* tasks of old sessions can not be matched anymore after resetting numbers */
+                discardSessionTasks();
+                mSessionNumber->clear();
+            }
+
+            mTaskCondition.notify_all();
         }
     }
 
@@ -246,6 +311,103 @@ public:
     }
 
 private:
+    class TASK_PACKAGE;
+
+    class WORKER {
+    public:
+        std::mutex mMutex;
+        std::deque<std::shared_ptr<TASK_PACKAGE>> mTasks;
+    };
+
+    std::shared_ptr<TASK_PACKAGE> popOrStealTask(size_t index) {
+        /* the own deque is consumed from the front to keep posting order */
+        {
+            std::lock_guard<std::mutex> lock(mWorkers[index]->mMutex);
+
+            if (!mWorkers[index]->mTasks.empty()) {
+                auto task = std::move(mWorkers[index]->mTasks.front());
+                mWorkers[index]->mTasks.pop_front();
+                mPendingTasks--;
+
+                return task;
+            }
+        }
+
+        /* steal from the back of others to stay away from the owner */
+        for (size_t i = 1; i < mWorkers.size(); i++) {
+            auto &victim = mWorkers[(index + i) % mWorkers.size()];
+
+            std::unique_lock<std::mutex> lock(victim->mMutex, std::try_to_lock);
+            if ((lock.owns_lock()) &&
+                (!victim->mTasks.empty())) {
+                auto task = std::move(victim->mTasks.back());
+                victim->mTasks.pop_back();
+                mPendingTasks--;
+
+                return task;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void runWorkStealing(size_t index) {
+        while (true) {
+            std::shared_ptr<TASK_PACKAGE> task = popOrStealTask(index);
+
+            if (task.get() == nullptr) {
+                std::unique_lock<std::mutex> lock(mTaskMutex);
+
+                auto condfunc = [this]()->bool {
+                                    /* wait for getting a task */
+                                    return ((this->mExit) || (this->mPendingTasks > 0));
+                                };
+
+                mSleepingWorkers++;
+                mTaskCondition.wait(lock, std::move(condfunc));
+                mSleepingWorkers--;
+
+                if ((mExit) &&
+                    (mPendingTasks == 0)) {
+                    break;
+                }
+
+                continue;
+            }
+
+            /* run a task */
+            ExynosLogV("[%s] run a task :: name(%s)", __FUNCTION__, (task->mName->size() > 0)? task->mName->c_str():"unnamed");
+
+            std::function<void(bool)> fn = std::move(task->mFn);
+            fn(false);  /* run */
+        }
+    }
+
+    bool pushToWorker(std::shared_ptr<TASK_PACKAGE> deliverTask) {
+        if (mExit) {
+            return false;
+        }
+
+        auto &worker = mWorkers[mNextWorker.fetch_add(1) % mWorkers.size()];
+        {
+            std::lock_guard<std::mutex> lock(worker->mMutex);
+
+            worker->mTasks.push_back(std::move(deliverTask));
+            mPendingTasks++;
+        }
+
+        /* only take the shared lock when somebody may be asleep */
+        if (mSleepingWorkers > 0) {
+            {
+                std::lock_guard<std::mutex> lock(mTaskMutex);
+            }
+
+            mTaskCondition.notify_one();
+        }
+
+        return true;
+    }
+
     class TASK_PACKAGE {
     public:
         TASK_PACKAGE(std::function<void(bool)> fn, std::shared_ptr<std::string> name) : mFn(std::move(fn)), mName(name) {
@@ -283,18 +445,23 @@ private:
     bool pushTaskPackge(std::shared_ptr<TASK_PACKAGE> deliverTask, uint64_t session) {
         std::lock_guard<std::mutex> lock(mCancelMutex);
 
+        if (mIsWorkStealing) {
+            return pushToWorker(std::move(deliverTask));
+        }
+
         /* push a task to list */
         {
             std::unique_lock<std::mutex> lock(mTaskMutex);
 
-            if (mIsSessionMode) {
-                deliverTask->mSession = session;
+            if (mExit) {
+                return false;
             }
 
-            if (!mExit) {
-                mTasks.push_back(std::move(deliverTask));
+            if (mIsSessionMode) {
+                deliverTask->mSession = session;
+                mSessionTasks[session].push_back(std::move(deliverTask));
             } else {
-                return false;
+                mTasks.push_back(std::move(deliverTask));
             }
         }
 
@@ -303,6 +470,58 @@ private:
         return true;
     }
 
+    /* should be called with mTaskMutex */
+    bool hasRunnableTask() {
+        if (mIsSessionMode) {
+            auto bucket = mSessionTasks.find(mSessionNumber->getCur());
+
+            return ((bucket != mSessionTasks.end()) &&
+                    (!bucket->second.empty()));
+        }
+
+        return (!mTasks.empty());
+    }
+
+    /* should be called with mTaskMutex */
+    std::shared_ptr<TASK_PACKAGE> popRunnableTask() {
+        std::shared_ptr<TASK_PACKAGE> task = nullptr;
+
+        if (mIsSessionMode) {
+            auto bucket = mSessionTasks.find(mSessionNumber->getCur());
+
+            if (bucket != mSessionTasks.end()) {
+                task = std::move(bucket->second.front());
+                bucket->second.pop_front();
+
+                if (bucket->second.empty()) {
+                    mSessionTasks.erase(bucket);
+                }
+            }
+        } else if (!mTasks.empty()) {
+            task = std::move(mTasks.front());
+            mTasks.pop_front();
+        }
+
+        return task;
+    }
+
+    /* should be called with mTaskMutex */
+    void discardSessionTasks() {
+        for (auto &bucket : mSessionTasks) {
+            for (auto &task : bucket.second) {
+                if (task.get() != nullptr) {
+                    ExynosLogT("[%s] discard a task :: session(%llu) name(%s)", __FUNCTION__,
+                                (unsigned long long)bucket.first, (task->mName->size() > 0)? task->mName->c_str():"unnamed");
+
+                    std::function<void(bool)> fn = std::move(task->mFn);
+                    fn(true);  /* discard */
+                }
+            }
+        }
+
+        mSessionTasks.clear();
+    }
+
     class SessionNumber {
     public:
         SessionNumber() : mCurSession(0), mNextSession(0) {
@@ -358,7 +577,7 @@ private:
     bool tossToSession(uint64_t session, std::string name, F &&f,
                                     std::function<void()> notify, Args&&... args);
 
-    bool mExit;
+    std::atomic<bool> mExit;
     std::vector<std::thread> mThreads;
 
     std::mutex mTaskMutex;
@@ -367,8 +586,15 @@ private:
 
     bool mIsSessionMode;
     std::shared_ptr<SessionNumber> mSessionNumber = nullptr;
+    std::map<uint64_t, std::deque<std::shared_ptr<TASK_PACKAGE>>> mSessionTasks;  /* session number -> FIFO */
 
     std::mutex mCancelMutex;
+
+    bool mIsWorkStealing;
+    std::vector<std::unique_ptr<WORKER>> mWorkers;
+    std::atomic<size_t> mNextWorker{0};
+    std::atomic<size_t> mPendingTasks{0};
+    std::atomic<size_t> mSleepingWorkers{0};
 };
 
 template<class F, class... Args>
@@ -402,7 +628,7 @@ decltype(auto) ExynosThreadPool::postToCurSession(F &&f, Args&&... args) {
     std::string name = "unnamed";
     std::function<void()> notify = nullptr;
 
-    return postToSession(mSessionNumber->getCur(), name, std::forward<F>(f), std::forward<Args>(args)...);
+    return postToSession(mSessionNumber->getCur(), name, std::forward<F>(f), std::move(notify), std::forward<Args>(args)...);
 }
 
 template<class F, class... Args>
@@ -443,7 +669,7 @@ bool ExynosThreadPool::tossToCurSession(F &&f, Args&&... args) {
     std::string name = "unnamed";
     std::function<void()> notify = nullptr;
 
-    return tossToSession(mSessionNumber->getCur(), name, std::forward<F>(f), std::forward<Args>(args)...);
+    return tossToSession(mSessionNumber->getCur(), name, std::forward<F>(f), std::move(notify), std::forward<Args>(args)...);
 }
 
 template<class F, class... Args>
@@ -0,0 +1,248 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * benchmark of passing ExynosBufferInfo through a sample chain by copy against by move.
+ * a frame is enqueued as an input and an output into maps as ExynosVideoCodec keeps them,
+ * dequeued, and returned to an owner through ExynosListener.
+ * copies are counted by blocks taken from the memory pool, a copy of params takes one.
+ * the result is a line of json.
+ *
+ * usage : ExynosC2BufferInfoBenchmark [-p params per frame] [-n frames]
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <getopt.h>
+#include <unistd.h>
+
+#include "ExynosBuffer.h"
+#include "ExynosListener.h"
+#include "ExynosMutex.h"
+#include "ExynosParam.h"
+#include "ExynosQueue.h"
+
+#define BENCH_DEFAULT_PARAMS  6
+#define BENCH_DEFAULT_FRAMES  200000
+#define BENCH_WARM_UP_FRAMES  8192  /* not measured, the pool and maps get ready */
+#define BENCH_BATCH_FRAMES    256
+
+using steady_clock = std::chrono::steady_clock;
+
+struct BenchConfig {
+    int32_t params = BENCH_DEFAULT_PARAMS;
+    int32_t frames = BENCH_DEFAULT_FRAMES;
+};
+
+static uint64_t PoolAllocCnt() {
+    uint64_t hit = 0, miss = 0;
+    ExynosMemoryPool::getInstance().getStatistics(hit, miss);
+
+    return (hit + miss);
+}
+
+class Owner : public ExynosListenerInterface {
+public:
+    bool processDone(ExynosBufferInfo &input, ExynosBufferInfo &output) override {
+        mChecksum += input.nID + output.params.size();
+        return true;
+    }
+
+    void eventReceived(std::shared_ptr<ExynosListenerEvent>) override { }
+
+    uint64_t mChecksum = 0;
+};
+
+class SampleChain {
+public:
+    SampleChain(std::shared_ptr<ExynosListener> notify, bool copy)
+        : mNotify(notify),
+          mCopy(copy) { }
+
+    void process(ExynosBufferInfo &&input, ExynosBufferInfo &&output, ExynosBufferInfo &buffer) {
+        {
+            ExynosMutex<ExynosMap<uint32_t, ExynosBufferInfo>>::LockObj inputs(mInputs);
+
+            if (mCopy) {
+                inputs->enqueue((uint32_t)input.nID, input);
+            } else {
+                inputs->enqueue((uint32_t)input.nID, std::move(input));
+            }
+        }
+
+        {
+            ExynosMutex<ExynosMap<uint64_t, ExynosBufferInfo>>::LockObj outputs(mOutputs);
+
+            if (mCopy) {
+                outputs->enqueue((uint64_t)output.obj.get(), output);
+            } else {
+                outputs->enqueue((uint64_t)output.obj.get(), std::move(output));
+            }
+        }
+
+        ExynosBufferInfo in, out;
+        ExynosBufferInfo::reset(in);
+        ExynosBufferInfo::reset(out);
+
+        {
+            ExynosMutex<ExynosMap<uint64_t, ExynosBufferInfo>>::LockObj outputs(mOutputs);
+            outputs->dequeue((uint64_t)buffer.obj.get(), out);
+        }
+
+        out.nID    = buffer.nID;
+        out.params = std::move(buffer.params);
+
+        {
+            ExynosMutex<ExynosMap<uint32_t, ExynosBufferInfo>>::LockObj inputs(mInputs);
+            inputs->dequeue((uint32_t)buffer.nID, in);
+        }
+
+        mNotify->processDone(in, out);
+    }
+
+private:
+    std::shared_ptr<ExynosListener> mNotify;
+    bool mCopy;
+
+    ExynosMutex<ExynosMap<uint32_t, ExynosBufferInfo>> mInputs;
+    ExynosMutex<ExynosMap<uint64_t, ExynosBufferInfo>> mOutputs;
+};
+
+/* a param of any index, only for the number of params */
+class BenchParam : public ExynosParamBase {
+public:
+    BenchParam(ParamIndex index) : mIndex(index) { }
+
+    ParamIndex index() override {
+        return mIndex;
+    }
+
+    std::string name() override {
+        return "bench";
+    }
+
+private:
+    ParamIndex mIndex;
+};
+
+static ExynosBufferInfo MakeInfo(const BenchConfig &config, std::shared_ptr<ExynosBuffer> buffer, int id) {
+    ExynosBufferInfo info;
+    ExynosBufferInfo::reset(info);
+
+    info.eDataInfo = DataInfo::SingleData;
+    info.obj       = buffer;
+    info.nID       = id;
+
+    for (int32_t i = 0; i < config.params; i++) {
+        info.params.addParam(MakePooledShared<BenchParam>(i + 1));
+    }
+
+    return info;
+}
+
+static std::string RunChain(const BenchConfig &config, bool copy) {
+    auto owner  = std::make_shared<Owner>();
+    auto notify = ExynosListener::makeListener(owner, "ExynosC2BufferInfoBenchmark");
+
+    SampleChain chain(notify, copy);
+
+    auto inBuffer  = std::make_shared<ExynosBuffer>();
+    auto outBuffer = std::make_shared<ExynosBuffer>();
+
+    /* infos are made ahead, only the chain is measured */
+    ExynosBufferInfo input  = MakeInfo(config, inBuffer, 0);
+    ExynosBufferInfo output = MakeInfo(config, outBuffer, 0);
+    ExynosBufferInfo buffer = MakeInfo(config, outBuffer, 0);
+
+    int64_t  elapsed = 0;
+    uint64_t copyCnt = 0;
+
+    /* infos of a batch are copied from them before the batch is measured */
+    std::vector<ExynosBufferInfo> ins(BENCH_BATCH_FRAMES), outs(BENCH_BATCH_FRAMES), bufs(BENCH_BATCH_FRAMES);
+
+    for (int32_t done = -BENCH_WARM_UP_FRAMES; done < config.frames; done += BENCH_BATCH_FRAMES) {
+        int32_t batch = std::min<int32_t>(BENCH_BATCH_FRAMES, (config.frames - done));
+
+        for (int32_t i = 0; i < batch; i++) {
+            ins[i]  = input;
+            outs[i] = output;
+            bufs[i] = buffer;
+
+            ins[i].nID  = done + i;
+            bufs[i].nID = done + i;
+        }
+
+        uint64_t allocCnt  = PoolAllocCnt();
+        auto     startTime = steady_clock::now();
+
+        for (int32_t i = 0; i < batch; i++) {
+            chain.process(std::move(ins[i]), std::move(outs[i]), bufs[i]);
+        }
+
+        if (done < 0) {
+            continue;
+        }
+
+        elapsed += std::chrono::duration_cast<std::chrono::nanoseconds>(steady_clock::now() - startTime).count();
+        copyCnt += PoolAllocCnt() - allocCnt;
+    }
+
+    return std::string("{\"pass\":\"") + ((copy)? "copy":"move") + "\"" +
+           ",\"copies_per_frame\":" + std::to_string((double)copyCnt / config.frames) +
+           ",\"ns_per_frame\":" + std::to_string((double)elapsed / config.frames) +
+           ",\"checksum\":" + std::to_string(owner->mChecksum) + "}";
+}
+
+static void Usage(const char *name) {
+    fprintf(stderr, "usage : %s [-p params per frame] [-n frames]\n", name);
+}
+
+int main(int argc, char **argv) {
+    BenchConfig config;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "p:n:")) != -1) {
+        switch (opt) {
+        case 'p': config.params = atoi(optarg); break;
+        case 'n': config.frames = atoi(optarg); break;
+        default:
+            Usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((config.params <= 0) || (config.frames <= 0)) {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    std::string report = "{\"params\":" + std::to_string(config.params) +
+                         ",\"frames\":" + std::to_string(config.frames) +
+                         ",\"results\":[" +
+                         RunChain(config, true) + "," +
+                         RunChain(config, false) + "]}";
+
+    printf("%s\n", report.c_str());
+
+    return 0;
+}
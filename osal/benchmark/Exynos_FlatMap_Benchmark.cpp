@@ -0,0 +1,161 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * benchmark of ExynosFlatMap against std::map, as params of a frame use them.
+ * maps have the given number of entries of shared_ptr, like ExynosParams.
+ * copy : a map is copied(a buffer info is copied)
+ * merge : a map is merged into a copy(params appended), a half of keys are the same
+ * lookup : every key is found, over the given number of maps not to be hot in cache
+ * the result is a line of json.
+ *
+ * usage : ExynosC2FlatMapBenchmark [-e entries] [-m maps] [-n iterations]
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+#include <unistd.h>
+
+#include "ExynosFlatMap.h"
+
+#define BENCH_DEFAULT_ENTRIES     6
+#define BENCH_DEFAULT_MAPS        8192
+#define BENCH_DEFAULT_ITERATIONS  200000
+
+using steady_clock = std::chrono::steady_clock;
+using Value        = std::shared_ptr<int>;
+
+struct BenchConfig {
+    int32_t entries    = BENCH_DEFAULT_ENTRIES;
+    int32_t maps       = BENCH_DEFAULT_MAPS;
+    int32_t iterations = BENCH_DEFAULT_ITERATIONS;
+};
+
+/* same interface for both */
+static void Merge(std::map<uint32_t, Value> &map, const std::map<uint32_t, Value> &other) {
+    for (auto &entry : other) {
+        map.insert_or_assign(entry.first, entry.second);
+    }
+}
+
+static void Merge(ExynosFlatMap<uint32_t, Value> &map, const ExynosFlatMap<uint32_t, Value> &other) {
+    map.merge(other);
+}
+
+/* keys of a param index, spread as ExynosParamIndex */
+static uint32_t KeyOf(int32_t i) {
+    return (uint32_t)((i * 3) + 1);
+}
+
+static double NsPerOp(steady_clock::time_point startTime, int64_t ops) {
+    int64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(steady_clock::now() - startTime).count();
+
+    return (ops > 0)? ((double)elapsed / ops):0;
+}
+
+template<class M>
+static std::string RunMap(const BenchConfig &config, const char *name) {
+    /* own : keys 0..entries-1, other : keys entries/2..entries+entries/2-1 */
+    M own, other;
+    for (int32_t i = 0; i < config.entries; i++) {
+        own.insert_or_assign(KeyOf(i), std::make_shared<int>(i));
+        other.insert_or_assign(KeyOf(i + (config.entries / 2)), std::make_shared<int>(i));
+    }
+
+    uint64_t checksum = 0;
+
+    auto startTime = steady_clock::now();
+    for (int32_t i = 0; i < config.iterations; i++) {
+        M copy = own;
+        checksum += copy.size();
+    }
+    double copyNs = NsPerOp(startTime, config.iterations);
+
+    startTime = steady_clock::now();
+    for (int32_t i = 0; i < config.iterations; i++) {
+        M copy = own;
+        Merge(copy, other);
+        checksum += copy.size();
+    }
+    double mergeNs = NsPerOp(startTime, config.iterations) - copyNs;
+
+    std::vector<M> maps(config.maps, own);
+
+    int64_t lookupCnt = 0;
+    startTime = steady_clock::now();
+    for (int32_t i = 0; i < config.iterations; i++) {
+        const M &map = maps[i % config.maps];
+
+        for (int32_t k = 0; k < config.entries; k++) {
+            auto it = map.find(KeyOf(k));
+            if (it != map.end()) {
+                checksum += *(it->second);
+            }
+        }
+
+        lookupCnt += config.entries;
+    }
+    double lookupNs = NsPerOp(startTime, lookupCnt);
+
+    return std::string("{\"map\":\"") + name + "\"" +
+           ",\"copy_ns\":" + std::to_string(copyNs) +
+           ",\"merge_ns\":" + std::to_string(mergeNs) +
+           ",\"lookup_ns\":" + std::to_string(lookupNs) +
+           ",\"checksum\":" + std::to_string(checksum) + "}";
+}
+
+static void Usage(const char *name) {
+    fprintf(stderr, "usage : %s [-e entries] [-m maps] [-n iterations]\n", name);
+}
+
+int main(int argc, char **argv) {
+    BenchConfig config;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "e:m:n:")) != -1) {
+        switch (opt) {
+        case 'e': config.entries    = atoi(optarg); break;
+        case 'm': config.maps       = atoi(optarg); break;
+        case 'n': config.iterations = atoi(optarg); break;
+        default:
+            Usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((config.entries <= 0) || (config.maps <= 0) || (config.iterations <= 0)) {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    std::string report = "{\"entries\":" + std::to_string(config.entries) +
+                         ",\"maps\":" + std::to_string(config.maps) +
+                         ",\"iterations\":" + std::to_string(config.iterations) +
+                         ",\"results\":[" +
+                         RunMap<std::map<uint32_t, Value>>(config, "std::map") + "," +
+                         RunMap<ExynosFlatMap<uint32_t, Value>>(config, "ExynosFlatMap") + "]}";
+
+    printf("%s\n", report.c_str());
+
+    return 0;
+}
@@ -0,0 +1,180 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * benchmark of ExynosRingQueue against ExynosQueue.
+ * producers and consumers pass the given number of items through a queue,
+ * a producer retries when the ring queue is full.
+ * the result is a line of json.
+ *
+ * usage : ExynosC2QueueBenchmark [-p producers] [-c consumers] [-n items per producer] [-q ring capacity]
+ */
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <getopt.h>
+#include <unistd.h>
+
+#include "ExynosQueue.h"
+
+#define BENCH_DEFAULT_PRODUCERS  2
+#define BENCH_DEFAULT_CONSUMERS  2
+#define BENCH_DEFAULT_ITEMS      500000
+#define BENCH_DEFAULT_CAPACITY   256
+
+using steady_clock = std::chrono::steady_clock;
+
+struct BenchConfig {
+    int32_t producers = BENCH_DEFAULT_PRODUCERS;
+    int32_t consumers = BENCH_DEFAULT_CONSUMERS;
+    int32_t items     = BENCH_DEFAULT_ITEMS;
+    int32_t capacity  = BENCH_DEFAULT_CAPACITY;
+};
+
+/* same interface for both, the ring queue reports full */
+static bool Push(ExynosRingQueue<uint64_t> &queue, uint64_t value) {
+    return queue.enqueue(std::move(value));
+}
+
+static bool Push(ExynosQueue<uint64_t> &queue, uint64_t value) {
+    queue.enqueue(std::move(value));
+    return true;
+}
+
+template<class Q>
+static std::string RunQueue(const BenchConfig &config, Q &queue, const char *name) {
+    std::atomic<int32_t>  doneProducers{0};
+    std::atomic<int64_t>  popCnt{0};
+    std::atomic<uint64_t> checksum{0};
+    std::atomic<int64_t>  fullCnt{0};
+
+    std::vector<std::thread> threads;
+
+    auto startTime = steady_clock::now();
+
+    for (int32_t p = 0; p < config.producers; p++) {
+        threads.emplace_back([&, p]() {
+                                 int64_t full = 0;
+
+                                 for (int32_t i = 0; i < config.items; i++) {
+                                     uint64_t value = ((uint64_t)p << 32) | (uint32_t)i;
+
+                                     while (!Push(queue, value)) {
+                                         full++;
+                                         std::this_thread::yield();
+                                     }
+                                 }
+
+                                 fullCnt += full;
+                                 doneProducers++;
+                             });
+    }
+
+    for (int32_t c = 0; c < config.consumers; c++) {
+        threads.emplace_back([&]() {
+                                 int64_t  cnt = 0;
+                                 uint64_t sum = 0;
+
+                                 while (true) {
+                                     uint64_t value = 0;
+
+                                     if (queue.dequeue(value)) {
+                                         cnt++;
+                                         sum += value;
+                                         continue;
+                                     }
+
+                                     if ((doneProducers.load() == config.producers) &&
+                                         (queue.empty())) {
+                                         break;
+                                     }
+
+                                     std::this_thread::yield();
+                                 }
+
+                                 popCnt += cnt;
+                                 checksum += sum;
+                             });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    int64_t elapsed = std::chrono::duration_cast<std::chrono::microseconds>(steady_clock::now() - startTime).count();
+    int64_t total   = (int64_t)config.producers * config.items;
+
+    uint64_t expected = 0;
+    for (int32_t p = 0; p < config.producers; p++) {
+        expected += ((uint64_t)p << 32) * config.items;
+        expected += ((uint64_t)config.items * (config.items - 1)) / 2;
+    }
+
+    return std::string("{\"queue\":\"") + name + "\"" +
+           ",\"items\":" + std::to_string(popCnt.load()) +
+           ",\"valid\":" + (((popCnt.load() == total) && (checksum.load() == expected))? "true":"false") +
+           ",\"elapsed_us\":" + std::to_string(elapsed) +
+           ",\"items_per_sec\":" + std::to_string((elapsed > 0)? (total * 1000000 / elapsed):0) +
+           ",\"full_retry\":" + std::to_string(fullCnt.load()) + "}";
+}
+
+static void Usage(const char *name) {
+    fprintf(stderr, "usage : %s [-p producers] [-c consumers] [-n items per producer] [-q ring capacity]\n", name);
+}
+
+int main(int argc, char **argv) {
+    BenchConfig config;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "p:c:n:q:")) != -1) {
+        switch (opt) {
+        case 'p': config.producers = atoi(optarg); break;
+        case 'c': config.consumers = atoi(optarg); break;
+        case 'n': config.items     = atoi(optarg); break;
+        case 'q': config.capacity  = atoi(optarg); break;
+        default:
+            Usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((config.producers <= 0) || (config.consumers <= 0) ||
+        (config.items <= 0) || (config.capacity <= 0)) {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    ExynosQueue<uint64_t>     listQueue;
+    ExynosRingQueue<uint64_t> ringQueue(config.capacity);
+
+    std::string report = "{\"producers\":" + std::to_string(config.producers) +
+                         ",\"consumers\":" + std::to_string(config.consumers) +
+                         ",\"items\":" + std::to_string(config.items) +
+                         ",\"capacity\":" + std::to_string(ringQueue.capacity()) +
+                         ",\"results\":[" +
+                         RunQueue(config, listQueue, "ExynosQueue") + "," +
+                         RunQueue(config, ringQueue, "ExynosRingQueue") + "]}";
+
+    printf("%s\n", report.c_str());
+
+    return 0;
+}
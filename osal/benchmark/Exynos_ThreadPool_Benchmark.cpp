@@ -0,0 +1,164 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * benchmark of ExynosThreadPool policies.
+ * the same set of tasks is tossed from several producers to SHARED_QUEUE and WORK_STEALING pools,
+ * a task spins for the given time and every n-th task is heavier to make workers imbalanced.
+ * the result is a line of json.
+ *
+ * usage : ExynosC2ThreadPoolBenchmark [-t workers] [-p producers] [-n tasks] [-w work_ns] [-i heavy_every] [-x heavy_factor]
+ */
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <getopt.h>
+#include <unistd.h>
+
+#include "ExynosThreadPool.h"
+
+#define BENCH_DEFAULT_WORKERS       4
+#define BENCH_DEFAULT_PRODUCERS     2
+#define BENCH_DEFAULT_TASKS         200000
+#define BENCH_DEFAULT_WORK_TIME     2000  /* ns */
+#define BENCH_DEFAULT_HEAVY_EVERY   16
+#define BENCH_DEFAULT_HEAVY_FACTOR  20
+
+using steady_clock = std::chrono::steady_clock;
+
+struct BenchConfig {
+    int32_t workers     = BENCH_DEFAULT_WORKERS;
+    int32_t producers   = BENCH_DEFAULT_PRODUCERS;
+    int32_t tasks       = BENCH_DEFAULT_TASKS;
+    int64_t workTime    = BENCH_DEFAULT_WORK_TIME;
+    int32_t heavyEvery  = BENCH_DEFAULT_HEAVY_EVERY;
+    int32_t heavyFactor = BENCH_DEFAULT_HEAVY_FACTOR;
+};
+
+static void Spin(int64_t ns) {
+    auto end = steady_clock::now() + std::chrono::nanoseconds(ns);
+
+    while (steady_clock::now() < end) {
+    }
+}
+
+static std::string RunPolicy(const BenchConfig &config, ExynosThreadPool::Policy policy, const char *name) {
+    std::atomic<int32_t> doneCnt{0};
+    int64_t elapsed = 0;
+    int64_t postTime = 0;
+
+    {
+        ExynosThreadPool pool(policy, config.workers, name);
+
+        std::vector<std::thread> producers;
+        std::atomic<int64_t>     postNs{0};
+
+        auto startTime = steady_clock::now();
+
+        for (int32_t p = 0; p < config.producers; p++) {
+            producers.emplace_back([&, p]() {
+                                        auto postStart = steady_clock::now();
+
+                                        for (int32_t i = p; i < config.tasks; i += config.producers) {
+                                            int64_t workTime = config.workTime;
+
+                                            if ((config.heavyEvery > 0) &&
+                                                ((i % config.heavyEvery) == 0)) {
+                                                workTime *= config.heavyFactor;
+                                            }
+
+                                            pool.toss([workTime, &doneCnt]() {
+                                                          Spin(workTime);
+                                                          doneCnt++;
+                                                          return 0;
+                                                      });
+                                        }
+
+                                        postNs += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                        steady_clock::now() - postStart).count();
+                                    });
+        }
+
+        for (auto &producer : producers) {
+            producer.join();
+        }
+
+        /* SHARED_QUEUE discards piled tasks on stop(), so wait for them here */
+        while (doneCnt.load() < config.tasks) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+
+        elapsed  = std::chrono::duration_cast<std::chrono::microseconds>(steady_clock::now() - startTime).count();
+        postTime = postNs.load() / config.tasks;
+    }
+
+    int64_t throughput = (elapsed > 0)? ((int64_t)doneCnt.load() * 1000000 / elapsed):0;
+
+    return std::string("{\"policy\":\"") + name + "\"" +
+           ",\"done\":" + std::to_string(doneCnt.load()) +
+           ",\"elapsed_us\":" + std::to_string(elapsed) +
+           ",\"tasks_per_sec\":" + std::to_string(throughput) +
+           ",\"post_ns\":" + std::to_string(postTime) + "}";
+}
+
+static void Usage(const char *name) {
+    fprintf(stderr, "usage : %s [-t workers] [-p producers] [-n tasks] [-w work_ns] [-i heavy_every(0: even)] [-x heavy_factor]\n", name);
+}
+
+int main(int argc, char **argv) {
+    BenchConfig config;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "t:p:n:w:i:x:")) != -1) {
+        switch (opt) {
+        case 't': config.workers     = atoi(optarg); break;
+        case 'p': config.producers   = atoi(optarg); break;
+        case 'n': config.tasks       = atoi(optarg); break;
+        case 'w': config.workTime    = atoll(optarg); break;
+        case 'i': config.heavyEvery  = atoi(optarg); break;
+        case 'x': config.heavyFactor = atoi(optarg); break;
+        default:
+            Usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((config.workers <= 0) || (config.producers <= 0) || (config.tasks <= 0) ||
+        (config.workTime < 0) || (config.heavyEvery < 0) || (config.heavyFactor <= 0)) {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    std::string report = "{\"workers\":" + std::to_string(config.workers) +
+                         ",\"producers\":" + std::to_string(config.producers) +
+                         ",\"tasks\":" + std::to_string(config.tasks) +
+                         ",\"work_ns\":" + std::to_string(config.workTime) +
+                         ",\"heavy_every\":" + std::to_string(config.heavyEvery) +
+                         ",\"heavy_factor\":" + std::to_string(config.heavyFactor) +
+                         ",\"results\":[" +
+                         RunPolicy(config, ExynosThreadPool::Policy::SHARED_QUEUE, "shared_queue") + "," +
+                         RunPolicy(config, ExynosThreadPool::Policy::WORK_STEALING, "work_stealing") + "]}";
+
+    printf("%s\n", report.c_str());
+
+    return 0;
+}
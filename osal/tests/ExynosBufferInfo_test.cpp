@@ -0,0 +1,229 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ExynosBuffer.h"
+#include "ExynosListener.h"
+#include "ExynosMutex.h"
+#include "ExynosParam.h"
+#include "ExynosQueue.h"
+
+#define TEST_FRAMES  1000
+
+namespace {
+
+/*
+ * a copy of ExynosBufferInfo with params copies its param map, which is one block from the pool.
+ * a move takes the block, so the pool is not touched.
+ */
+class CopyCounter {
+public:
+    CopyCounter() {
+        mStart = poolAllocCnt();
+    }
+
+    uint64_t count() {
+        return (poolAllocCnt() - mStart);
+    }
+
+private:
+    static uint64_t poolAllocCnt() {
+        uint64_t hit = 0, miss = 0;
+        ExynosMemoryPool::getInstance().getStatistics(hit, miss);
+
+        return (hit + miss);
+    }
+
+    uint64_t mStart;
+};
+
+/* the owner of a chain, as a component gets works done */
+class Owner : public ExynosListenerInterface {
+public:
+    bool processDone(ExynosBufferInfo &input, ExynosBufferInfo &output) override {
+        mDoneIDs.push_back(input.nID);
+
+        /* keeps what it needs only */
+        mLastParams = std::move(output.params);
+
+        return true;
+    }
+
+    void eventReceived(std::shared_ptr<ExynosListenerEvent>) override { }
+
+    std::vector<int> mDoneIDs;
+    ExynosParams     mLastParams;
+};
+
+/* the same way as ExynosVideoCodec keeps infos until a frame is done */
+class SampleCodec {
+public:
+    SampleCodec(std::shared_ptr<ExynosListener> notify, bool copy)
+        : mNotify(notify),
+          mCopy(copy) { }
+
+    bool inputEnqueue(ExynosBufferInfo &&input) {
+        ExynosMutex<ExynosMap<uint32_t, ExynosBufferInfo>>::LockObj inputs(mInputs);
+
+        if (mCopy) {
+            inputs->enqueue((uint32_t)input.nID, input);
+        } else {
+            inputs->enqueue((uint32_t)input.nID, std::move(input));
+        }
+
+        return true;
+    }
+
+    bool outputEnqueue(ExynosBufferInfo &&output) {
+        ExynosMutex<ExynosMap<uint64_t, ExynosBufferInfo>>::LockObj outputs(mOutputs);
+
+        if (mCopy) {
+            outputs->enqueue((uint64_t)output.obj.get(), output);
+        } else {
+            outputs->enqueue((uint64_t)output.obj.get(), std::move(output));
+        }
+
+        return true;
+    }
+
+    /* buffer is what the device returns */
+    bool outputDequeue(ExynosBufferInfo &buffer) {
+        ExynosBufferInfo input, output;
+        ExynosBufferInfo::reset(input);
+        ExynosBufferInfo::reset(output);
+
+        {
+            ExynosMutex<ExynosMap<uint64_t, ExynosBufferInfo>>::LockObj outputs(mOutputs);
+
+            if (outputs->dequeue((uint64_t)buffer.obj.get(), output) == false) {
+                return false;
+            }
+        }
+
+        output.nID    = buffer.nID;
+        output.params = std::move(buffer.params);
+
+        {
+            ExynosMutex<ExynosMap<uint32_t, ExynosBufferInfo>>::LockObj inputs(mInputs);
+
+            if (inputs->dequeue((uint32_t)buffer.nID, input) == false) {
+                return false;
+            }
+        }
+
+        input.eDataInfo = DataInfo::UsedData;
+
+        return mNotify->processDone(input, output);
+    }
+
+private:
+    std::shared_ptr<ExynosListener> mNotify;
+    bool mCopy;
+
+    ExynosMutex<ExynosMap<uint32_t, ExynosBufferInfo>> mInputs;
+    ExynosMutex<ExynosMap<uint64_t, ExynosBufferInfo>> mOutputs;
+};
+
+ExynosBufferInfo MakeInfo(std::shared_ptr<ExynosBuffer> buffer, int id) {
+    ExynosBufferInfo info;
+    ExynosBufferInfo::reset(info);
+
+    info.eDataInfo = DataInfo::SingleData;
+    info.obj       = buffer;
+    info.nID       = id;
+
+    auto bitrate = MakePooledShared<ExynosParam<ParamBitrate>>();
+    bitrate->m.bitrate = id;
+
+    info.params.addParam(bitrate);
+    info.params.addParam(MakePooledShared<ExynosParam<ParamInputCrop>>());
+
+    return info;
+}
+
+class ExynosBufferInfoTest : public ::testing::TestWithParam<bool> {
+protected:
+    void SetUp() override {
+        mOwner  = std::make_shared<Owner>();
+        mNotify = ExynosListener::makeListener(mOwner, "ExynosBufferInfoTest");
+        mCodec  = std::make_unique<SampleCodec>(mNotify, GetParam());
+    }
+
+    /* copies per frame through the chain */
+    double runFrames(int frames) {
+        auto inBuffer  = std::make_shared<ExynosBuffer>();
+        auto outBuffer = std::make_shared<ExynosBuffer>();
+
+        uint64_t copyCnt = 0;
+
+        for (int i = 0; i < frames; i++) {
+            ExynosBufferInfo input  = MakeInfo(inBuffer, i);
+            ExynosBufferInfo output = MakeInfo(outBuffer, i);
+            ExynosBufferInfo done   = MakeInfo(outBuffer, i);
+
+            CopyCounter counter;
+
+            EXPECT_TRUE(mCodec->inputEnqueue(std::move(input)));
+            EXPECT_TRUE(mCodec->outputEnqueue(std::move(output)));
+            EXPECT_TRUE(mCodec->outputDequeue(done));
+
+            copyCnt += counter.count();
+        }
+
+        /* nothing holds a buffer after frames are done */
+        EXPECT_EQ(1, inBuffer.use_count());
+        EXPECT_EQ(1, outBuffer.use_count());
+
+        return ((double)copyCnt / frames);
+    }
+
+    std::shared_ptr<Owner>          mOwner;
+    std::shared_ptr<ExynosListener> mNotify;
+    std::unique_ptr<SampleCodec>    mCodec;
+};
+
+}  // namespace
+
+TEST_P(ExynosBufferInfoTest, CopiesPerFrame) {
+    bool copy = GetParam();
+
+    runFrames(16);  /* warm up */
+
+    double copies = runFrames(TEST_FRAMES);
+
+    RecordProperty("copies_per_frame", std::to_string(copies));
+
+    /* the copying chain shows the counter works, an input and an output are copied once each */
+    EXPECT_EQ((copy)? 2.0:0.0, copies);
+
+    /* params reach the owner */
+    ASSERT_EQ((size_t)(16 + TEST_FRAMES), mOwner->mDoneIDs.size());
+    EXPECT_EQ(TEST_FRAMES - 1, mOwner->mDoneIDs.back());
+
+    auto bitrate = mOwner->mLastParams.getParam(ParamBitrate::INDEX);
+    ASSERT_NE(nullptr, bitrate);
+    EXPECT_EQ((uint32_t)(TEST_FRAMES - 1), std::static_pointer_cast<ExynosParam<ParamBitrate>>(bitrate)->m.bitrate);
+}
+
+INSTANTIATE_TEST_SUITE_P(All, ExynosBufferInfoTest, ::testing::Values(false, true),
+                         [](const ::testing::TestParamInfo<bool> &info) {
+                             return std::string((info.param)? "Copy":"Move");
+                         });
@@ -0,0 +1,300 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ExynosBufferManager.h"
+#include "ExynosParam.h"
+#include "ExynosQueue.h"
+
+#define TEST_THREADS     4
+#define TEST_BUFFERS     16  /* per thread, as many as DPB */
+#define TEST_ITERATIONS  2000
+
+namespace {
+
+uint32_t IndexOf(void *handle) {
+    return ((uint32_t)(uintptr_t)handle & SWAP_HANDLE_INDEX_MASK);
+}
+
+void* Swap(SharedPtrManager &manager, std::shared_ptr<ExynosBuffer> buffer) {
+    fds_t fds;
+    return manager.swapSharedPtrToPtr(buffer, fds);
+}
+
+void* Swap(SharedPtrManager &manager, std::shared_ptr<ExynosBuffer> buffer, uint32_t bitrate) {
+    fds_t fds;
+    ExynosParams params;
+
+    auto param = MakePooledShared<ExynosParam<ParamBitrate>>();
+    param->m.bitrate = bitrate;
+    params.addParam(param);
+
+    return manager.swapSharedPtrToPtr(buffer, fds, params);
+}
+
+uint32_t BitrateOf(ExynosParams &params) {
+    auto param = params.getParam(ParamBitrate::INDEX);
+    if (param == nullptr) {
+        return 0;
+    }
+
+    return std::static_pointer_cast<ExynosParam<ParamBitrate>>(param)->m.bitrate;
+}
+
+}  // namespace
+
+TEST(SharedPtrManagerTest, RecordIsReused) {
+    SharedPtrManager manager;
+    auto buffer = std::make_shared<ExynosBuffer>();
+
+    void *handle = Swap(manager, buffer);
+    ASSERT_NE(nullptr, handle);
+    EXPECT_EQ(1, manager.size());
+
+    EXPECT_EQ(buffer, manager.swapPtrToSharedPtr(handle));
+    EXPECT_EQ(0, manager.size());
+
+    /* the same record, no other one is taken */
+    for (int i = 0; i < TEST_ITERATIONS; i++) {
+        void *next = Swap(manager, buffer);
+
+        ASSERT_EQ(IndexOf(handle), IndexOf(next));
+        ASSERT_EQ(buffer, manager.swapPtrToSharedPtr(next));
+    }
+
+    EXPECT_EQ(1, buffer.use_count());
+}
+
+TEST(SharedPtrManagerTest, StaleHandleAfterGenerationReuse) {
+    SharedPtrManager manager;
+    auto buffer = std::make_shared<ExynosBuffer>();
+    auto other  = std::make_shared<ExynosBuffer>();
+
+    std::vector<void *> released;
+
+    void *handle = Swap(manager, buffer, 1);
+    ASSERT_NE(nullptr, handle);
+
+    for (uint32_t i = 0; i < TEST_ITERATIONS; i++) {
+        ExynosParams params;
+
+        ASSERT_EQ(buffer, manager.swapPtrToSharedPtr(handle, params)) << "iteration " << i;
+        ASSERT_EQ(i + 1, BitrateOf(params));
+        released.push_back(handle);
+
+        /* the record is taken by the other buffer with a new generation */
+        handle = Swap(manager, other, i + 2);
+        ASSERT_EQ(IndexOf(released.back()), IndexOf(handle));
+        ASSERT_NE(released.back(), handle);
+
+        /* the owner of the record is not given to an old handle */
+        ExynosParams staleParams;
+        ASSERT_EQ(nullptr, manager.swapPtrToSharedPtr(released.back(), staleParams));
+        ASSERT_EQ(0u, BitrateOf(staleParams));
+        ASSERT_EQ(1, manager.size());
+
+        std::swap(buffer, other);
+    }
+
+    /* no handle given before is valid */
+    for (auto stale : released) {
+        ASSERT_EQ(nullptr, manager.swapPtrToSharedPtr(stale));
+    }
+
+    EXPECT_EQ(1, manager.size());
+    EXPECT_NE(nullptr, manager.swapPtrToSharedPtr(handle));
+
+    /* handles which are not given at all */
+    EXPECT_EQ(nullptr, manager.swapPtrToSharedPtr((void *)(uintptr_t)SWAP_HANDLE_INDEX_MASK));
+    EXPECT_EQ(nullptr, manager.swapPtrToSharedPtr((void *)(uintptr_t)(SWAP_HANDLE_INDEX_MASK + 1)));
+}
+
+TEST(SharedPtrManagerTest, FlushMakesHandlesStale) {
+    SharedPtrManager manager;
+    std::vector<std::shared_ptr<ExynosBuffer>> buffers;
+    std::vector<void *> handles;
+
+    for (int i = 0; i < TEST_BUFFERS; i++) {
+        buffers.push_back(std::make_shared<ExynosBuffer>());
+        handles.push_back(Swap(manager, buffers.back()));
+    }
+
+    EXPECT_EQ(TEST_BUFFERS, manager.size());
+
+    manager.reset();
+    EXPECT_EQ(0, manager.size());
+
+    /* buffers are not held after a flush */
+    for (int i = 0; i < TEST_BUFFERS; i++) {
+        EXPECT_EQ(nullptr, manager.swapPtrToSharedPtr(handles[i]));
+        EXPECT_EQ(1, buffers[i].use_count());
+    }
+
+    /* records are reused by new handles */
+    for (int i = 0; i < TEST_BUFFERS; i++) {
+        void *handle = Swap(manager, buffers[i]);
+
+        EXPECT_LE(IndexOf(handle), (uint32_t)TEST_BUFFERS);
+        EXPECT_EQ(buffers[i], manager.swapPtrToSharedPtr(handle));
+    }
+
+    /* a buffer failed to be queued */
+    void *handle = Swap(manager, buffers[0]);
+    manager.eraseSharedPtr(buffers[0]);
+
+    EXPECT_EQ(nullptr, manager.swapPtrToSharedPtr(handle));
+    EXPECT_EQ(1, buffers[0].use_count());
+}
+
+TEST(SharedPtrManagerTest, ExhaustionAtIndexMask) {
+    SharedPtrManager manager;
+    auto buffer = std::make_shared<ExynosBuffer>();
+
+    std::set<void *> handles;
+
+    for (uint32_t i = 0; i < SWAP_HANDLE_INDEX_MASK; i++) {
+        void *handle = Swap(manager, buffer);
+
+        ASSERT_NE(nullptr, handle) << "record " << i;
+        ASSERT_TRUE(handles.insert(handle).second);
+    }
+
+    EXPECT_EQ((int)SWAP_HANDLE_INDEX_MASK, manager.size());
+
+    /* no record more, the buffer is not kept */
+    EXPECT_EQ(nullptr, Swap(manager, buffer));
+    EXPECT_EQ((long)(SWAP_HANDLE_INDEX_MASK + 1), buffer.use_count());
+
+    /* a released one is available again, without growing */
+    void *last = *handles.rbegin();
+    EXPECT_EQ(buffer, manager.swapPtrToSharedPtr(last));
+
+    void *handle = Swap(manager, buffer);
+    ASSERT_NE(nullptr, handle);
+    EXPECT_EQ(IndexOf(last), IndexOf(handle));
+    EXPECT_EQ(nullptr, Swap(manager, buffer));
+
+    manager.reset();
+    EXPECT_EQ(1, buffer.use_count());
+}
+
+TEST(SharedPtrManagerTest, ConcurrentSwaps) {
+    SharedPtrManager manager;
+    std::vector<std::thread> threads;
+    std::atomic<int> errors{0};
+
+    /* each thread swaps its own buffers in and out at once */
+    for (int t = 0; t < TEST_THREADS; t++) {
+        threads.emplace_back([&, t]() {
+                                 std::vector<std::shared_ptr<ExynosBuffer>> buffers;
+                                 std::vector<void *> handles(TEST_BUFFERS);
+
+                                 for (int i = 0; i < TEST_BUFFERS; i++) {
+                                     buffers.push_back(std::make_shared<ExynosBuffer>());
+                                 }
+
+                                 for (int n = 0; n < TEST_ITERATIONS; n++) {
+                                     for (int i = 0; i < TEST_BUFFERS; i++) {
+                                         handles[i] = Swap(manager, buffers[i], (t << 16) | i);
+                                     }
+
+                                     for (int i = 0; i < TEST_BUFFERS; i++) {
+                                         ExynosParams params;
+
+                                         if ((manager.swapPtrToSharedPtr(handles[i], params) != buffers[i]) ||
+                                             (BitrateOf(params) != (uint32_t)((t << 16) | i))) {
+                                             errors++;
+                                         }
+
+                                         /* it is given once */
+                                         if (manager.swapPtrToSharedPtr(handles[i]) != nullptr) {
+                                             errors++;
+                                         }
+                                     }
+                                 }
+
+                                 for (auto &buffer : buffers) {
+                                     if (buffer.use_count() != 1) {
+                                         errors++;
+                                     }
+                                 }
+                             });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0, errors.load());
+    EXPECT_EQ(0, manager.size());
+}
+
+/* the enqueue thread gives handles to the driver and the dequeue thread takes buffers back */
+TEST(SharedPtrManagerTest, EnqueueAndDequeueThreads) {
+    SharedPtrManager manager;
+    ExynosQueue<std::pair<void *, int>> queued;
+
+    std::vector<std::shared_ptr<ExynosBuffer>> buffers;
+    for (int i = 0; i < TEST_BUFFERS; i++) {
+        buffers.push_back(std::make_shared<ExynosBuffer>());
+    }
+
+    std::atomic<int> returned{0};
+
+    std::thread dequeueThread([&]() {
+                                  int done = 0;
+                                  while (done < (TEST_ITERATIONS * TEST_BUFFERS)) {
+                                      std::pair<void *, int> entry;
+                                      if (queued.dequeue(entry) == false) {
+                                          std::this_thread::yield();
+                                          continue;
+                                      }
+
+                                      EXPECT_EQ(buffers[entry.second], manager.swapPtrToSharedPtr(entry.first));
+                                      returned++;
+                                      done++;
+                                  }
+                              });
+
+    for (int n = 0; n < TEST_ITERATIONS; n++) {
+        for (int i = 0; i < TEST_BUFFERS; i++) {
+            void *handle = Swap(manager, buffers[i]);
+            ASSERT_NE(nullptr, handle);
+
+            queued.enqueue(std::make_pair(handle, i));
+        }
+
+        /* as many as DPB are in the driver at most */
+        while (returned.load() < (n * TEST_BUFFERS)) {
+            std::this_thread::yield();
+        }
+    }
+
+    dequeueThread.join();
+
+    EXPECT_EQ(0, manager.size());
+
+    for (auto &buffer : buffers) {
+        EXPECT_EQ(1, buffer.use_count());
+    }
+}
@@ -0,0 +1,191 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <map>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ExynosFlatMap.h"
+
+#define TEST_RANDOM_ROUNDS  5000
+
+using FlatMap = ExynosFlatMap<uint32_t, int>;
+
+namespace {
+
+std::vector<std::pair<uint32_t, int>> Entries(const FlatMap &map) {
+    return std::vector<std::pair<uint32_t, int>>(map.begin(), map.end());
+}
+
+std::vector<std::pair<uint32_t, int>> Entries(const std::map<uint32_t, int> &map) {
+    return std::vector<std::pair<uint32_t, int>>(map.begin(), map.end());
+}
+
+FlatMap MakeMap(std::initializer_list<std::pair<uint32_t, int>> entries) {
+    FlatMap map;
+
+    for (auto &entry : entries) {
+        map.insert_or_assign(entry.first, entry.second);
+    }
+
+    return map;
+}
+
+}  // namespace
+
+TEST(ExynosFlatMapTest, InsertOrAssignKeepsKeyOrder) {
+    FlatMap map;
+
+    EXPECT_TRUE(map.insert_or_assign(5, 50).second);
+    EXPECT_TRUE(map.insert_or_assign(1, 10).second);
+    EXPECT_TRUE(map.insert_or_assign(3, 30).second);
+
+    /* the same key is replaced */
+    auto ret = map.insert_or_assign(3, 31);
+    EXPECT_FALSE(ret.second);
+    EXPECT_EQ(31, ret.first->second);
+
+    EXPECT_EQ(Entries(MakeMap({ { 1, 10 }, { 3, 31 }, { 5, 50 } })), Entries(map));
+
+    EXPECT_NE(map.end(), map.find(5));
+    EXPECT_EQ(map.end(), map.find(4));
+    EXPECT_EQ(map.end(), map.find(6));
+}
+
+TEST(ExynosFlatMapTest, MergedValuesTakePrecedence) {
+    FlatMap own   = MakeMap({ { 1, 10 }, { 3, 30 }, { 5, 50 }, { 7, 70 } });
+    FlatMap other = MakeMap({ { 0, 1 }, { 3, 33 }, { 6, 66 }, { 7, 77 }, { 9, 99 } });
+
+    own.merge(other);
+
+    EXPECT_EQ(Entries(MakeMap({ { 0, 1 }, { 1, 10 }, { 3, 33 }, { 5, 50 }, { 6, 66 }, { 7, 77 }, { 9, 99 } })),
+              Entries(own));
+
+    /* the other one is not changed */
+    EXPECT_EQ(5u, other.size());
+    EXPECT_EQ(33, other.find(3)->second);
+}
+
+TEST(ExynosFlatMapTest, MergeWithEmptyOrItself) {
+    FlatMap map = MakeMap({ { 2, 20 }, { 4, 40 } });
+    FlatMap empty;
+
+    map.merge(empty);
+    EXPECT_EQ(Entries(MakeMap({ { 2, 20 }, { 4, 40 } })), Entries(map));
+
+    empty.merge(map);
+    EXPECT_EQ(Entries(map), Entries(empty));
+
+    map.merge(map);
+    EXPECT_EQ(Entries(MakeMap({ { 2, 20 }, { 4, 40 } })), Entries(map));
+}
+
+TEST(ExynosFlatMapTest, CopyIsIndependent) {
+    FlatMap map  = MakeMap({ { 1, 10 }, { 2, 20 } });
+    FlatMap copy = map;
+
+    copy.insert_or_assign(1, 11);
+    copy.insert_or_assign(3, 30);
+
+    EXPECT_EQ(Entries(MakeMap({ { 1, 10 }, { 2, 20 } })), Entries(map));
+    EXPECT_EQ(Entries(MakeMap({ { 1, 11 }, { 2, 20 }, { 3, 30 } })), Entries(copy));
+
+    FlatMap moved = std::move(copy);
+    EXPECT_EQ(3u, moved.size());
+
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+    EXPECT_EQ(moved.end(), moved.find(1));
+}
+
+TEST(ExynosFlatMapTest, ReleasesValuesReplaced) {
+    ExynosFlatMap<uint32_t, std::shared_ptr<int>> map;
+    ExynosFlatMap<uint32_t, std::shared_ptr<int>> other;
+
+    auto first  = std::make_shared<int>(1);
+    auto second = std::make_shared<int>(2);
+
+    map.insert_or_assign(1, first);
+    other.insert_or_assign(1, second);
+    ASSERT_EQ(2, first.use_count());
+
+    map.merge(other);
+    EXPECT_EQ(1, first.use_count());
+    EXPECT_EQ(3, second.use_count());
+    EXPECT_EQ(second, map.find(1)->second);
+}
+
+/* same as std::map on random insertion, merge and lookup, over the linear scan and binary search */
+TEST(ExynosFlatMapTest, MatchesStdMap) {
+    std::mt19937 random(1234);
+
+    FlatMap                 map;
+    std::map<uint32_t, int> ref;
+
+    for (int round = 0; round < TEST_RANDOM_ROUNDS; round++) {
+        uint32_t keyRange = ((round / 500) % 2 == 0)? 12:64;
+
+        switch (random() % 4) {
+        case 0: {
+            FlatMap                 other;
+            std::map<uint32_t, int> otherRef;
+
+            int cnt = random() % 8;
+            for (int i = 0; i < cnt; i++) {
+                uint32_t key   = random() % keyRange;
+                int      value = random();
+
+                other.insert_or_assign(key, value);
+                otherRef.insert_or_assign(key, value);
+            }
+
+            map.merge(other);
+            for (auto &entry : otherRef) {
+                ref.insert_or_assign(entry.first, entry.second);
+            }
+        } break;
+        case 1: {
+            uint32_t key = random() % keyRange;
+
+            auto it    = map.find(key);
+            auto refIt = ref.find(key);
+
+            ASSERT_EQ((refIt == ref.end()), (it == map.end()));
+            if (refIt != ref.end()) {
+                ASSERT_EQ(refIt->second, it->second);
+            }
+        } break;
+        default: {
+            uint32_t key   = random() % keyRange;
+            int      value = random();
+
+            ASSERT_EQ(ref.insert_or_assign(key, value).second,
+                      map.insert_or_assign(key, value).second);
+        } break;
+        }
+
+        if (random() % 200 == 0) {
+            map.clear();
+            ref.clear();
+        }
+
+        ASSERT_EQ(Entries(ref), Entries(map)) << "round " << round;
+    }
+}
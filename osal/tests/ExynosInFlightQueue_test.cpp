@@ -0,0 +1,396 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ExynosInFlightQueue.h"
+
+#define TEST_WAIT_TIME  std::chrono::seconds(5)  /* only for a failure not to hang */
+
+namespace {
+
+/*
+ * stands for the render engine : draw() returns a fence right away, and
+ * the fence is signaled only when the test completes the work.
+ */
+class FakeRenderEngine {
+public:
+    class Fence {
+    public:
+        void signal() {
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mSignaled = true;
+            }
+
+            mCondition.notify_all();
+        }
+
+        void wait() {
+            std::unique_lock<std::mutex> lock(mMutex);
+
+            mCondition.wait(lock, [this]() { return mSignaled; });
+        }
+
+    private:
+        std::mutex              mMutex;
+        std::condition_variable mCondition;
+        bool                    mSignaled = false;
+    };
+
+    std::shared_ptr<Fence> draw(int index) {
+        auto fence = std::make_shared<Fence>();
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            mDrawing[index] = fence;
+            mMaxDrawing = std::max(mMaxDrawing, mDrawing.size());
+        }
+
+        mCondition.notify_all();
+
+        return fence;
+    }
+
+    /* waits until cnt works are being drawn */
+    bool waitDrawing(size_t cnt) {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        return mCondition.wait_for(lock, TEST_WAIT_TIME, [this, cnt]() { return (mDrawing.size() >= cnt); });
+    }
+
+    void complete(int index) {
+        std::shared_ptr<Fence> fence;
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            auto it = mDrawing.find(index);
+            ASSERT_NE(mDrawing.end(), it);
+
+            fence = it->second;
+            mDrawing.erase(it);
+        }
+
+        fence->signal();
+    }
+
+    std::vector<int> drawing() {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        std::vector<int> indexes;
+        for (auto &entry : mDrawing) {
+            indexes.push_back(entry.first);
+        }
+
+        return indexes;
+    }
+
+    size_t maxDrawing() {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return mMaxDrawing;
+    }
+
+private:
+    std::mutex              mMutex;
+    std::condition_variable mCondition;
+
+    std::map<int, std::shared_ptr<Fence>> mDrawing;
+    size_t mMaxDrawing = 0;
+};
+
+/* same flow as ExynosToneMappingFilter : a submission thread and a completion thread */
+class Pipeline {
+public:
+    struct Work {
+        int index;
+        std::shared_ptr<FakeRenderEngine::Fence> fence;
+    };
+
+    Pipeline(uint32_t maxInFlight) {
+        mInFlightWorks.start(maxInFlight);
+
+        mSubmitThread   = std::thread([this]() { submitLoop(); });
+        mCompleteThread = std::thread([this]() { completeLoop(); });
+    }
+
+    ~Pipeline() {
+        stop();
+    }
+
+    void queue(int first, int cnt) {
+        {
+            std::lock_guard<std::mutex> lock(mQueueMutex);
+
+            for (int i = first; i < (first + cnt); i++) {
+                mQueue.push_back(i);
+            }
+        }
+
+        mQueueCondition.notify_all();
+    }
+
+    std::list<int> flush() {
+        std::list<int> flushed;
+
+        {
+            std::lock_guard<std::mutex> lock(mQueueMutex);
+            mQueue.swap(flushed);
+        }
+
+        mInFlightWorks.waitIdle();
+
+        return flushed;
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mQueueMutex);
+            mQuit = true;
+        }
+
+        mQueueCondition.notify_all();
+
+        if (mSubmitThread.joinable()) {
+            mSubmitThread.join();
+        }
+
+        if (mCompleteThread.joinable()) {
+            mCompleteThread.join();
+        }
+    }
+
+    std::vector<int> delivered() {
+        std::lock_guard<std::mutex> lock(mDeliveredMutex);
+
+        return mDelivered;
+    }
+
+    bool waitDelivered(size_t cnt) {
+        std::unique_lock<std::mutex> lock(mDeliveredMutex);
+
+        return mDeliveredCondition.wait_for(lock, TEST_WAIT_TIME, [this, cnt]() { return (mDelivered.size() >= cnt); });
+    }
+
+    FakeRenderEngine &engine() {
+        return mEngine;
+    }
+
+private:
+    void submitLoop() {
+        while (true) {
+            mInFlightWorks.waitRoom();
+
+            int index = 0;
+            {
+                std::unique_lock<std::mutex> lock(mQueueMutex);
+
+                mQueueCondition.wait(lock, [this]() { return ((mQuit) || (!mQueue.empty())); });
+                if (mQuit) {
+                    break;
+                }
+
+                index = mQueue.front();
+                mQueue.pop_front();
+                mInFlightWorks.take();
+            }
+
+            mInFlightWorks.submit({ index, mEngine.draw(index) });
+        }
+
+        mInFlightWorks.close();
+    }
+
+    void completeLoop() {
+        Work work;
+
+        while (mInFlightWorks.pop(work)) {
+            work.fence->wait();
+
+            {
+                std::lock_guard<std::mutex> lock(mDeliveredMutex);
+                mDelivered.push_back(work.index);
+            }
+
+            mDeliveredCondition.notify_all();
+            mInFlightWorks.done();
+        }
+    }
+
+    FakeRenderEngine mEngine;
+    ExynosInFlightQueue<Work> mInFlightWorks;
+
+    std::mutex              mQueueMutex;
+    std::condition_variable mQueueCondition;
+    std::list<int>          mQueue;
+    bool                    mQuit = false;
+
+    std::mutex              mDeliveredMutex;
+    std::condition_variable mDeliveredCondition;
+    std::vector<int>        mDelivered;
+
+    std::thread mSubmitThread;
+    std::thread mCompleteThread;
+};
+
+std::vector<int> Sequence(int first, int cnt) {
+    std::vector<int> indexes(cnt);
+
+    for (int i = 0; i < cnt; i++) {
+        indexes[i] = first + i;
+    }
+
+    return indexes;
+}
+
+}  // namespace
+
+TEST(ExynosInFlightQueueTest, DeliversInOrderOfSubmission) {
+    constexpr uint32_t kMaxInFlight = 3;
+    constexpr int      kWorkCnt     = 30;
+
+    Pipeline pipeline(kMaxInFlight);
+    pipeline.queue(0, kWorkCnt);
+
+    /* GPU finishes works of a batch in reverse order */
+    for (int done = 0; done < kWorkCnt; done += kMaxInFlight) {
+        size_t batch = std::min<size_t>(kMaxInFlight, (kWorkCnt - done));
+        ASSERT_TRUE(pipeline.engine().waitDrawing(batch));
+
+        auto drawing = pipeline.engine().drawing();
+        ASSERT_EQ(Sequence(done, batch), drawing);
+
+        for (auto it = drawing.rbegin(); it != drawing.rend(); it++) {
+            pipeline.engine().complete(*it);
+        }
+
+        ASSERT_TRUE(pipeline.waitDelivered(done + batch));
+    }
+
+    EXPECT_EQ(Sequence(0, kWorkCnt), pipeline.delivered());
+}
+
+TEST(ExynosInFlightQueueTest, KeepsEngineBusyUpToMaxInFlight) {
+    constexpr int kWorkCnt = 12;
+
+    for (uint32_t maxInFlight : { 1u, 2u, 3u, 4u }) {
+        SCOPED_TRACE(maxInFlight);
+
+        Pipeline pipeline(maxInFlight);
+        pipeline.queue(0, kWorkCnt);
+
+        /* whenever the engine finishes one, the next one is already drawn, up to maxInFlight */
+        for (int done = 0; done < kWorkCnt; done++) {
+            size_t expected = std::min<size_t>(maxInFlight, (kWorkCnt - done));
+            ASSERT_TRUE(pipeline.engine().waitDrawing(expected));
+            ASSERT_EQ(Sequence(done, expected), pipeline.engine().drawing());
+
+            pipeline.engine().complete(done);
+            ASSERT_TRUE(pipeline.waitDelivered(done + 1));
+        }
+
+        EXPECT_EQ((size_t)maxInFlight, pipeline.engine().maxDrawing());
+        EXPECT_EQ(Sequence(0, kWorkCnt), pipeline.delivered());
+    }
+}
+
+TEST(ExynosInFlightQueueTest, FlushWaitsForWorksTaken) {
+    constexpr uint32_t kMaxInFlight = 2;
+
+    Pipeline pipeline(kMaxInFlight);
+    pipeline.queue(0, 5);
+
+    ASSERT_TRUE(pipeline.engine().waitDrawing(kMaxInFlight));
+
+    auto flushResult = std::async(std::launch::async, [&pipeline]() { return pipeline.flush(); });
+
+    /* 0 and 1 are in flight, flush does not return until they are delivered */
+    EXPECT_EQ(std::future_status::timeout, flushResult.wait_for(std::chrono::milliseconds(50)));
+
+    pipeline.engine().complete(1);
+    pipeline.engine().complete(0);
+
+    ASSERT_EQ(std::future_status::ready, flushResult.wait_for(TEST_WAIT_TIME));
+
+    std::list<int> flushed = flushResult.get();
+    EXPECT_EQ(std::list<int>({ 2, 3, 4 }), flushed);
+    EXPECT_EQ(Sequence(0, 2), pipeline.delivered());
+
+    /* works after flush */
+    pipeline.queue(5, 2);
+    ASSERT_TRUE(pipeline.engine().waitDrawing(2));
+    pipeline.engine().complete(5);
+    pipeline.engine().complete(6);
+    ASSERT_TRUE(pipeline.waitDelivered(4));
+
+    EXPECT_EQ(std::vector<int>({ 0, 1, 5, 6 }), pipeline.delivered());
+}
+
+TEST(ExynosInFlightQueueTest, FlushWhileIdleReturnsAtOnce) {
+    Pipeline pipeline(3);
+
+    EXPECT_TRUE(pipeline.flush().empty());
+
+    pipeline.queue(0, 3);
+    ASSERT_TRUE(pipeline.engine().waitDrawing(3));
+    for (int i = 0; i < 3; i++) {
+        pipeline.engine().complete(i);
+    }
+    ASSERT_TRUE(pipeline.waitDelivered(3));
+
+    EXPECT_TRUE(pipeline.flush().empty());
+}
+
+TEST(ExynosInFlightQueueTest, CloseDeliversWorksInFlight) {
+    ExynosInFlightQueue<int> queue;
+    queue.start(3);
+
+    for (int i = 0; i < 3; i++) {
+        queue.take();
+        queue.submit(i);
+    }
+    queue.close();
+
+    int item = -1;
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(queue.pop(item));
+        EXPECT_EQ(i, item);
+        queue.done();
+    }
+
+    EXPECT_FALSE(queue.pop(item));
+    EXPECT_EQ(0u, queue.inFlightCnt());
+
+    /* a new session */
+    queue.start(1);
+    queue.take();
+    queue.submit(7);
+    ASSERT_TRUE(queue.pop(item));
+    EXPECT_EQ(7, item);
+}
@@ -0,0 +1,214 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <cutils/properties.h>
+
+#include "ExynosLog.h"
+#include "ExynosLogRing.h"
+
+#define TEST_BURSTS        200
+#define TEST_MAX_CALL_NS   20000  /* only for a broken ring(ex, waiting for the reader) */
+
+using steady_clock = std::chrono::steady_clock;
+
+namespace {
+
+bool Push(ExynosLogRing &ring, const char *msg, ...) {
+    va_list argptr;
+    va_start(argptr, msg);
+
+    bool ret = ring.push(4, "ExynosLogTest", msg, argptr);
+
+    va_end(argptr);
+
+    return ret;
+}
+
+/* a reader which keeps draining as the drainer does */
+class Reader {
+public:
+    Reader(ExynosLogRing &ring) : mRing(ring) {
+        mThread = std::thread([this]() {
+                                  while (!mQuit.load()) {
+                                      drain();
+                                      std::this_thread::yield();
+                                  }
+
+                                  drain();
+                              });
+    }
+
+    ~Reader() {
+        stop();
+    }
+
+    void stop() {
+        mQuit = true;
+
+        if (mThread.joinable()) {
+            mThread.join();
+        }
+    }
+
+    uint32_t drained() {
+        return mDrained.load();
+    }
+
+    std::vector<std::string> &messages() {
+        return mMessages;
+    }
+
+private:
+    void drain() {
+        uint32_t cnt = mRing.drain([this](const ExynosLogRing::Record &record) {
+                                       mMessages.push_back(record.msg);
+                                   });
+
+        mDrained += cnt;
+    }
+
+    ExynosLogRing &mRing;
+
+    std::thread               mThread;
+    std::atomic<bool>         mQuit{false};
+    std::atomic<uint32_t>     mDrained{0};
+    std::vector<std::string>  mMessages;
+};
+
+}  // namespace
+
+TEST(ExynosLogRingTest, NoLossBelowCapacity) {
+    ExynosLogRing ring(gettid());
+    Reader reader(ring);
+
+    /* bursts of the capacity, the next one waits until the previous one is drained */
+    uint32_t pushed = 0;
+    for (int burst = 0; burst < TEST_BURSTS; burst++) {
+        for (int i = 0; i < LOG_RING_RECORD_CNT; i++) {
+            ASSERT_TRUE(Push(ring, "msg %u", pushed));
+            pushed++;
+        }
+
+        while (reader.drained() < pushed) {
+            std::this_thread::yield();
+        }
+    }
+
+    reader.stop();
+
+    EXPECT_EQ(0u, ring.takeDropCnt());
+    ASSERT_EQ((size_t)pushed, reader.messages().size());
+
+    for (uint32_t i = 0; i < pushed; i++) {
+        ASSERT_EQ("msg " + std::to_string(i), reader.messages()[i]);
+    }
+}
+
+TEST(ExynosLogRingTest, OverCapacityIsDroppedAndCounted) {
+    ExynosLogRing ring(gettid());
+
+    for (int i = 0; i < (LOG_RING_RECORD_CNT + 10); i++) {
+        EXPECT_EQ((i < LOG_RING_RECORD_CNT), Push(ring, "msg %d", i));
+    }
+
+    EXPECT_EQ(10u, ring.takeDropCnt());
+    EXPECT_EQ(0u, ring.takeDropCnt());
+
+    std::vector<std::string> messages;
+    EXPECT_EQ((uint32_t)LOG_RING_RECORD_CNT, ring.drain([&messages](const ExynosLogRing::Record &record) {
+                                                            messages.push_back(record.msg);
+                                                        }));
+
+    /* the oldest ones are kept */
+    EXPECT_EQ("msg 0", messages.front());
+    EXPECT_EQ("msg " + std::to_string(LOG_RING_RECORD_CNT - 1), messages.back());
+
+    /* room again */
+    EXPECT_TRUE(Push(ring, "msg"));
+}
+
+TEST(ExynosLogRingTest, PerCallCost) {
+    ExynosLogRing ring(gettid());
+    Reader reader(ring);
+
+    int64_t  elapsed = 0;
+    uint32_t pushed  = 0;
+
+    for (int burst = 0; burst < TEST_BURSTS; burst++) {
+        auto startTime = steady_clock::now();
+
+        for (int i = 0; i < LOG_RING_RECORD_CNT; i++) {
+            Push(ring, "[%s] frame(%d) ts(%lld) fd(%d)", "outputDequeue", i, (long long)i * 33333, 42);
+        }
+
+        elapsed += std::chrono::duration_cast<std::chrono::nanoseconds>(steady_clock::now() - startTime).count();
+        pushed  += LOG_RING_RECORD_CNT;
+
+        while (reader.drained() < pushed) {
+            std::this_thread::yield();
+        }
+    }
+
+    double perCall = (double)elapsed / pushed;
+    RecordProperty("ns_per_call", std::to_string(perCall));
+
+    EXPECT_LT(perCall, TEST_MAX_CALL_NS);
+    EXPECT_EQ(0u, ring.takeDropCnt());
+}
+
+/*
+ * a thread_local object which logs in its destructor, after the ring of the thread is closed.
+ * it is constructed before the first log of the thread, so it is destroyed after the ring holder.
+ */
+struct LogOnExit {
+    ~LogOnExit() {
+        /* let the drainer release the closed ring */
+        std::this_thread::sleep_for(std::chrono::milliseconds(LOG_ASYNC_DRAIN_TIME * 4));
+
+        for (int i = 0; i < 10; i++) {
+            StaticExynosLogPrint(Level::Error, "ExynosLogTest", "exiting %d", i);
+        }
+    }
+};
+
+TEST(ExynosLogTest, ExitingThreadDoesNotUseReleasedRing) {
+    property_set("vendor.debug.c2.log.async", "true");
+    StaticExynosLogUpdateLevel();
+
+    for (int i = 0; i < 8; i++) {
+        std::thread([]() {
+                        thread_local LogOnExit logOnExit;
+                        (void)logOnExit;
+
+                        StaticExynosLogPrint(Level::Error, "ExynosLogTest", "running");
+                    }).join();
+    }
+
+    /* a released ring would be caught by a sanitizer on the logs above */
+    std::this_thread::sleep_for(std::chrono::milliseconds(LOG_ASYNC_DRAIN_TIME * 4));
+
+    property_set("vendor.debug.c2.log.async", "false");
+    StaticExynosLogUpdateLevel();
+}
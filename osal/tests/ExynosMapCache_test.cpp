@@ -0,0 +1,131 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "ExynosMapCache.h"
+
+#define TEST_MAP_SIZE 4096
+
+namespace {
+
+/* a memfd stands for a dmabuf */
+class MemFd {
+public:
+    MemFd() {
+        mFd = memfd_create("ExynosMapCacheTest", MFD_CLOEXEC);
+        EXPECT_EQ(0, ftruncate(mFd, TEST_MAP_SIZE));
+
+        mIno = ExynosMapCache::getStIno(mFd);
+    }
+
+    ~MemFd() {
+        ExynosMapCache::getInstance().invalidate(mIno);  /* inode can be reused after close */
+        close(mFd);
+    }
+
+    int fd() { return mFd; }
+    uint64_t ino() { return mIno; }
+
+private:
+    int mFd = -1;
+    uint64_t mIno = 0;
+};
+
+/* acquire() and release() at once, returns whether it was cached */
+bool Touch(MemFd &memFd, uint64_t owner) {
+    auto &cache = ExynosMapCache::getInstance();
+
+    uint64_t hit = 0, miss = 0;
+    cache.getStatistics(hit, miss);
+
+    void *addr = cache.acquire(memFd.fd(), memFd.ino(), 0, TEST_MAP_SIZE, owner);
+    EXPECT_NE(nullptr, addr);
+    cache.release(addr, TEST_MAP_SIZE);
+
+    uint64_t hitAfter = 0, missAfter = 0;
+    cache.getStatistics(hitAfter, missAfter);
+
+    return (hitAfter > hit);
+}
+
+}  // namespace
+
+TEST(ExynosMapCacheTest, DropsIdleMappingsOfOwnerOnly) {
+    constexpr uint64_t kOwnerA = 0xA;
+    constexpr uint64_t kOwnerB = 0xB;
+
+    MemFd bufferA, bufferB;
+
+    EXPECT_FALSE(Touch(bufferA, kOwnerA));
+    EXPECT_FALSE(Touch(bufferB, kOwnerB));
+    EXPECT_TRUE(Touch(bufferA, kOwnerA));
+
+    ExynosMapCache::getInstance().drop(kOwnerA);
+
+    EXPECT_FALSE(Touch(bufferA, kOwnerA));  /* mapped again */
+    EXPECT_TRUE(Touch(bufferB, kOwnerB));   /* the other instance keeps it */
+}
+
+TEST(ExynosMapCacheTest, DropKeepsMappingsInUse) {
+    constexpr uint64_t kOwner = 0xC;
+
+    auto &cache = ExynosMapCache::getInstance();
+    MemFd buffer;
+
+    auto addr = static_cast<uint8_t *>(cache.acquire(buffer.fd(), buffer.ino(), 0, TEST_MAP_SIZE, kOwner));
+    ASSERT_NE(nullptr, addr);
+
+    cache.drop(kOwner);
+    addr[0] = 1;  /* still mapped */
+
+    cache.release(addr, TEST_MAP_SIZE);
+    EXPECT_TRUE(Touch(buffer, kOwner));
+}
+
+TEST(ExynosMapCacheTest, LastUserOwnsMapping) {
+    constexpr uint64_t kOwnerA = 0xD;
+    constexpr uint64_t kOwnerB = 0xE;
+
+    MemFd buffer;
+
+    EXPECT_FALSE(Touch(buffer, kOwnerA));
+    EXPECT_TRUE(Touch(buffer, kOwnerB));  /* ex, a buffer passed to another instance */
+
+    ExynosMapCache::getInstance().drop(kOwnerA);
+    EXPECT_TRUE(Touch(buffer, kOwnerB));
+
+    ExynosMapCache::getInstance().drop(kOwnerB);
+    EXPECT_FALSE(Touch(buffer, kOwnerB));
+}
+
+TEST(ExynosMapCacheTest, InvalidateUnmapsAfterLastRelease) {
+    auto &cache = ExynosMapCache::getInstance();
+    MemFd buffer;
+
+    auto addr = static_cast<uint8_t *>(cache.acquire(buffer.fd(), buffer.ino(), 0, TEST_MAP_SIZE));
+    ASSERT_NE(nullptr, addr);
+
+    /* released while it is in use, the mapping is kept until release() */
+    cache.invalidate(buffer.ino());
+    addr[0] = 1;
+
+    cache.release(addr, TEST_MAP_SIZE);
+    EXPECT_FALSE(Touch(buffer, 0));
+}
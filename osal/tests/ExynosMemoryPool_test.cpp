@@ -0,0 +1,116 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ExynosMemoryPool.h"
+
+TEST(ExynosMemoryPoolTest, BlocksReleasedByOtherThreadsAreReused) {
+    constexpr size_t kBlockSize = MEMORY_POOL_MAX_BLOCK_SIZE;  /* a class nobody else uses here */
+    constexpr int32_t kBlockCnt = MEMORY_POOL_THREAD_CACHE_CNT + 64;
+
+    auto &pool = ExynosMemoryPool::getInstance();
+
+    std::vector<void *> blocks;
+    for (int32_t i = 0; i < kBlockCnt; i++) {
+        blocks.push_back(pool.allocate(kBlockSize));
+    }
+
+    /* the cache of the releasing thread is filled first, the rest goes to the shared list */
+    std::thread releaser([&]() {
+                             for (auto block : blocks) {
+                                 pool.release(block, kBlockSize);
+                             }
+                         });
+    releaser.join();  /* cache of the thread is also flushed to the shared list on exit */
+
+    uint64_t hit = 0, miss = 0;
+    pool.getStatistics(hit, miss);
+
+    std::set<void *> released(blocks.begin(), blocks.end());
+    std::vector<void *> again;
+
+    for (int32_t i = 0; i < kBlockCnt; i++) {
+        again.push_back(pool.allocate(kBlockSize));
+        EXPECT_EQ(1u, released.count(again.back()));
+    }
+
+    uint64_t hitAfter = 0, missAfter = 0;
+    pool.getStatistics(hitAfter, missAfter);
+
+    EXPECT_EQ(miss, missAfter);
+    EXPECT_EQ(hit + kBlockCnt, hitAfter);
+
+    for (auto block : again) {
+        pool.release(block, kBlockSize);
+    }
+}
+
+TEST(ExynosMemoryPoolTest, ConcurrentAllocateAndRelease) {
+    constexpr int32_t kThreadCnt = 4;
+    constexpr int32_t kLoopCnt   = 20000;
+
+    auto &pool = ExynosMemoryPool::getInstance();
+
+    /* blocks go around threads, so most of them pass through the shared lists */
+    ExynosRingQueue<void *> handOver(1024);
+    std::atomic<bool> corrupted{false};
+    std::vector<std::thread> threads;
+
+    for (int32_t t = 0; t < kThreadCnt; t++) {
+        threads.emplace_back([&, t]() {
+                                 for (int32_t i = 0; i < kLoopCnt; i++) {
+                                     size_t size = 16 + (((t + i) % 8) * 16);
+                                     auto block = static_cast<uint8_t *>(pool.allocate(size));
+
+                                     block[0] = (uint8_t)size;
+                                     block[size - 1] = (uint8_t)size;
+
+                                     void *other = nullptr;
+                                     if (handOver.dequeue(other)) {
+                                         auto otherBlock = static_cast<uint8_t *>(other);
+                                         size_t otherSize = otherBlock[0];
+
+                                         if (otherBlock[otherSize - 1] != otherSize) {
+                                             corrupted = true;
+                                         }
+
+                                         pool.release(other, otherSize);
+                                     }
+
+                                     if (!handOver.enqueue(block)) {
+                                         pool.release(block, size);
+                                     }
+                                 }
+                             });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    void *left = nullptr;
+    while (handOver.dequeue(left)) {
+        pool.release(left, static_cast<uint8_t *>(left)[0]);
+    }
+
+    EXPECT_FALSE(corrupted.load());
+}
@@ -0,0 +1,164 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ExynosQueue.h"
+
+TEST(ExynosRingQueueTest, RoundsCapacityUpAndRejectsWhenFull) {
+    ExynosRingQueue<int32_t> queue(5);
+
+    ASSERT_EQ(8u, queue.capacity());
+    EXPECT_TRUE(queue.empty());
+
+    for (int32_t i = 0; i < 8; i++) {
+        EXPECT_TRUE(queue.enqueue(std::move(i)));
+    }
+
+    int32_t extra = 100;
+    EXPECT_FALSE(queue.enqueue(extra));
+    EXPECT_EQ(8, queue.size());
+
+    /* FIFO, and a cell freed by dequeue can be used again */
+    for (int32_t round = 0; round < 3; round++) {
+        for (int32_t i = 0; i < 8; i++) {
+            int32_t value = -1;
+
+            ASSERT_TRUE(queue.dequeue(value));
+            EXPECT_EQ((round * 8) + i, value);
+            EXPECT_TRUE(queue.enqueue(((round + 1) * 8) + i));
+        }
+    }
+
+    queue.clear();
+    EXPECT_TRUE(queue.empty());
+
+    int32_t value = -1;
+    EXPECT_FALSE(queue.dequeue(value));
+}
+
+TEST(ExynosRingQueueTest, MovesOutAndReleasesOnDequeue) {
+    ExynosRingQueue<std::shared_ptr<int32_t>> queue(4);
+
+    auto element = std::make_shared<int32_t>(7);
+    std::weak_ptr<int32_t> weak = element;
+
+    ASSERT_TRUE(queue.enqueue(std::move(element)));
+    EXPECT_EQ(nullptr, element);
+
+    std::shared_ptr<int32_t> out;
+    ASSERT_TRUE(queue.dequeue(out));
+    EXPECT_EQ(1, out.use_count());  /* the cell does not keep a reference */
+
+    out.reset();
+    EXPECT_TRUE(weak.expired());
+
+    /* clear() releases what is left */
+    element = std::make_shared<int32_t>(8);
+    weak = element;
+    ASSERT_TRUE(queue.enqueue(std::move(element)));
+    queue.clear();
+    EXPECT_TRUE(weak.expired());
+}
+
+TEST(ExynosRingQueueTest, MultiProducerMultiConsumerStress) {
+    constexpr int32_t kProducerCnt = 4;
+    constexpr int32_t kConsumerCnt = 4;
+    constexpr int32_t kItemCnt     = 200000;  /* per producer */
+
+    ExynosRingQueue<uint64_t> queue(64);
+
+    std::atomic<int32_t> doneProducers{0};
+    std::vector<std::vector<uint32_t>> received(kConsumerCnt * kProducerCnt);
+    std::atomic<bool> orderBroken{false};
+
+    std::vector<std::thread> threads;
+
+    for (int32_t p = 0; p < kProducerCnt; p++) {
+        threads.emplace_back([&, p]() {
+                                 for (uint32_t i = 0; i < (uint32_t)kItemCnt; i++) {
+                                     uint64_t value = ((uint64_t)p << 32) | i;
+
+                                     while (!queue.enqueue(std::move(value))) {
+                                         std::this_thread::yield();
+                                     }
+                                 }
+
+                                 doneProducers++;
+                             });
+    }
+
+    for (int32_t c = 0; c < kConsumerCnt; c++) {
+        threads.emplace_back([&, c]() {
+                                 std::vector<int64_t> last(kProducerCnt, -1);
+
+                                 while (true) {
+                                     uint64_t value = 0;
+
+                                     if (!queue.dequeue(value)) {
+                                         if ((doneProducers.load() == kProducerCnt) &&
+                                             (queue.empty())) {
+                                             break;
+                                         }
+
+                                         std::this_thread::yield();
+                                         continue;
+                                     }
+
+                                     int32_t  producer = (int32_t)(value >> 32);
+                                     uint32_t index    = (uint32_t)value;
+
+                                     /* items of a producer are seen in posting order by every consumer */
+                                     if ((int64_t)index <= last[producer]) {
+                                         orderBroken = true;
+                                     }
+                                     last[producer] = index;
+
+                                     received[(c * kProducerCnt) + producer].push_back(index);
+                                 }
+                             });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_FALSE(orderBroken.load());
+
+    /* nothing is lost or duplicated */
+    for (int32_t p = 0; p < kProducerCnt; p++) {
+        std::vector<uint8_t> seen(kItemCnt, 0);
+        int32_t total = 0;
+
+        for (int32_t c = 0; c < kConsumerCnt; c++) {
+            for (auto index : received[(c * kProducerCnt) + p]) {
+                ASSERT_LT(index, (uint32_t)kItemCnt);
+                ASSERT_EQ(0, seen[index]) << "producer " << p << " item " << index;
+                seen[index] = 1;
+                total++;
+            }
+        }
+
+        EXPECT_EQ(kItemCnt, total);
+    }
+
+    EXPECT_TRUE(queue.empty());
+}
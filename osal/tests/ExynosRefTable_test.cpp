@@ -0,0 +1,210 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ExynosQueue.h"
+#include "ExynosRefTable.h"
+
+#define TEST_THREADS     4
+#define TEST_KEYS        (REF_TABLE_SHARD_CNT * 4)  /* per thread, over all shards */
+#define TEST_ITERATIONS  2000
+
+namespace {
+
+/* keys of a thread, spread over all shards and not shared with the other threads */
+uint64_t KeyOf(int thread, int i) {
+    return ((uint64_t)thread * TEST_KEYS) + i + 1;
+}
+
+}  // namespace
+
+TEST(ExynosRefTableTest, CountsAndReferences) {
+    ExynosRefTable<int> table;
+    auto obj = std::make_shared<int>(1);
+
+    EXPECT_EQ(-1, table.del(1));
+
+    EXPECT_EQ(1, table.add(1, obj));
+    EXPECT_EQ(2, table.add(1, obj));
+    EXPECT_EQ(1, table.registeredCount());
+    EXPECT_EQ(1, table.referencedCount());
+
+    EXPECT_EQ(1, table.del(1));
+    EXPECT_EQ(0, table.referencedCount());
+    EXPECT_TRUE(table.find(1));
+
+    /* the object is dropped with the last one */
+    EXPECT_EQ(0, table.del(1));
+    EXPECT_FALSE(table.find(1));
+    EXPECT_EQ(0, table.registeredCount());
+    EXPECT_EQ(1, obj.use_count());
+}
+
+TEST(ExynosRefTableTest, ConcurrentAddDelAcrossShards) {
+    ExynosRefTable<int> table;
+
+    /* keys shared by all threads, one of each shard */
+    std::vector<std::shared_ptr<int>> shared;
+    for (int i = 0; i < REF_TABLE_SHARD_CNT; i++) {
+        shared.push_back(std::make_shared<int>(i));
+    }
+
+    /* registered before, so that it stays while threads add and delete it */
+    for (int i = 0; i < REF_TABLE_SHARD_CNT; i++) {
+        table.add(i, shared[i]);
+    }
+
+    std::vector<std::thread> threads;
+    std::atomic<int> errors{0};
+
+    for (int t = 0; t < TEST_THREADS; t++) {
+        threads.emplace_back([&, t]() {
+                                 std::vector<std::shared_ptr<int>> objs;
+                                 for (int i = 0; i < TEST_KEYS; i++) {
+                                     objs.push_back(std::make_shared<int>(i));
+                                 }
+
+                                 for (int n = 0; n < TEST_ITERATIONS; n++) {
+                                     for (int i = 0; i < TEST_KEYS; i++) {
+                                         /* own keys are not touched by the others, so that counts are exact */
+                                         if ((table.add(KeyOf(t + 1, i), objs[i]) != 1) ||
+                                             (table.add(KeyOf(t + 1, i), objs[i]) != 2)) {
+                                             errors++;
+                                         }
+
+                                         if (table.add(i % REF_TABLE_SHARD_CNT, shared[i % REF_TABLE_SHARD_CNT]) < 2) {
+                                             errors++;
+                                         }
+
+                                         if ((table.del(KeyOf(t + 1, i)) != 1) ||
+                                             (table.del(KeyOf(t + 1, i)) != 0)) {
+                                             errors++;
+                                         }
+
+                                         if (table.del(i % REF_TABLE_SHARD_CNT) < 1) {
+                                             errors++;
+                                         }
+                                     }
+                                 }
+
+                                 /* nothing of the thread is left in the table */
+                                 for (int i = 0; i < TEST_KEYS; i++) {
+                                     if ((table.find(KeyOf(t + 1, i))) ||
+                                         (objs[i].use_count() != 1)) {
+                                         errors++;
+                                     }
+                                 }
+                             });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0, errors.load());
+
+    /* only shared keys are left, with the count before */
+    EXPECT_EQ(REF_TABLE_SHARD_CNT, table.registeredCount());
+    EXPECT_EQ(0, table.referencedCount());
+
+    for (int i = 0; i < REF_TABLE_SHARD_CNT; i++) {
+        EXPECT_EQ(0, table.del(i));
+        EXPECT_EQ(1, shared[i].use_count());
+    }
+
+    EXPECT_EQ(0, table.registeredCount());
+}
+
+/* the enqueue thread adds references and the dequeue thread drops them, as DPB of a decoder */
+TEST(ExynosRefTableTest, EnqueueAndDequeueThreads) {
+    ExynosRefTable<int> table;
+    ExynosQueue<uint64_t> queued;
+
+    std::thread dequeueThread([&]() {
+                                  int done = 0;
+                                  while (done < (TEST_ITERATIONS * TEST_KEYS)) {
+                                      uint64_t key = 0;
+                                      if (queued.dequeue(key) == false) {
+                                          std::this_thread::yield();
+                                          continue;
+                                      }
+
+                                      EXPECT_GE(table.del(key), 0);
+                                      done++;
+                                  }
+                              });
+
+    auto obj = std::make_shared<int>(0);
+
+    for (int n = 0; n < TEST_ITERATIONS; n++) {
+        for (int i = 0; i < TEST_KEYS; i++) {
+            uint64_t key = KeyOf(0, i);
+
+            table.add(key, obj);
+            queued.enqueue(key);
+        }
+    }
+
+    dequeueThread.join();
+
+    EXPECT_EQ(0, table.registeredCount());
+    EXPECT_EQ(0, table.referencedCount());
+    EXPECT_EQ(1, obj.use_count());
+}
+
+TEST(ExynosRefTableTest, BoundFdIsReadWithoutLock) {
+    ExynosRefTable<int> table;
+    std::atomic<bool> quit{false};
+    std::atomic<int>  errors{0};
+
+    /* a reader sees a key which has been bound to the fd, never a torn one */
+    std::thread reader([&]() {
+                           while (!quit.load()) {
+                               for (int fd = 0; fd < REF_TABLE_SHARD_CNT; fd++) {
+                                   auto key = table.getKeyOfFd(fd);
+                                   if ((key.has_value()) &&
+                                       ((*key % REF_TABLE_SHARD_CNT) != (uint64_t)fd)) {
+                                       errors++;
+                                   }
+                               }
+                           }
+                       });
+
+    for (int n = 1; n <= TEST_ITERATIONS * 10; n++) {
+        for (int fd = 0; fd < REF_TABLE_SHARD_CNT; fd++) {
+            /* a key of 64 bits, its upper half changes as well */
+            table.bindFd(fd, ((uint64_t)n << 32) * REF_TABLE_SHARD_CNT + fd);
+        }
+    }
+
+    quit = true;
+    reader.join();
+
+    EXPECT_EQ(0, errors.load());
+
+    /* fds out of the range are not bound */
+    table.bindFd(REF_TABLE_FD_CNT, 1);
+    EXPECT_FALSE(table.getKeyOfFd(REF_TABLE_FD_CNT).has_value());
+
+    table.clear();
+    EXPECT_FALSE(table.getKeyOfFd(0).has_value());
+}
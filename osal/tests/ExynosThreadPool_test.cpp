@@ -0,0 +1,330 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ExynosThreadPool.h"
+
+#define TEST_WAIT_TIME  std::chrono::seconds(5)
+
+namespace {
+
+/* holds workers inside of a task until it is opened */
+class Gate {
+public:
+    ~Gate() {
+        /* do not leave workers blocked when a test fails in the middle */
+        open();
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        mWaiters++;
+        mCond.notify_all();
+        mCond.wait(lock, [this]() { return mOpened; });
+    }
+
+    bool waitForWaiters(int32_t cnt) {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        return mCond.wait_for(lock, TEST_WAIT_TIME, [this, cnt]() { return (mWaiters >= cnt); });
+    }
+
+    void open() {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            mOpened = true;
+        }
+
+        mCond.notify_all();
+    }
+
+private:
+    std::mutex              mMutex;
+    std::condition_variable mCond;
+    int32_t                 mWaiters = 0;
+    bool                    mOpened = false;
+};
+
+}  // namespace
+
+TEST(ExynosThreadPoolTest, WorkStealingRunsEveryTask) {
+    constexpr int32_t kTaskCnt = 20000;
+
+    std::atomic<int32_t> ranCnt{0};
+    {
+        ExynosThreadPool pool(ExynosThreadPool::Policy::WORK_STEALING, 4, "test");
+
+        for (int32_t i = 0; i < kTaskCnt; i++) {
+            ASSERT_TRUE(pool.toss([&ranCnt]() { ranCnt++; return 0; }));
+        }
+
+        auto result = pool.post([](int32_t a) { return a * 2; }, 21);
+        EXPECT_EQ(42, WaitGetResultFromFuture(result, -1));
+    }
+
+    EXPECT_EQ(kTaskCnt, ranCnt.load());
+}
+
+TEST(ExynosThreadPoolTest, WorkStealingSingleWorkerKeepsOrder) {
+    ExynosThreadPool pool(ExynosThreadPool::Policy::WORK_STEALING, 1, "test");
+
+    std::mutex           orderMutex;
+    std::vector<int32_t> order;
+    std::vector<std::future<int32_t>> results;
+
+    for (int32_t i = 0; i < 100; i++) {
+        results.push_back(pool.post([&, i]() {
+                                        std::lock_guard<std::mutex> lock(orderMutex);
+
+                                        order.push_back(i);
+                                        return i;
+                                    }));
+    }
+
+    for (auto &result : results) {
+        WaitGetResultFromFuture(result, -1);
+    }
+
+    ASSERT_EQ(100u, order.size());
+    for (int32_t i = 0; i < 100; i++) {
+        EXPECT_EQ(i, order[i]);
+    }
+}
+
+TEST(ExynosThreadPoolTest, IdleWorkerStealsFromBlockedWorker) {
+    ExynosThreadPool pool(ExynosThreadPool::Policy::WORK_STEALING, 2, "test");
+
+    Gate gate;
+    std::thread::id blockedId;
+
+    /* occupy one worker, tasks pushed to its deque can be done only by stealing */
+    pool.toss([&]() { blockedId = std::this_thread::get_id(); gate.wait(); return 0; });
+    ASSERT_TRUE(gate.waitForWaiters(1));
+
+    std::mutex                 idMutex;
+    std::set<std::thread::id>  runIds;
+    std::vector<std::future<int32_t>> results;
+
+    /* tasks are distributed to both deques in turn */
+    for (int32_t i = 0; i < 16; i++) {
+        results.push_back(pool.post([&, i]() {
+                                        std::lock_guard<std::mutex> lock(idMutex);
+
+                                        runIds.insert(std::this_thread::get_id());
+                                        return i;
+                                    }));
+    }
+
+    for (int32_t i = 0; i < 16; i++) {
+        ASSERT_EQ(std::future_status::ready, results[i].wait_for(TEST_WAIT_TIME));
+        EXPECT_EQ(i, results[i].get());
+    }
+
+    /* everything was done by the other worker while the first one was blocked */
+    ASSERT_EQ(1u, runIds.size());
+    EXPECT_NE(blockedId, *runIds.begin());
+
+    gate.open();
+}
+
+TEST(ExynosThreadPoolTest, StopDrainsPendingTasks) {
+    constexpr int32_t kTaskCnt = 1000;
+
+    ExynosThreadPool pool(ExynosThreadPool::Policy::WORK_STEALING, 2, "test");
+
+    Gate gate;
+    std::atomic<int32_t> ranCnt{0};
+    std::vector<std::future<int32_t>> results;
+
+    pool.toss([&]() { gate.wait(); return 0; });
+    pool.toss([&]() { gate.wait(); return 0; });
+    ASSERT_TRUE(gate.waitForWaiters(2));
+
+    for (int32_t i = 0; i < kTaskCnt; i++) {
+        results.push_back(pool.post([&ranCnt]() { ranCnt++; return 1; }));
+    }
+
+    std::thread stopper([&pool]() { pool.stop(); });
+
+    /* stop() has to wait for the piled tasks, not only for the running ones */
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(0, ranCnt.load());
+
+    gate.open();
+    stopper.join();
+
+    EXPECT_EQ(kTaskCnt, ranCnt.load());
+    for (auto &result : results) {
+        ASSERT_EQ(std::future_status::ready, result.wait_for(std::chrono::seconds(0)));
+        EXPECT_EQ(1, result.get());
+    }
+
+    /* nothing is accepted after stop */
+    EXPECT_FALSE(pool.toss([]() { return 0; }));
+    EXPECT_FALSE(pool.post([]() { return 0; }).valid());
+}
+
+TEST(ExynosThreadPoolTest, FlushDiscardsPendingTasks) {
+    constexpr int32_t kTaskCnt = 64;
+
+    ExynosThreadPool pool(ExynosThreadPool::Policy::WORK_STEALING, 2, "test");
+
+    Gate gate;
+    std::atomic<int32_t> ranCnt{0};
+    std::atomic<int32_t> notifyCnt{0};
+    std::vector<std::future<int32_t>> results;
+
+    pool.toss([&]() { gate.wait(); return 0; });
+    pool.toss([&]() { gate.wait(); return 0; });
+    ASSERT_TRUE(gate.waitForWaiters(2));
+
+    for (int32_t i = 0; i < kTaskCnt; i++) {
+        std::function<void()> notify = [&notifyCnt]() { notifyCnt++; };
+
+        results.push_back(pool.post([&ranCnt]() { ranCnt++; return 1; }, std::move(notify)));
+    }
+
+    pool.flush();
+
+    /* a discarded task is completed with the default value, and its notify is called */
+    for (auto &result : results) {
+        ASSERT_EQ(std::future_status::ready, result.wait_for(std::chrono::seconds(0)));
+        EXPECT_EQ(0, result.get());
+    }
+    EXPECT_EQ(kTaskCnt, notifyCnt.load());
+
+    gate.open();
+    pool.stop();
+
+    EXPECT_EQ(0, ranCnt.load());
+}
+
+TEST(ExynosThreadPoolTest, SessionKeepsFifoOrder) {
+    ExynosThreadPool pool(true, 1, "test");
+
+    std::mutex           orderMutex;
+    std::vector<int32_t> order;
+    std::vector<std::future<int32_t>> results;
+
+    for (int32_t i = 0; i < 100; i++) {
+        results.push_back(pool.post([&, i]() {
+                                        std::lock_guard<std::mutex> lock(orderMutex);
+
+                                        order.push_back(i);
+                                        return i;
+                                    }));
+    }
+
+    for (auto &result : results) {
+        ASSERT_EQ(std::future_status::ready, result.wait_for(TEST_WAIT_TIME));
+    }
+
+    ASSERT_EQ(100u, order.size());
+    for (int32_t i = 0; i < 100; i++) {
+        EXPECT_EQ(i, order[i]);
+    }
+}
+
+TEST(ExynosThreadPoolTest, IncCurSessionWakesPiledTasks) {
+    ExynosThreadPool pool(true, 2, "test");
+
+    std::mutex           orderMutex;
+    std::vector<int32_t> order;
+
+    auto record = [&](int32_t value) {
+                      std::lock_guard<std::mutex> lock(orderMutex);
+
+                      order.push_back(value);
+                      return value;
+                  };
+
+    /* tasks of the next session are piled while the current one is running */
+    pool.incNextSession();
+
+    std::vector<std::future<int32_t>> nextResults;
+    for (int32_t i = 0; i < 8; i++) {
+        nextResults.push_back(pool.post(record, 100 + i));
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    for (auto &result : nextResults) {
+        EXPECT_EQ(std::future_status::timeout, result.wait_for(std::chrono::seconds(0)));
+    }
+
+    /* the current session is not blocked by them */
+    auto curResult = pool.postToCurSession(record, 0);
+    ASSERT_EQ(std::future_status::ready, curResult.wait_for(TEST_WAIT_TIME));
+    EXPECT_EQ(0, curResult.get());
+    EXPECT_EQ(0u, pool.getCurSession());
+
+    /* sleeping workers have to be woken up by moving to the next session */
+    pool.incCurSession();
+    EXPECT_EQ(1u, pool.getCurSession());
+
+    for (int32_t i = 0; i < 8; i++) {
+        ASSERT_EQ(std::future_status::ready, nextResults[i].wait_for(TEST_WAIT_TIME));
+        EXPECT_EQ(100 + i, nextResults[i].get());
+    }
+
+    std::lock_guard<std::mutex> lock(orderMutex);
+    ASSERT_EQ(9u, order.size());
+    EXPECT_EQ(0, order[0]);
+}
+
+TEST(ExynosThreadPoolTest, ClearSessionDiscardsPiledTasks) {
+    constexpr int32_t kTaskCnt = 32;
+
+    ExynosThreadPool pool(true, 2, "test");
+
+    std::atomic<int32_t> ranCnt{0};
+    std::vector<std::future<int32_t>> results;
+
+    /* piled on sessions which never become current */
+    for (int32_t s = 0; s < 2; s++) {
+        pool.incNextSession();
+
+        for (int32_t i = 0; i < (kTaskCnt / 2); i++) {
+            results.push_back(pool.post([&ranCnt]() { ranCnt++; return 1; }));
+        }
+    }
+
+    pool.clearSession();
+    EXPECT_EQ(0u, pool.getCurSession());
+
+    for (auto &result : results) {
+        ASSERT_EQ(std::future_status::ready, result.wait_for(std::chrono::seconds(0)));
+        EXPECT_EQ(0, result.get());
+    }
+
+    /* numbers are restarted, so a new task of session 0 runs right away */
+    auto result = pool.post([&ranCnt]() { ranCnt++; return 2; });
+    ASSERT_EQ(std::future_status::ready, result.wait_for(TEST_WAIT_TIME));
+    EXPECT_EQ(2, result.get());
+
+    EXPECT_EQ(1, ranCnt.load());
+}
@@ -8,7 +8,8 @@ LOCAL_CFLAGS :=
 LOCAL_MODULE_TAGS := optional
 
 LOCAL_SRC_FILES := \
-        Exynos_C2_FilterPlugin.cpp
+        Exynos_C2_FilterPlugin.cpp \
+        ExynosToneMapper.cpp
 
 LOCAL_C_INCLUDES :=
 
@@ -61,3 +62,42 @@ LOCAL_CFLAGS += $(EXYNOS_GLOBAL_CFLAGS)
 
 include $(BUILD_SHARED_LIBRARY)
 
+
+#################################
+####  ExynosToneMapperTest  #####
+#################################
+include $(CLEAR_VARS)
+
+LOCAL_CFLAGS :=
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_SRC_FILES := \
+        ExynosToneMapper.cpp \
+        ../osal/ExynosLog.cpp \
+        tests/ExynosToneMapper_test.cpp
+
+LOCAL_C_INCLUDES := \
+        $(LOCAL_PATH)/../include \
+        $(LOCAL_PATH)/../osal
+
+LOCAL_MODULE := ExynosToneMapperTest
+LOCAL_LICENSE_KINDS := SPDX-license-identifier-Apache-2.0
+LOCAL_LICENSE_CONDITIONS := notice
+LOCAL_NOTICE_FILE := $(LOCAL_PATH)/NOTICE
+
+LOCAL_HEADER_LIBRARIES := libsystem_headers libcutils_headers
+LOCAL_HEADER_LIBRARIES += $(EXYNOS_VENDOR_HEADER_LIBS)
+
+LOCAL_SHARED_LIBRARIES := \
+        liblog \
+        libcutils
+
+LOCAL_CFLAGS +=	-O2 \
+                -Werror \
+                -Wall \
+                -Wno-deprecated-enum-enum-conversion \
+                -std=gnu++1z \
+                -std=c++2a
+LOCAL_CFLAGS += $(EXYNOS_GLOBAL_CFLAGS)
+
+include $(BUILD_HOST_NATIVE_TEST)
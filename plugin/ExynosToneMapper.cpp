@@ -0,0 +1,358 @@
+/*
+ *
+ * Copyright 2020 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#define USE_TONE_MAPPER_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define USE_TONE_MAPPER_SSE2
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "ExynosToneMapper.h"
+
+#define LOG_ON
+#include "ExynosLog.h"
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "ExynosToneMapper"
+
+/* SMPTE ST 2084 */
+static constexpr double kPQ_M1 = 2610.0 / 16384.0;
+static constexpr double kPQ_M2 = (2523.0 / 4096.0) * 128.0;
+static constexpr double kPQ_C1 = 3424.0 / 4096.0;
+static constexpr double kPQ_C2 = (2413.0 / 4096.0) * 32.0;
+static constexpr double kPQ_C3 = (2392.0 / 4096.0) * 32.0;
+static constexpr double kPQ_MaxLuminance = 10000.0;
+
+/* ARIB STD-B67 */
+static constexpr double kHLG_A = 0.17883277;
+static constexpr double kHLG_B = 0.28466892;
+static constexpr double kHLG_C = 0.55991073;
+static constexpr double kHLG_Gamma = 1.2;
+
+/* linear BT.2020 -> linear BT.709 */
+static const double kBT2020toBT709[3][3] = {
+    {  1.660491, -0.587641, -0.072850 },
+    { -0.124550,  1.132900, -0.008349 },
+    { -0.018151, -0.100579,  1.118730 },
+};
+
+static const double kIdentity[3][3] = {
+    { 1.0, 0.0, 0.0 },
+    { 0.0, 1.0, 0.0 },
+    { 0.0, 0.0, 1.0 },
+};
+
+static double PQ_EOTF(double code) {
+    double p = pow(std::clamp(code, 0.0, 1.0), 1.0 / kPQ_M2);
+
+    return kPQ_MaxLuminance * pow(std::max(p - kPQ_C1, 0.0) / (kPQ_C2 - (kPQ_C3 * p)), 1.0 / kPQ_M1);
+}
+
+static double PQ_InvEOTF(double nits) {
+    double p = pow(std::clamp(nits / kPQ_MaxLuminance, 0.0, 1.0), kPQ_M1);
+
+    return pow((kPQ_C1 + (kPQ_C2 * p)) / (1.0 + (kPQ_C3 * p)), kPQ_M2);
+}
+
+ExynosToneMapper::ExynosToneMapper(std::string name)
+    : mRunner(name),
+      mConfigured(false) {
+    memset(mMatrix, 0, sizeof(mMatrix));
+}
+
+void ExynosToneMapper::setThreadInfo(uint32_t threads, uint32_t stripeHeight) {
+    mRunner.setThreadInfo(threads, stripeHeight);
+}
+
+double ExynosToneMapper::decode(const Config &config, double code) {
+    if (config.transfer == Transfer::HLG) {
+        /* OOTF is applied per channel instead of on luminance, in order to be a LUT */
+        double e = std::clamp(code, 0.0, 1.0);
+        double scene = (e <= 0.5)? ((e * e) / 3.0):((exp((e - kHLG_C) / kHLG_A) + kHLG_B) / 12.0);
+
+        return config.sourceLuminance * pow(scene, kHLG_Gamma);
+    }
+
+    return PQ_EOTF(code);
+}
+
+double ExynosToneMapper::eetf(const Config &config, double nits) {
+    /* ITU-R BT.2390, black level is regarded as 0 */
+    if (config.sourceLuminance <= config.targetLuminance) {
+        return std::min(nits, (double)config.targetLuminance);
+    }
+
+    double srcPeak = PQ_InvEOTF(config.sourceLuminance);
+    double maxLum  = PQ_InvEOTF(config.targetLuminance) / srcPeak;
+    double ks      = (1.5 * maxLum) - 0.5;
+    double e1      = std::clamp(PQ_InvEOTF(nits) / srcPeak, 0.0, 1.0);
+    double e2      = e1;
+
+    if (e1 > ks) {
+        double t  = (e1 - ks) / (1.0 - ks);
+        double t2 = t * t;
+        double t3 = t2 * t;
+
+        e2 = (((2 * t3) - (3 * t2) + 1) * ks) +
+             ((t3 - (2 * t2) + t) * (1.0 - ks)) +
+             (((-2 * t3) + (3 * t2)) * maxLum);
+    }
+
+    return PQ_EOTF(e2 * srcPeak);
+}
+
+double ExynosToneMapper::encodeSRGB(double linear) {
+    linear = std::clamp(linear, 0.0, 1.0);
+
+    return (linear <= 0.0031308)? (12.92 * linear):((1.055 * pow(linear, 1.0 / 2.4)) - 0.055);
+}
+
+uint32_t ExynosToneMapper::mapReference(const Config &config, double r, double g, double b) {
+    const auto &matrix = (config.bt2020)? kBT2020toBT709:kIdentity;
+
+    double in[3] = { decode(config, r) / config.sourceLuminance,
+                     decode(config, g) / config.sourceLuminance,
+                     decode(config, b) / config.sourceLuminance };
+    uint32_t out = 0xFF000000;
+
+    for (int i = 0; i < 3; i++) {
+        double linear = std::clamp((matrix[i][0] * in[0]) + (matrix[i][1] * in[1]) + (matrix[i][2] * in[2]), 0.0, 1.0);
+        double mapped = eetf(config, linear * config.sourceLuminance) / config.targetLuminance;
+
+        out |= ((uint32_t)lround(encodeSRGB(mapped) * 255.0)) << (i * 8);
+    }
+
+    return out;
+}
+
+void ExynosToneMapper::configure(const Config &config) {
+    if ((mConfigured) &&
+        (mConfig == config)) {
+        return;
+    }
+
+    mConfig = config;
+    if (mConfig.sourceLuminance <= 0) {
+        mConfig.sourceLuminance = 1000;
+    }
+    if (mConfig.targetLuminance <= 0) {
+        mConfig.targetLuminance = 500;
+    }
+
+    mInLut.resize(kInLutSize);
+    for (int i = 0; i < kInLutSize; i++) {
+        mInLut[i] = (float)(decode(mConfig, (double)i / (kInLutSize - 1)) / mConfig.sourceLuminance);
+    }
+
+    /* indexed by sqrt of linear to keep precision of dark area */
+    mOutLut.resize(kOutLutSize);
+    for (int i = 0; i < kOutLutSize; i++) {
+        double linear = (double)i / (kOutLutSize - 1);
+        double mapped = eetf(mConfig, (linear * linear) * mConfig.sourceLuminance) / mConfig.targetLuminance;
+
+        mOutLut[i] = (uint8_t)lround(encodeSRGB(mapped) * 255.0);
+    }
+
+    const auto &matrix = (mConfig.bt2020)? kBT2020toBT709:kIdentity;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            mMatrix[i][j] = (float)matrix[i][j];
+        }
+    }
+
+    mConfigured = true;
+
+    StaticExynosLog(Level::Info, LOG_TAG, "[%s] transfer(%s), bt2020(%d), luminance(%.0f -> %.0f)", __FUNCTION__,
+                        (mConfig.transfer == Transfer::HLG)? "HLG":"PQ", mConfig.bt2020,
+                        mConfig.sourceLuminance, mConfig.targetLuminance);
+}
+
+void ExynosToneMapper::mapBlock(float *r, float *g, float *b, int n, uint32_t *dst) const {
+    const float scale = (float)(kOutLutSize - 1);
+
+    int32_t idxR[kBlockSize];
+    int32_t idxG[kBlockSize];
+    int32_t idxB[kBlockSize];
+
+    int x = 0;
+
+#if defined(USE_TONE_MAPPER_NEON)
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t one  = vdupq_n_f32(1.0f);
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    const float32x4_t vScale = vdupq_n_f32(scale);
+
+    for (; (x + 4) <= n; x += 4) {
+        float32x4_t inR = vld1q_f32(r + x);
+        float32x4_t inG = vld1q_f32(g + x);
+        float32x4_t inB = vld1q_f32(b + x);
+
+        float32x4_t out[3];
+        for (int i = 0; i < 3; i++) {
+            out[i] = vmulq_n_f32(inR, mMatrix[i][0]);
+            out[i] = vmlaq_n_f32(out[i], inG, mMatrix[i][1]);
+            out[i] = vmlaq_n_f32(out[i], inB, mMatrix[i][2]);
+            out[i] = vsqrtq_f32(vminq_f32(vmaxq_f32(out[i], zero), one));
+            out[i] = vmlaq_f32(half, out[i], vScale);
+        }
+
+        vst1q_s32(idxR + x, vcvtq_s32_f32(out[0]));
+        vst1q_s32(idxG + x, vcvtq_s32_f32(out[1]));
+        vst1q_s32(idxB + x, vcvtq_s32_f32(out[2]));
+    }
+#elif defined(USE_TONE_MAPPER_SSE2)
+    const __m128 zero = _mm_set1_ps(0.0f);
+    const __m128 one  = _mm_set1_ps(1.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 vScale = _mm_set1_ps(scale);
+
+    for (; (x + 4) <= n; x += 4) {
+        __m128 inR = _mm_loadu_ps(r + x);
+        __m128 inG = _mm_loadu_ps(g + x);
+        __m128 inB = _mm_loadu_ps(b + x);
+
+        __m128 out[3];
+        for (int i = 0; i < 3; i++) {
+            out[i] = _mm_mul_ps(inR, _mm_set1_ps(mMatrix[i][0]));
+            out[i] = _mm_add_ps(out[i], _mm_mul_ps(inG, _mm_set1_ps(mMatrix[i][1])));
+            out[i] = _mm_add_ps(out[i], _mm_mul_ps(inB, _mm_set1_ps(mMatrix[i][2])));
+            out[i] = _mm_sqrt_ps(_mm_min_ps(_mm_max_ps(out[i], zero), one));
+            out[i] = _mm_add_ps(_mm_mul_ps(out[i], vScale), half);
+        }
+
+        _mm_storeu_si128((__m128i *)(idxR + x), _mm_cvttps_epi32(out[0]));
+        _mm_storeu_si128((__m128i *)(idxG + x), _mm_cvttps_epi32(out[1]));
+        _mm_storeu_si128((__m128i *)(idxB + x), _mm_cvttps_epi32(out[2]));
+    }
+#endif
+
+    for (; x < n; x++) {
+        float out[3];
+        for (int i = 0; i < 3; i++) {
+            out[i] = (mMatrix[i][0] * r[x]) + (mMatrix[i][1] * g[x]) + (mMatrix[i][2] * b[x]);
+            out[i] = (std::sqrt(std::clamp(out[i], 0.0f, 1.0f)) * scale) + 0.5f;
+        }
+
+        idxR[x] = (int32_t)out[0];
+        idxG[x] = (int32_t)out[1];
+        idxB[x] = (int32_t)out[2];
+    }
+
+    const uint8_t *lut = mOutLut.data();
+    for (x = 0; x < n; x++) {
+        dst[x] = (uint32_t)lut[idxR[x]] |
+                 ((uint32_t)lut[idxG[x]] << 8) |
+                 ((uint32_t)lut[idxB[x]] << 16) |
+                 0xFF000000;
+    }
+}
+
+void ExynosToneMapper::processRGBA1010102(
+    const uint32_t *src, uint32_t srcStride,
+    uint32_t *dst, uint32_t dstStride,
+    uint32_t width, uint32_t height) const {
+    const float *lut = mInLut.data();
+
+    auto stripe = [&](int start, int end) {
+        float r[kBlockSize];
+        float g[kBlockSize];
+        float b[kBlockSize];
+
+        for (int y = start; y < end; y++) {
+            const uint32_t *pSrc = src + ((size_t)y * srcStride);
+            uint32_t       *pDst = dst + ((size_t)y * dstStride);
+
+            for (uint32_t x = 0; x < width; x += kBlockSize) {
+                int n = (int)std::min<uint32_t>(kBlockSize, (width - x));
+
+                for (int i = 0; i < n; i++) {
+                    uint32_t pixel = pSrc[x + i];
+
+                    r[i] = lut[pixel & 0x3FF];
+                    g[i] = lut[(pixel >> 10) & 0x3FF];
+                    b[i] = lut[(pixel >> 20) & 0x3FF];
+                }
+
+                mapBlock(r, g, b, n, pDst + x);
+            }
+        }
+    };
+
+    mRunner.run(height, stripe);
+}
+
+void ExynosToneMapper::processYUV420P10(
+    const uint8_t *srcY, uint32_t yStride,
+    const uint8_t *srcCb, const uint8_t *srcCr, uint32_t cStride, uint32_t chromaStep,
+    uint32_t *dst, uint32_t dstStride,
+    uint32_t width, uint32_t height) const {
+    const float *lut = mInLut.data();
+
+    /* Y'CbCr(code) -> R'G'B'(code) */
+    const float yScale  = (mConfig.fullRange)? 1.0f:(1023.0f / 876.0f);
+    const float yOffset = (mConfig.fullRange)? 0.0f:64.0f;
+    const float cScale  = (mConfig.fullRange)? 1.0f:(1023.0f / 896.0f);
+
+    const float crToR = (mConfig.bt2020)? 1.4746f:1.5748f;
+    const float cbToG = (mConfig.bt2020)? 0.16455f:0.1873f;
+    const float crToG = (mConfig.bt2020)? 0.57135f:0.4681f;
+    const float cbToB = (mConfig.bt2020)? 1.8814f:1.8556f;
+
+    auto toCode = [](float v)->int {
+        return std::clamp((int)(v + 0.5f), 0, (kInLutSize - 1));
+    };
+
+    auto stripe = [&](int start, int end) {
+        float r[kBlockSize];
+        float g[kBlockSize];
+        float b[kBlockSize];
+
+        for (int y = start; y < end; y++) {
+            const uint16_t *pY  = (const uint16_t *)(srcY + ((size_t)y * yStride));
+            const uint8_t  *pCb = srcCb + ((size_t)(y / 2) * cStride);
+            const uint8_t  *pCr = srcCr + ((size_t)(y / 2) * cStride);
+            uint32_t       *pDst = dst + ((size_t)y * dstStride);
+
+            for (uint32_t x = 0; x < width; x += kBlockSize) {
+                int n = (int)std::min<uint32_t>(kBlockSize, (width - x));
+
+                for (int i = 0; i < n; i++) {
+                    uint32_t cx = ((x + i) / 2) * chromaStep;
+
+                    float Y  = ((float)(pY[x + i] >> 6) - yOffset) * yScale;
+                    float Cb = ((float)(*(const uint16_t *)(pCb + cx) >> 6) - 512.0f) * cScale;
+                    float Cr = ((float)(*(const uint16_t *)(pCr + cx) >> 6) - 512.0f) * cScale;
+
+                    r[i] = lut[toCode(Y + (crToR * Cr))];
+                    g[i] = lut[toCode(Y - (cbToG * Cb) - (crToG * Cr))];
+                    b[i] = lut[toCode(Y + (cbToB * Cb))];
+                }
+
+                mapBlock(r, g, b, n, pDst + x);
+            }
+        }
+    };
+
+    mRunner.run(height, stripe);
+}
@@ -0,0 +1,108 @@
+/*
+ *
+ * Copyright 2020 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EXYNOS_TONE_MAPPER_H
+#define EXYNOS_TONE_MAPPER_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "ExynosStripeRunner.h"
+
+/*
+ * tone mapping on CPU, it is used when GPU is not available or overloaded.
+ * HDR(PQ/HLG, BT.2020) is mapped to SDR(sRGB, BT.709) through
+ *   decoding LUT -> gamut mapping(linear) -> EETF of BT.2390 + sRGB encoding LUT.
+ * it does not depend on android, so that it could be built and compared with
+ * the reference(mapReference) on the host.
+ */
+class ExynosToneMapper {
+public:
+    enum class Transfer {
+        PQ,
+        HLG,
+    };
+
+    class Config {
+    public:
+        Transfer transfer        = Transfer::PQ;
+        bool     bt2020          = true;   /* gamut mapping to BT.709 */
+        bool     fullRange       = false;  /* only for YUV */
+        float    sourceLuminance = 1000;   /* nits, peak of mastering display */
+        float    targetLuminance = 500;    /* nits, peak of output */
+
+        bool operator==(const Config &other) const {
+            return ((transfer == other.transfer) &&
+                    (bt2020 == other.bt2020) &&
+                    (fullRange == other.fullRange) &&
+                    (sourceLuminance == other.sourceLuminance) &&
+                    (targetLuminance == other.targetLuminance));
+        }
+
+        bool operator!=(const Config &other) const {
+            return !(*this == other);
+        }
+    };
+
+    ExynosToneMapper(std::string name);
+    ~ExynosToneMapper() = default;
+
+    void setThreadInfo(uint32_t threads, uint32_t stripeHeight);
+
+    /* LUTs are rebuilt only if config is changed */
+    void configure(const Config &config);
+
+    /* src : RGBA_1010102, dst : RGBA_8888. strides are in pixels */
+    void processRGBA1010102(const uint32_t *src, uint32_t srcStride,
+                            uint32_t *dst, uint32_t dstStride,
+                            uint32_t width, uint32_t height) const;
+
+    /*
+     * src : 4:2:0 10bit in MSB of 16bit(P010), dst : RGBA_8888.
+     * strides of src and chroma step are in bytes, a stride of dst is in pixels.
+     */
+    void processYUV420P10(const uint8_t *srcY, uint32_t yStride,
+                          const uint8_t *srcCb, const uint8_t *srcCr, uint32_t cStride, uint32_t chromaStep,
+                          uint32_t *dst, uint32_t dstStride,
+                          uint32_t width, uint32_t height) const;
+
+    /* maps a non-linear R'G'B'(0.0 ~ 1.0) without LUTs in double precision, to compare with */
+    static uint32_t mapReference(const Config &config, double r, double g, double b);
+
+private:
+    static constexpr int kInLutSize  = 1024;  /* 10bit code */
+    static constexpr int kOutLutSize = 4096;  /* sqrt of linear */
+    static constexpr int kBlockSize  = 64;
+
+    static double decode(const Config &config, double code);  /* non-linear -> nits */
+    static double eetf(const Config &config, double nits);    /* nits of source -> nits of target */
+    static double encodeSRGB(double linear);
+
+    /* r, g, b are linear values relative to the source luminance */
+    void mapBlock(float *r, float *g, float *b, int n, uint32_t *dst) const;
+
+    ExynosStripeRunner mRunner;
+
+    Config mConfig;
+    bool   mConfigured;
+
+    std::vector<float>   mInLut;   /* code -> linear(relative to source luminance) */
+    std::vector<uint8_t> mOutLut;  /* sqrt(linear) -> sRGB 8bit */
+    float mMatrix[3][3];
+};
+
+#endif // EXYNOS_TONE_MAPPER_H
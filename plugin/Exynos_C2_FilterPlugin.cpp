@@ -14,7 +14,9 @@
  * limitations under the License.
  */
 
+#include <atomic>
 #include <chrono>
+#include <map>
 #include <thread>
 
 #include <codec2/hidl/plugin/FilterPlugin.h>
@@ -30,6 +32,12 @@
 #include <ui/GraphicBuffer.h>
 #include <utils/RefBase.h>
 
+#include "exynos_format.h"
+
+#include "ExynosETC.h"
+#include "ExynosInFlightQueue.h"
+#include "ExynosToneMapper.h"
+
 #define LOG_ON
 #include "ExynosLog.h"
 #undef LOG_TAG
@@ -215,7 +223,8 @@ public:
 
                 addParameter(
                         DefineParam(mActualPipelineDelay, C2_PARAMKEY_PIPELINE_DELAY)
-                        .withConstValue(new C2ActualPipelineDelayTuning(0u))
+                        /* works in flight except the one being submitted */
+                        .withConstValue(new C2ActualPipelineDelayTuning(ExynosUtils::GetToneMappingInFlightCnt() - 1))
                         .build());
 
                 C2BlockPool::local_id_t outputPoolIds[1] = { C2BlockPool::BASIC_GRAPHIC };
@@ -495,7 +504,10 @@ public:
             std::unique_lock lock(mQueueMutex);
             mQueue.swap(*flushedWork);
         }
-        // NOTE: this component does not have internal state to flush.
+        /* works taken from the queue are delivered by the completion thread before returning,
+         * so that nothing is delivered after flush.
+         */
+        mInFlightWorks.waitIdle();
         return C2_OK;
     }
 
@@ -630,31 +642,55 @@ public:
     }
 
 private:
+    static constexpr float kDefaultMaxLumiance = 500.0;
+    static constexpr float kDefaultMaxMasteringLuminance = 1000.0;
+    static constexpr float kDefaultMaxContentLuminance = 1000.0;
+
     void processLoop(std::shared_ptr<ExynosToneMappingFilter> thiz) {
-        constexpr float kDefaultMaxLumiance = 500.0;
-        constexpr float kDefaultMaxMasteringLuminance = 1000.0;
-        constexpr float kDefaultMaxContentLuminance = 1000.0;
         constexpr uint32_t kDstUsage =
                 GRALLOC_USAGE_SW_READ_OFTEN | GRALLOC_USAGE_SW_WRITE_OFTEN |
                 GRALLOC_USAGE_HW_RENDER | GRALLOC_USAGE_HW_TEXTURE;
 
         int32_t workCount = 0;
-        std::unique_ptr<renderengine::RenderEngine> renderEngine = renderengine::RenderEngine::create(
-                renderengine::RenderEngineCreationArgs::Builder()
-                    .setPixelFormat(static_cast<int>(ui::PixelFormat::RGBA_8888))
-                    .setImageCacheSize(2 /*maxFrameBufferAcquiredBuffers*/)
-                    .setUseColorManagerment(true)
-                    .setEnableProtectedContext(false)
-                    .setPrecacheToneMapperShaderOnly(true)
-                    .setContextPriority(renderengine::RenderEngine::ContextPriority::LOW)
-                    .build());
-        if (!renderEngine) {
+        uint32_t mode = ExynosUtils::GetToneMappingMode();
+
+        std::unique_ptr<renderengine::RenderEngine> renderEngine;
+        if (mode != TONE_MAPPING_MODE_CPU) {
+            renderEngine = renderengine::RenderEngine::create(
+                    renderengine::RenderEngineCreationArgs::Builder()
+                        .setPixelFormat(static_cast<int>(ui::PixelFormat::RGBA_8888))
+                        .setImageCacheSize(2 /*maxFrameBufferAcquiredBuffers*/)
+                        .setUseColorManagerment(true)
+                        .setEnableProtectedContext(false)
+                        .setPrecacheToneMapperShaderOnly(true)
+                        .setContextPriority(renderengine::RenderEngine::ContextPriority::LOW)
+                        .build());
+        }
+        if ((!renderEngine) &&
+            (mode == TONE_MAPPING_MODE_GPU)) {
             std::unique_lock lock(mListenerMutex);
             mListener->onError_nb(thiz, C2_CORRUPTED);
             return;
         }
         uint32_t textureName = 0;
-        renderEngine->genTextures(1, &textureName);
+        if (renderEngine) {
+            renderEngine->genTextures(1, &textureName);
+        }
+
+        /* CPU is used when GPU is unavailable, or overloaded on auto mode */
+        std::unique_ptr<ExynosToneMapper> toneMapper;
+        bool useCpu = (renderEngine == nullptr);
+
+        /* submission(this thread) and completion of works are pipelined */
+        uint32_t maxInFlight = ExynosUtils::GetToneMappingInFlightCnt();
+        mInFlightWorks.start(maxInFlight);
+        mGpuOverloaded = false;
+
+        std::thread completionThread([this, thiz, mode]() {
+            completionLoop(thiz, mode);
+        });
+
+        ExynosLogI("[%s] mode(%d) : %s is used, %d works in flight", __FUNCTION__, mode, (useCpu)? "CPU":"GPU", maxInFlight);
 
         while (true) {
             // Before doing anything, verify the state
@@ -664,6 +700,13 @@ private:
                     break;
                 }
             }
+            // Wait for a room in the pipeline
+            mInFlightWorks.waitRoom();
+            if ((!useCpu) &&
+                (mGpuOverloaded)) {
+                ExynosLogW("[%s] GPU is overloaded, CPU is used from work #%d", __FUNCTION__, (workCount + 1));
+                useCpu = true;
+            }
             // Extract one work item
             std::unique_ptr<C2Work> work;
             {
@@ -676,6 +719,7 @@ private:
                 }
                 mQueue.front().swap(work);
                 mQueue.pop_front();
+                mInFlightWorks.take();  /* with mQueueMutex, so that flush could wait for it */
                 ++workCount;
             }
 
@@ -699,6 +743,9 @@ private:
                 buffer = work->input.buffers.front();
             }
             std::shared_ptr<C2Buffer> outC2Buffer;
+            sp<GraphicBuffer> srcBuffer;
+            sp<GraphicBuffer> dstBuffer;
+            sp<Fence> fence;
             status_t err = OK;
             if (buffer) {
                 if (buffer->hasInfo(C2StreamHdrStaticInfo::output::PARAM_TYPE)) {
@@ -725,7 +772,7 @@ private:
                         c2Handle, &width, &height, &format, &usage, &stride, &generation,
                         &igbp_id, &igbp_slot);
                 native_handle_t *grallocHandle = UnwrapNativeCodec2GrallocHandle(c2Handle);
-                sp<GraphicBuffer> srcBuffer = new GraphicBuffer(
+                srcBuffer = new GraphicBuffer(
                         grallocHandle, GraphicBuffer::CLONE_HANDLE,
                         width, height, format, 1, usage, stride);
 
@@ -743,86 +790,110 @@ private:
                         c2Handle, &width, &height, &format, &usage, &stride, &generation,
                         &igbp_id, &igbp_slot);
                 grallocHandle = UnwrapNativeCodec2GrallocHandle(c2Handle);
-                sp<GraphicBuffer> dstBuffer = new GraphicBuffer(
+                dstBuffer = new GraphicBuffer(
                         grallocHandle, GraphicBuffer::CLONE_HANDLE,
                         width, height, format, 1, usage, stride);
 
-                Rect sourceCrop(0, 0, width, height);
-
-                renderengine::DisplaySettings clientCompositionDisplay;
-                std::vector<const renderengine::LayerSettings*> clientCompositionLayers;
-
-                clientCompositionDisplay.physicalDisplay = sourceCrop;
-                clientCompositionDisplay.clip = sourceCrop;
-
-                clientCompositionDisplay.outputDataspace = ui::Dataspace::V0_SRGB;
-                clientCompositionDisplay.maxLuminance = kDefaultMaxLumiance;
-                clientCompositionDisplay.clearRegion = Region::INVALID_REGION;
-                renderengine::LayerSettings layerSettings;
-                layerSettings.geometry.boundaries = sourceCrop.toFloatRect();
-                layerSettings.alpha = 1.0f;
-
-                layerSettings.sourceDataspace = static_cast<ui::Dataspace>(dataspace);
-
-                // from BufferLayer
-                layerSettings.source.buffer.buffer = srcBuffer;
-                layerSettings.source.buffer.isOpaque = true;
-                // TODO: fence
-                layerSettings.source.buffer.fence = Fence::NO_FENCE;
-                layerSettings.source.buffer.textureName = textureName;
-                layerSettings.source.buffer.usePremultipliedAlpha = false;
-                layerSettings.source.buffer.isY410BT2020 =
-                    (layerSettings.sourceDataspace == ui::Dataspace::BT2020_ITU_PQ ||
-                     layerSettings.sourceDataspace == ui::Dataspace::BT2020_ITU_HLG) &&
-                    format == HAL_PIXEL_FORMAT_RGBA_1010102;
-                layerSettings.source.buffer.maxMasteringLuminance =
+                float maxMasteringLuminance =
                     (hdrStaticInfo && *hdrStaticInfo &&
                      hdrStaticInfo->mastering.maxLuminance > 0 &&
                      hdrStaticInfo->mastering.minLuminance > 0)
                         ? hdrStaticInfo->mastering.maxLuminance : kDefaultMaxMasteringLuminance;
-                layerSettings.source.buffer.maxContentLuminance =
+                float maxContentLuminance =
                     (hdrStaticInfo && *hdrStaticInfo && hdrStaticInfo->maxCll > 0)
                         ? hdrStaticInfo->maxCll : kDefaultMaxContentLuminance;
 
-                // Set filtering to false since the capture itself doesn't involve
-                // any scaling, metadata retriever JNI is scaling the bitmap if
-                // display size is different from decoded size. If that scaling
-                // needs to be handled by server side, consider enable this based
-                // display size vs decoded size.
-                layerSettings.source.buffer.useTextureFiltering = false;
-                layerSettings.source.buffer.textureTransform = mat4();
-                clientCompositionLayers.push_back(&layerSettings);
-
-                // Use an empty fence for the buffer fence, since we just created the buffer so
-                // there is no need for synchronization with the GPU.
-                base::unique_fd bufferFence;
-                base::unique_fd drawFence;
-                renderEngine->useProtectedContext(false);
-                err = renderEngine->drawLayers(
-                        clientCompositionDisplay, clientCompositionLayers, dstBuffer.get(),
-                        /*useFramebufferCache=*/false, std::move(bufferFence), &drawFence);
-
-                sp<Fence> fence = new Fence(std::move(drawFence));
-
-                // We can move waiting for fence & sending it back on a separate thread to improve
-                // efficiency, but leaving it here for simplicity.
-                if (err != OK) {
-                    ExynosLogE("[%s] drawLayers returned err:0x%x", __FUNCTION__, err);
-                } else {
-                    err = fence->wait(500);
+                bool processed = false;
+                if (useCpu) {
+                    if (!toneMapper) {
+                        toneMapper = std::make_unique<ExynosToneMapper>(mObjName);
+                        toneMapper->setThreadInfo(ExynosUtils::GetToneMappingThreadCnt(), TONE_MAPPING_DEFAULT_STRIPE_HEIGHT);
+                    }
+
+                    err = processOnCpu(*toneMapper, srcBuffer, dstBuffer, dataspace, maxMasteringLuminance);
                     if (err != OK) {
-                        ExynosLogW("[%s] wait for fence returned err:0x%x", __FUNCTION__, err);
+                        ExynosLogW("[%s] processOnCpu returned err:0x%x", __FUNCTION__, err);
                     }
+
+                    /* GPU handles what CPU can not, if it is available */
+                    processed = ((err == OK) || (!renderEngine));
+                }
+
+                if (!processed) {
+                    err = processOnGpu(*renderEngine, textureName, srcBuffer, dstBuffer,
+                                       width, height, format, dataspace,
+                                       maxMasteringLuminance, maxContentLuminance, &fence);
                 }
-                renderEngine->cleanupPostRender(renderengine::RenderEngine::CleanupMode::CLEAN_ALL);
             }
 
+            auto inFlight = std::make_unique<InFlightWork>();
+            inFlight->index       = workCount;
+            inFlight->work        = std::move(work);
+            inFlight->outC2Buffer = outC2Buffer;
+            inFlight->srcBuffer   = srcBuffer;
+            inFlight->dstBuffer   = dstBuffer;
+            inFlight->fence       = fence;
+            inFlight->err         = err;
+            inFlight->submitTime  = std::chrono::steady_clock::now();
+            mInFlightWorks.submit(std::move(inFlight));
+        }
+
+        /* works in flight are delivered before stopping */
+        mInFlightWorks.close();
+
+        if (completionThread.joinable()) {
+            completionThread.join();
+        }
+    }
+
+    /* waits for works in order of submission and delivers them */
+    void completionLoop(std::shared_ptr<ExynosToneMappingFilter> thiz, uint32_t mode) {
+        uint32_t overloadCnt = 0;
+        std::chrono::steady_clock::time_point lastDoneTime;
+
+        while (true) {
+            /* in order of submission, so that output keeps the order of input */
+            std::unique_ptr<InFlightWork> inFlight;
+            if (!mInFlightWorks.pop(inFlight)) {
+                break;
+            }
+
+            status_t err = inFlight->err;
+            if ((err == OK) &&
+                (inFlight->fence != nullptr)) {
+                err = inFlight->fence->wait(500);
+                if (err != OK) {
+                    ExynosLogW("[%s] wait for fence returned err:0x%x", __FUNCTION__, err);
+                }
+
+                auto doneTime = std::chrono::steady_clock::now();
+
+                if (mode == TONE_MAPPING_MODE_AUTO) {
+                    /* time spent on GPU for this work, except waiting for previous works */
+                    auto gpuTime = doneTime - std::max(inFlight->submitTime, lastDoneTime);
+
+                    if ((err != OK) ||
+                        (gpuTime >= std::chrono::milliseconds(TONE_MAPPING_GPU_OVERLOAD_TIME))) {
+                        overloadCnt++;
+                    } else {
+                        overloadCnt = 0;
+                    }
+
+                    if (overloadCnt >= TONE_MAPPING_GPU_OVERLOAD_CNT) {
+                        mGpuOverloaded = true;
+                    }
+                }
+
+                lastDoneTime = doneTime;
+            }
+
+            std::unique_ptr<C2Work> work = std::move(inFlight->work);
             work->worklets.front()->output.ordinal = work->input.ordinal;
             work->worklets.front()->output.flags = work->input.flags;
             if (err == OK) {
                 work->workletsProcessed = 1;
-                if (outC2Buffer) {
-                    work->worklets.front()->output.buffers.push_back(outC2Buffer);
+                if (inFlight->outC2Buffer) {
+                    work->worklets.front()->output.buffers.push_back(inFlight->outC2Buffer);
                 }
                 work->result = C2_OK;
             } else {
@@ -831,10 +902,147 @@ private:
             std::list<std::unique_ptr<C2Work>> items;
             items.push_back(std::move(work));
 
-            std::unique_lock lock(mListenerMutex);
-            mListener->onWorkDone_nb(thiz, std::move(items));
-            ExynosLogD("[%s] sent work #%d", __FUNCTION__, workCount);
+            {
+                std::unique_lock lock(mListenerMutex);
+                mListener->onWorkDone_nb(thiz, std::move(items));
+            }
+            ExynosLogD("[%s] sent work #%llu", __FUNCTION__, (unsigned long long)inFlight->index);
+
+            inFlight.reset();
+            mInFlightWorks.done();
+        }
+    }
+
+    status_t processOnGpu(renderengine::RenderEngine &renderEngine, uint32_t textureName,
+                          const sp<GraphicBuffer> &srcBuffer, const sp<GraphicBuffer> &dstBuffer,
+                          uint32_t width, uint32_t height, uint32_t format, uint32_t dataspace,
+                          float maxMasteringLuminance, float maxContentLuminance,
+                          sp<Fence> *fence) {
+        Rect sourceCrop(0, 0, width, height);
+
+        renderengine::DisplaySettings clientCompositionDisplay;
+        std::vector<const renderengine::LayerSettings*> clientCompositionLayers;
+
+        clientCompositionDisplay.physicalDisplay = sourceCrop;
+        clientCompositionDisplay.clip = sourceCrop;
+
+        clientCompositionDisplay.outputDataspace = ui::Dataspace::V0_SRGB;
+        clientCompositionDisplay.maxLuminance = kDefaultMaxLumiance;
+        clientCompositionDisplay.clearRegion = Region::INVALID_REGION;
+        renderengine::LayerSettings layerSettings;
+        layerSettings.geometry.boundaries = sourceCrop.toFloatRect();
+        layerSettings.alpha = 1.0f;
+
+        layerSettings.sourceDataspace = static_cast<ui::Dataspace>(dataspace);
+
+        // from BufferLayer
+        layerSettings.source.buffer.buffer = srcBuffer;
+        layerSettings.source.buffer.isOpaque = true;
+        // TODO: fence
+        layerSettings.source.buffer.fence = Fence::NO_FENCE;
+        layerSettings.source.buffer.textureName = textureName;
+        layerSettings.source.buffer.usePremultipliedAlpha = false;
+        layerSettings.source.buffer.isY410BT2020 =
+            (layerSettings.sourceDataspace == ui::Dataspace::BT2020_ITU_PQ ||
+             layerSettings.sourceDataspace == ui::Dataspace::BT2020_ITU_HLG) &&
+            format == HAL_PIXEL_FORMAT_RGBA_1010102;
+        layerSettings.source.buffer.maxMasteringLuminance = maxMasteringLuminance;
+        layerSettings.source.buffer.maxContentLuminance = maxContentLuminance;
+
+        // Set filtering to false since the capture itself doesn't involve
+        // any scaling, metadata retriever JNI is scaling the bitmap if
+        // display size is different from decoded size. If that scaling
+        // needs to be handled by server side, consider enable this based
+        // display size vs decoded size.
+        layerSettings.source.buffer.useTextureFiltering = false;
+        layerSettings.source.buffer.textureTransform = mat4();
+        clientCompositionLayers.push_back(&layerSettings);
+
+        // Use an empty fence for the buffer fence, since we just created the buffer so
+        // there is no need for synchronization with the GPU.
+        base::unique_fd bufferFence;
+        base::unique_fd drawFence;
+        renderEngine.useProtectedContext(false);
+        status_t err = renderEngine.drawLayers(
+                clientCompositionDisplay, clientCompositionLayers, dstBuffer.get(),
+                /*useFramebufferCache=*/false, std::move(bufferFence), &drawFence);
+
+        // The fence is waited on the completion thread, so that next works could be submitted
+        // while GPU is drawing.
+        if (err != OK) {
+            ExynosLogE("[%s] drawLayers returned err:0x%x", __FUNCTION__, err);
+        } else {
+            *fence = new Fence(std::move(drawFence));
         }
+        renderEngine.cleanupPostRender(renderengine::RenderEngine::CleanupMode::CLEAN_ALL);
+
+        return err;
+    }
+
+    /* returns INVALID_OPERATION if the buffer could not be handled on CPU */
+    status_t processOnCpu(ExynosToneMapper &toneMapper,
+                          const sp<GraphicBuffer> &srcBuffer, const sp<GraphicBuffer> &dstBuffer,
+                          uint32_t dataspace, float maxMasteringLuminance) {
+        uint32_t transfer = (dataspace & HAL_DATASPACE_TRANSFER_MASK);
+        if ((transfer != HAL_DATASPACE_TRANSFER_ST2084) &&
+            (transfer != HAL_DATASPACE_TRANSFER_HLG)) {
+            return INVALID_OPERATION;
+        }
+
+        ExynosToneMapper::Config config;
+        config.transfer        = (transfer == HAL_DATASPACE_TRANSFER_HLG)? ExynosToneMapper::Transfer::HLG:ExynosToneMapper::Transfer::PQ;
+        config.bt2020          = ExynosUtils::CheckBT2020(dataspace);
+        config.fullRange       = ((dataspace & HAL_DATASPACE_RANGE_MASK) == HAL_DATASPACE_RANGE_FULL);
+        config.sourceLuminance = (transfer == HAL_DATASPACE_TRANSFER_HLG)? kDefaultMaxMasteringLuminance:maxMasteringLuminance;
+        config.targetLuminance = kDefaultMaxLumiance;
+        toneMapper.configure(config);
+
+        void *dstAddr = nullptr;
+        if (dstBuffer->lock(GRALLOC_USAGE_SW_WRITE_OFTEN, &dstAddr) != OK) {
+            return INVALID_OPERATION;
+        }
+
+        status_t err = OK;
+        int format = srcBuffer->getPixelFormat();
+
+        switch (format) {
+        case HAL_PIXEL_FORMAT_RGBA_1010102:
+        {
+            void *srcAddr = nullptr;
+
+            err = srcBuffer->lock(GRALLOC_USAGE_SW_READ_OFTEN, &srcAddr);
+            if (err == OK) {
+                toneMapper.processRGBA1010102((const uint32_t *)srcAddr, srcBuffer->getStride(),
+                                              (uint32_t *)dstAddr, dstBuffer->getStride(),
+                                              dstBuffer->getWidth(), dstBuffer->getHeight());
+                srcBuffer->unlock();
+            }
+        }
+            break;
+        case HAL_PIXEL_FORMAT_YCBCR_P010:
+        case HAL_PIXEL_FORMAT_EXYNOS_YCbCr_P010_M:
+        {
+            android_ycbcr ycbcr;
+
+            err = srcBuffer->lockYCbCr(GRALLOC_USAGE_SW_READ_OFTEN, &ycbcr);
+            if (err == OK) {
+                toneMapper.processYUV420P10((const uint8_t *)ycbcr.y, ycbcr.ystride,
+                                            (const uint8_t *)ycbcr.cb, (const uint8_t *)ycbcr.cr,
+                                            ycbcr.cstride, ycbcr.chroma_step,
+                                            (uint32_t *)dstAddr, dstBuffer->getStride(),
+                                            dstBuffer->getWidth(), dstBuffer->getHeight());
+                srcBuffer->unlock();
+            }
+        }
+            break;
+        default:
+            err = INVALID_OPERATION;
+            break;
+        }
+
+        dstBuffer->unlock();
+
+        return (err == OK)? OK:INVALID_OPERATION;
     }
 
     mutable std::timed_mutex mListenerMutex;
@@ -859,6 +1067,21 @@ private:
 
     mutable std::mutex mProcessingMutex;
     std::thread mProcessingThread;
+
+    class InFlightWork {
+    public:
+        uint64_t index;
+        std::unique_ptr<C2Work> work;
+        std::shared_ptr<C2Buffer> outC2Buffer;
+        sp<GraphicBuffer> srcBuffer;  /* kept until the fence is signaled */
+        sp<GraphicBuffer> dstBuffer;
+        sp<Fence> fence;              /* nullptr : already done */
+        status_t err;
+        std::chrono::steady_clock::time_point submitTime;
+    };
+
+    ExynosInFlightQueue<std::unique_ptr<InFlightWork>> mInFlightWorks;
+    std::atomic<bool> mGpuOverloaded{false};
 };
 
 // static
@@ -0,0 +1,208 @@
+/*
+ *
+ * Copyright 2020 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ExynosToneMapper.h"
+
+#define TEST_WIDTH        1030  /* every 10bit code on a row, with a tail of the block */
+#define TEST_HEIGHT       34
+#define TEST_MAX_DIFF     1     /* per channel in 8bit, LUTs against double precision */
+#define TEST_MEAN_DIFF    0.05
+
+using Transfer = ExynosToneMapper::Transfer;
+
+namespace {
+
+struct DiffStat {
+    int      maxDiff = 0;
+    uint64_t sumDiff = 0;
+    uint64_t cnt     = 0;
+
+    void add(uint32_t out, uint32_t ref) {
+        for (int i = 0; i < 32; i += 8) {
+            int diff = abs((int)((out >> i) & 0xFF) - (int)((ref >> i) & 0xFF));
+
+            maxDiff = std::max(maxDiff, diff);
+            sumDiff += diff;
+            cnt++;
+        }
+    }
+
+    double mean() const {
+        return (cnt > 0)? ((double)sumDiff / cnt):0;
+    }
+};
+
+/* transfer, gamut mapping, threads */
+using Param = std::tuple<Transfer, bool, uint32_t>;
+
+class ExynosToneMapperTest : public ::testing::TestWithParam<Param> {
+protected:
+    void SetUp() override {
+        mConfig.transfer = std::get<0>(GetParam());
+        mConfig.bt2020   = std::get<1>(GetParam());
+
+        mToneMapper.setThreadInfo(std::get<2>(GetParam()), 4);
+    }
+
+    void check(const DiffStat &stat) {
+        EXPECT_LE(stat.maxDiff, TEST_MAX_DIFF);
+        EXPECT_LT(stat.mean(), TEST_MEAN_DIFF);
+
+        RecordProperty("max_diff", stat.maxDiff);
+        RecordProperty("mean_diff", std::to_string(stat.mean()));
+    }
+
+    ExynosToneMapper::Config mConfig;
+    ExynosToneMapper         mToneMapper{"ExynosToneMapperTest"};
+};
+
+}  // namespace
+
+TEST_P(ExynosToneMapperTest, RGBA1010102MatchesReference) {
+    mToneMapper.configure(mConfig);
+
+    std::vector<uint32_t> src(TEST_WIDTH * TEST_HEIGHT);
+    std::vector<uint32_t> dst(TEST_WIDTH * TEST_HEIGHT, 0);
+
+    /* R sweeps every code, G and B are spread over them */
+    for (uint32_t y = 0; y < TEST_HEIGHT; y++) {
+        for (uint32_t x = 0; x < TEST_WIDTH; x++) {
+            uint32_t r = x % 1024;
+            uint32_t g = ((x * 7) + (y * 131)) % 1024;
+            uint32_t b = ((x * 13) + (y * 257)) % 1024;
+
+            src[(y * TEST_WIDTH) + x] = r | (g << 10) | (b << 20) | (3u << 30);
+        }
+    }
+
+    mToneMapper.processRGBA1010102(src.data(), TEST_WIDTH, dst.data(), TEST_WIDTH, TEST_WIDTH, TEST_HEIGHT);
+
+    DiffStat stat;
+    for (uint32_t i = 0; i < src.size(); i++) {
+        uint32_t pixel = src[i];
+        uint32_t ref   = ExynosToneMapper::mapReference(mConfig,
+                                                        (pixel & 0x3FF) / 1023.0,
+                                                        ((pixel >> 10) & 0x3FF) / 1023.0,
+                                                        ((pixel >> 20) & 0x3FF) / 1023.0);
+        stat.add(dst[i], ref);
+    }
+
+    check(stat);
+}
+
+TEST_P(ExynosToneMapperTest, YUV420P10MatchesReference) {
+    for (bool fullRange : { false, true }) {
+        mConfig.fullRange = fullRange;
+        mToneMapper.configure(mConfig);
+
+        /* P010 : 10bit in MSB, Cb and Cr are interleaved */
+        const uint32_t cWidth  = (TEST_WIDTH + 1) / 2;
+        const uint32_t cHeight = (TEST_HEIGHT + 1) / 2;
+
+        std::vector<uint16_t> srcY(TEST_WIDTH * TEST_HEIGHT);
+        std::vector<uint16_t> srcC(cWidth * 2 * cHeight);
+        std::vector<uint32_t> dst(TEST_WIDTH * TEST_HEIGHT, 0);
+
+        for (uint32_t y = 0; y < TEST_HEIGHT; y++) {
+            for (uint32_t x = 0; x < TEST_WIDTH; x++) {
+                srcY[(y * TEST_WIDTH) + x] = (uint16_t)(((x + (y * 37)) % 1024) << 6);
+            }
+        }
+
+        for (uint32_t y = 0; y < cHeight; y++) {
+            for (uint32_t x = 0; x < cWidth; x++) {
+                srcC[(y * cWidth * 2) + (x * 2)]     = (uint16_t)((((x * 5) + (y * 61)) % 1024) << 6);
+                srcC[(y * cWidth * 2) + (x * 2) + 1] = (uint16_t)((((x * 11) + (y * 29) + 512) % 1024) << 6);
+            }
+        }
+
+        const uint8_t *pC = (const uint8_t *)srcC.data();
+        mToneMapper.processYUV420P10((const uint8_t *)srcY.data(), TEST_WIDTH * 2,
+                                     pC, pC + 2, cWidth * 4, 4,
+                                     dst.data(), TEST_WIDTH, TEST_WIDTH, TEST_HEIGHT);
+
+        /* Y'CbCr -> R'G'B' in double, the same matrix as the tone mapper.
+         * the tone mapper looks up its LUT by 10bit R'G'B' code, so the reference is given the same code.
+         */
+        const double yScale  = (fullRange)? 1.0:(1023.0 / 876.0);
+        const double yOffset = (fullRange)? 0.0:64.0;
+        const double cScale  = (fullRange)? 1.0:(1023.0 / 896.0);
+
+        const double crToR = (mConfig.bt2020)? 1.4746:1.5748;
+        const double cbToG = (mConfig.bt2020)? 0.16455:0.1873;
+        const double crToG = (mConfig.bt2020)? 0.57135:0.4681;
+        const double cbToB = (mConfig.bt2020)? 1.8814:1.8556;
+
+        DiffStat stat;
+        for (uint32_t y = 0; y < TEST_HEIGHT; y++) {
+            for (uint32_t x = 0; x < TEST_WIDTH; x++) {
+                uint32_t cIndex = ((y / 2) * cWidth * 2) + ((x / 2) * 2);
+
+                double Y  = ((srcY[(y * TEST_WIDTH) + x] >> 6) - yOffset) * yScale;
+                double Cb = ((srcC[cIndex] >> 6) - 512.0) * cScale;
+                double Cr = ((srcC[cIndex + 1] >> 6) - 512.0) * cScale;
+
+                double r = std::round(std::clamp(Y + (crToR * Cr), 0.0, 1023.0)) / 1023.0;
+                double g = std::round(std::clamp(Y - (cbToG * Cb) - (crToG * Cr), 0.0, 1023.0)) / 1023.0;
+                double b = std::round(std::clamp(Y + (cbToB * Cb), 0.0, 1023.0)) / 1023.0;
+
+                stat.add(dst[(y * TEST_WIDTH) + x], ExynosToneMapper::mapReference(mConfig, r, g, b));
+            }
+        }
+
+        SCOPED_TRACE(fullRange? "full range":"limited range");
+        check(stat);
+    }
+}
+
+TEST_P(ExynosToneMapperTest, ReconfigureChangesOutput) {
+    std::vector<uint32_t> src(TEST_WIDTH);
+    std::vector<uint32_t> dst0(TEST_WIDTH), dst1(TEST_WIDTH);
+
+    for (uint32_t x = 0; x < TEST_WIDTH; x++) {
+        src[x] = (x % 1024) * 0x100401;  /* gray */
+    }
+
+    mToneMapper.configure(mConfig);
+    mToneMapper.processRGBA1010102(src.data(), TEST_WIDTH, dst0.data(), TEST_WIDTH, TEST_WIDTH, 1);
+
+    ExynosToneMapper::Config dimmer = mConfig;
+    dimmer.targetLuminance = 100;
+
+    mToneMapper.configure(dimmer);
+    mToneMapper.processRGBA1010102(src.data(), TEST_WIDTH, dst1.data(), TEST_WIDTH, TEST_WIDTH, 1);
+
+    EXPECT_NE(dst0, dst1);
+}
+
+INSTANTIATE_TEST_SUITE_P(All, ExynosToneMapperTest,
+                         ::testing::Combine(::testing::Values(Transfer::PQ, Transfer::HLG),
+                                            ::testing::Bool(),
+                                            ::testing::Values(1u, 3u)),
+                         [](const ::testing::TestParamInfo<Param> &info) {
+                             return std::string((std::get<0>(info.param) == Transfer::PQ)? "PQ":"HLG") +
+                                    (std::get<1>(info.param)? "_GamutMapping":"_NoGamutMapping") +
+                                    "_" + std::to_string(std::get<2>(info.param)) + "Threads";
+                         });
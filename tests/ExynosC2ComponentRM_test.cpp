@@ -0,0 +1,207 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Exynos_C2_ComponentRM.h"
+
+using RM = ExynosC2ComponentRM;
+
+namespace {
+
+RM::Load MakeLoad(uint32_t width, uint32_t height, uint32_t frameRate, uint32_t bitrate = 0) {
+    RM::Load load;
+
+    load.width     = width;
+    load.height    = height;
+    load.frameRate = frameRate;
+    load.bitrate   = bitrate;
+
+    return load;
+}
+
+uint64_t MbPerSec(uint32_t width, uint32_t height, uint32_t frameRate) {
+    return MakeLoad(width, height, frameRate).getMbPerSec();
+}
+
+/* every test releases what it got, the instance is shared by all */
+class ExynosC2ComponentRMTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        mRM = RM::getInstance();
+        mRM->setPolicy(nullptr);
+    }
+
+    std::shared_ptr<RM> mRM;
+};
+
+}  // namespace
+
+TEST_F(ExynosC2ComponentRMTest, SentinelOperatingRateIsIgnored) {
+    RM::Load load = MakeLoad(1280, 720, 0);
+
+    load.setFrameRate(0, 32767);
+    EXPECT_EQ(0u, load.frameRate);
+
+    load.setFrameRate(30, 32767);
+    EXPECT_EQ(30u, load.frameRate);
+
+    load.setFrameRate(30, 60);
+    EXPECT_EQ(60u, load.frameRate);
+
+    load.setFrameRate(0, -1);
+    EXPECT_EQ(0u, load.frameRate);
+
+    load.setFrameRate(MAX_RM_FRAME_RATE, 0);
+    EXPECT_EQ((uint32_t)MAX_RM_FRAME_RATE, load.frameRate);
+
+    /* an unknown rate is counted as the default */
+    load.setFrameRate(0, 32767);
+    EXPECT_EQ(MbPerSec(1280, 720, DEFAULT_RM_FRAME_RATE), load.getMbPerSec());
+
+    /* the raw sentinel(32767 fps) would be far over the budget */
+    ASSERT_GT(MbPerSec(1280, 720, 32767), (uint64_t)MAX_MFC_MB_PER_SEC);
+
+    auto resource = mRM->getResource(RM::DECODER, load, RM::REALTIME);
+    EXPECT_NE(nullptr, resource);
+}
+
+TEST_F(ExynosC2ComponentRMTest, MixedResolutionOverBudgetIsRejected) {
+    /* 4K@60 takes a half of the budget */
+    RM::Load uhd = MakeLoad(3840, 2160, 60);
+    RM::Load fhd = MakeLoad(1920, 1080, 60);
+    RM::Load hd  = MakeLoad(1280, 720, 30);
+
+    ASSERT_EQ((uint64_t)MAX_MFC_MB_PER_SEC, uhd.getMbPerSec() * 2);
+
+    std::vector<RM::ComponentResource> resources;
+
+    resources.push_back(mRM->getResource(RM::DECODER, uhd));
+    resources.push_back(mRM->getResource(RM::ENCODER, uhd));  /* exactly the budget */
+    for (auto &resource : resources) {
+        ASSERT_NE(nullptr, resource);
+    }
+
+    EXPECT_EQ(nullptr, mRM->getResource(RM::DECODER, hd));
+    EXPECT_EQ(nullptr, mRM->getResource(RM::ENCODER, fhd));
+
+    /* best effort is not counted */
+    auto bestEffort = mRM->getResource(RM::DECODER, fhd, RM::NON_REALTIME);
+    EXPECT_NE(nullptr, bestEffort);
+
+    /* a release returns the load */
+    resources.pop_back();
+
+    auto first  = mRM->getResource(RM::DECODER, fhd);
+    auto second = mRM->getResource(RM::ENCODER, hd);
+    EXPECT_NE(nullptr, first);
+    EXPECT_NE(nullptr, second);
+
+    /* 4K@60 - (1080p@60 + 720p@30) is left, 4K@30 fits but 4K@60 does not */
+    EXPECT_EQ(nullptr, mRM->getResource(RM::DECODER, uhd));
+    EXPECT_NE(nullptr, mRM->getResource(RM::DECODER, MakeLoad(3840, 2160, 30)));
+}
+
+TEST_F(ExynosC2ComponentRMTest, BitrateOverBudgetIsRejected) {
+    auto first = mRM->getResource(RM::ENCODER, MakeLoad(1280, 720, 30, MAX_MFC_BITRATE));
+    ASSERT_NE(nullptr, first);
+
+    EXPECT_EQ(nullptr, mRM->getResource(RM::ENCODER, MakeLoad(1280, 720, 30, 1)));
+
+    /* unknown bitrate is not checked */
+    EXPECT_NE(nullptr, mRM->getResource(RM::ENCODER, MakeLoad(1280, 720, 30)));
+}
+
+TEST_F(ExynosC2ComponentRMTest, UpdateKeepsReservationOverBudget) {
+    RM::Load uhd  = MakeLoad(3840, 2160, 60);
+    RM::Load over = MakeLoad(3840, 2160, 90);  /* fits alone, not with 4K@60 */
+    RM::Load hd   = MakeLoad(1280, 720, 30);
+
+    auto big   = mRM->getResource(RM::DECODER, uhd);
+    auto small = mRM->getResource(RM::DECODER, hd);
+    ASSERT_NE(nullptr, big);
+    ASSERT_NE(nullptr, small);
+
+    /* grows within the budget */
+    EXPECT_TRUE(mRM->updateResource(small, MakeLoad(1920, 1080, 60), RM::REALTIME));
+    EXPECT_EQ(1920u, small->load.width);
+
+    /* over the budget, the previous one is kept */
+    EXPECT_FALSE(mRM->updateResource(small, over, RM::REALTIME));
+    EXPECT_EQ(1920u, small->load.width);
+    EXPECT_EQ(60u, small->load.frameRate);
+
+    /* the kept reservation is still counted, 4K@60 + 1080p@60 leaves no room for 4K@60 */
+    EXPECT_EQ(nullptr, mRM->getResource(RM::ENCODER, uhd));
+
+    /* shrink returns the load */
+    EXPECT_TRUE(mRM->updateResource(small, hd, RM::REALTIME));
+    EXPECT_EQ(nullptr, mRM->getResource(RM::ENCODER, uhd));  /* still 720p@30 is reserved */
+
+    /* NON_REALTIME leaves the budget */
+    EXPECT_TRUE(mRM->updateResource(small, hd, RM::NON_REALTIME));
+    EXPECT_NE(nullptr, mRM->getResource(RM::ENCODER, uhd));
+
+    /* after a release, the update is admitted */
+    big.reset();
+    EXPECT_TRUE(mRM->updateResource(small, over, RM::REALTIME));
+    EXPECT_EQ(90u, small->load.frameRate);
+}
+
+TEST_F(ExynosC2ComponentRMTest, ReleaseOfSharedReservationIsOnce) {
+    RM::Load uhd = MakeLoad(3840, 2160, 60);
+
+    auto first  = mRM->getResource(RM::DECODER, uhd);
+    auto second = mRM->getResource(RM::DECODER, uhd);
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+
+    /* the load is returned at the last release only */
+    auto copy = first;
+    first.reset();
+    EXPECT_EQ(nullptr, mRM->getResource(RM::DECODER, uhd));
+
+    copy.reset();
+    EXPECT_NE(nullptr, mRM->getResource(RM::DECODER, uhd));
+}
+
+TEST_F(ExynosC2ComponentRMTest, InstanceCountIsLimited) {
+    std::vector<RM::ComponentResource> resources;
+
+    for (int i = 0; i < MAX_SECURE_RESOURCE; i++) {
+        resources.push_back(mRM->getResource(RM::SECURE, MakeLoad(176, 144, 15)));
+        ASSERT_NE(nullptr, resources.back());
+    }
+
+    EXPECT_EQ(nullptr, mRM->getResource(RM::SECURE, MakeLoad(176, 144, 15)));
+
+    resources.pop_back();
+    EXPECT_NE(nullptr, mRM->getResource(RM::SECURE, MakeLoad(176, 144, 15)));
+}
+
+TEST_F(ExynosC2ComponentRMTest, PolicyCanBeReplaced) {
+    mRM->setPolicy([](const RM::Reservation &request, uint64_t, uint64_t, uint64_t, uint64_t) {
+                       return (request.type != RM::ENCODER);
+                   });
+
+    EXPECT_NE(nullptr, mRM->getResource(RM::DECODER, MakeLoad(1280, 720, 30)));
+    EXPECT_EQ(nullptr, mRM->getResource(RM::ENCODER, MakeLoad(1280, 720, 30)));
+
+    mRM->setPolicy(nullptr);
+    EXPECT_NE(nullptr, mRM->getResource(RM::ENCODER, MakeLoad(1280, 720, 30)));
+}
@@ -51,4 +51,45 @@ endif
 
 include $(BUILD_STATIC_LIBRARY)
 
+# runs on the mock device only
+ifeq ($(BOARD_USE_CODEC_OSAL_MOCK), true)
+###################################
+####  ExynosC2VideoCodecTest  #####
+###################################
+include $(CLEAR_VARS)
+
+LOCAL_CFLAGS :=
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_SRC_FILES := \
+        tests/ExynosVideoCodecEnc_test.cpp \
+        tests/ExynosVideoOSAL_test.cpp
+
+LOCAL_C_INCLUDES :=
+
+LOCAL_MODULE := ExynosC2VideoCodecTest
+LOCAL_LICENSE_KINDS := SPDX-license-identifier-Apache-2.0
+LOCAL_LICENSE_CONDITIONS := notice
+LOCAL_NOTICE_FILE := $(LOCAL_PATH)/NOTICE
+
+LOCAL_PROPRIETARY_MODULE := true
+
+LOCAL_HEADER_LIBRARIES := libexynosc2_videocodec_headers libexynosc2_codecfilter_headers
+LOCAL_HEADER_LIBRARIES += $(EXYNOS_VENDOR_HEADER_LIBS)
+
+LOCAL_STATIC_LIBRARIES := libExynosVideoCodec libExynosVideoApi2 libExynosC2OSAL
+
+LOCAL_SHARED_LIBRARIES := liblog libcutils libutils libhardware libhidlbase libexynosv4l2 libstagefright_foundation
+LOCAL_SHARED_LIBRARIES += $(EXYNOS_VENDOR_SHARED_LIBS)
+
+LOCAL_CFLAGS +=	-O2 \
+                -Werror \
+                -Wall \
+                -std=gnu++1z \
+                -std=c++2a
+LOCAL_CFLAGS += $(EXYNOS_GLOBAL_CFLAGS)
+
+include $(BUILD_NATIVE_TEST)
+endif
+
 include $(LOCAL_PATH)/libExynosVideoApi/Android.mk
@@ -580,7 +580,7 @@ ExynosVideoCodec::Type ExynosVideoCodec::getCodecType() {
     return mType;
 }
 
-bool ExynosVideoCodec::inputEnqueue(ExynosBufferInfo input) {
+bool ExynosVideoCodec::inputEnqueue(ExynosBufferInfo &&input) {
     ExynosLogFunctionTrace();
 
     auto shCodec = mCodec;
@@ -635,7 +635,7 @@ bool ExynosVideoCodec::inputEnqueue(ExynosBufferInfo input) {
     return true;
 }
 
-bool ExynosVideoCodec::outputEnqueue(ExynosBufferInfo output) {
+bool ExynosVideoCodec::outputEnqueue(ExynosBufferInfo &&output) {
     ExynosLogFunctionTrace();
 
     auto shCodec = mCodec;
@@ -780,8 +780,8 @@ bool ExynosVideoCodec::inputDequeue() {
      */
     if ((buffer.eDataInfo == DataInfo::UsedData) ||
         (buffer.eDataInfo == DataInfo::CorruptedData)) {
-        auto condfunc = [buffer](ExynosBufferInfo &e)->bool {
-                            if (buffer.obj.get() == e.obj.get()) {
+        auto condfunc = [obj = buffer.obj.get()](ExynosBufferInfo &e)->bool {
+                            if (obj == e.obj.get()) {
                                 return true;
                             }
 
@@ -879,14 +879,6 @@ bool ExynosVideoCodec::outputDequeue() {
             return false;
         }
 
-        auto condfunc = [buffer](ExynosBufferInfo &e)->bool {
-                            if (buffer.obj.get() == e.obj.get()) {
-                                return true;
-                            }
-
-                            return false;
-                        };
-
         ExynosLogD("[%s] outbuffer : ptr(%p)", __FUNCTION__, buffer.obj.get());
 
         {
@@ -903,7 +895,7 @@ bool ExynosVideoCodec::outputDequeue() {
         output.eDataInfo              = buffer.eDataInfo;
         output.stImageInfo.eFrameInfo = buffer.stImageInfo.eFrameInfo;
         output.nID      = buffer.nID;
-        output.params   = buffer.params;
+        output.params   = std::move(buffer.params);
 
         if (!mIsEncoder) {
             output.stImageInfo = buffer.stImageInfo;
@@ -1110,7 +1102,7 @@ bool ParallelProcessingVideoCodec::clearOutputBuffers() {
     return true;
 }
 
-bool ParallelProcessingVideoCodec::inputEnqueue(ExynosBufferInfo input) {
+bool ParallelProcessingVideoCodec::inputEnqueue(ExynosBufferInfo &&input) {
     ExynosLogFunctionTrace();
 
     auto shEnqueueThread = mEnqueueThread;
@@ -1129,25 +1121,26 @@ bool ParallelProcessingVideoCodec::inputEnqueue(ExynosBufferInfo input) {
 
 #endif
 
-    auto func = [wkOwner = weak_from_this(), reqTaskCnt = mInputFeedTaskCnt](ExynosBufferInfo input) mutable ->bool {
+    /* input is moved into the task, not copied as an argument of it */
+    auto func = [wkOwner = weak_from_this(), reqTaskCnt = mInputFeedTaskCnt, input = std::move(input)]() mutable ->bool {
                     reqTaskCnt.reset();  /* release a ref. count before calling doPipeInputEnqueue() */
 
                     auto shOwner = std::static_pointer_cast<ParallelProcessingVideoCodec>(GET_SHARED_PTR(wkOwner));
                     if (CHECK_SHARED_PTR(shOwner)) {
-                        return shOwner->doPipeInputEnqueue(input);
+                        return shOwner->doPipeInputEnqueue(std::move(input));
                     }
 
                     return false;
                 };
 
-    shEnqueueThread->toss(std::string("ParallelProcessingVideoCodec::doPipeInputEnqueue"), std::move(func), input);
+    shEnqueueThread->toss(std::string("ParallelProcessingVideoCodec::doPipeInputEnqueue"), std::move(func));
 
     /* TODO : error handling */
 
     return true;
 }
 
-bool ParallelProcessingVideoCodec::outputEnqueue(ExynosBufferInfo output) {
+bool ParallelProcessingVideoCodec::outputEnqueue(ExynosBufferInfo &&output) {
     ExynosLogFunctionTrace();
 
     auto DequeueRemainbuffer = [&]()->bool {
@@ -1189,8 +1182,16 @@ bool ParallelProcessingVideoCodec::outputEnqueue(ExynosBufferInfo output) {
 
     {
         std::weak_ptr<ParallelProcessingVideoCodec> wkThis = std::static_pointer_cast<ParallelProcessingVideoCodec>(shared_from_this());
-        auto ret = shEnqueueThread->post(std::string("ParallelProcessingVideoCodec::doOutputEnqueue"),
-                                         weak_pointer_bind(false, &ParallelProcessingVideoCodec::doOutputEnqueue, wkThis, output));
+        auto func = [wkThis, output = std::move(output)]() mutable ->bool {
+                        auto shThis = GET_SHARED_PTR(wkThis);
+                        if (CHECK_SHARED_PTR(shThis)) {
+                            return shThis->doOutputEnqueue(std::move(output));
+                        }
+
+                        return false;
+                    };
+
+        auto ret = shEnqueueThread->post(std::string("ParallelProcessingVideoCodec::doOutputEnqueue"), std::move(func));
         if (WaitGetResultFromFuture(ret, false) == true) {
             /* send a command to a dequeue thread */
             waitDequeue(false);
@@ -1278,7 +1279,7 @@ void ParallelProcessingVideoCodec::stopAllThreadPool() {
     return;
 }
 
-bool ParallelProcessingVideoCodec::doPipeInputEnqueue(ExynosBufferInfo input) {
+bool ParallelProcessingVideoCodec::doPipeInputEnqueue(ExynosBufferInfo &&input) {
     ExynosLogFunctionTrace();
 
     auto shCodec = mCodec;
@@ -1329,7 +1330,7 @@ bool ParallelProcessingVideoCodec::doPipeInputEnqueue(ExynosBufferInfo input) {
             break;
         }
 
-        auto ret = doInputEnqueue(pendingInput);
+        auto ret = doInputEnqueue(std::move(pendingInput));
         if (ret == true) {
             /* send a command to a dequeue thread */
             waitDequeue(true);
@@ -1344,16 +1345,16 @@ bool ParallelProcessingVideoCodec::doPipeInputEnqueue(ExynosBufferInfo input) {
     return true;
 }
 
-bool ParallelProcessingVideoCodec::doInputEnqueue(ExynosBufferInfo input) {
+bool ParallelProcessingVideoCodec::doInputEnqueue(ExynosBufferInfo &&input) {
     ExynosLogFunctionTrace();
 
-    return ExynosVideoCodec::inputEnqueue(input);
+    return ExynosVideoCodec::inputEnqueue(std::move(input));
 }
 
-bool ParallelProcessingVideoCodec::doOutputEnqueue(ExynosBufferInfo output) {
+bool ParallelProcessingVideoCodec::doOutputEnqueue(ExynosBufferInfo &&output) {
     ExynosLogFunctionTrace();
 
-    return ExynosVideoCodec::outputEnqueue(output);
+    return ExynosVideoCodec::outputEnqueue(std::move(output));
 }
 
 bool ParallelProcessingVideoCodec::doWaitInputDequeue() {
@@ -1416,19 +1417,27 @@ bool ParallelProcessingVideoCodec::doWaitInputDequeue() {
                                              }();
 
                                 if (avail) {
-                                    ExynosBufferInfo empty;
-                                    ExynosBufferInfo::reset(empty);
-
-                                    empty.obj = nullptr;
-
                                     auto shEnqueueThread = mEnqueueThread;
                                     if (!CHECK_SHARED_PTR(shEnqueueThread)) {
                                         return;
                                     }
 
                                     std::weak_ptr<ParallelProcessingVideoCodec> wkThis = std::static_pointer_cast<ParallelProcessingVideoCodec>(shared_from_this());
-                                    shEnqueueThread->toss(std::string("ParallelProcessingVideoCodec::doPipeInputEnqueue"),
-                                                                     weak_pointer_bind(false, &ParallelProcessingVideoCodec::doPipeInputEnqueue, wkThis, empty));
+                                    auto func = [wkThis]()->bool {
+                                                    auto shThis = GET_SHARED_PTR(wkThis);
+                                                    if (!CHECK_SHARED_PTR(shThis)) {
+                                                        return false;
+                                                    }
+
+                                                    ExynosBufferInfo empty;
+                                                    ExynosBufferInfo::reset(empty);
+
+                                                    empty.obj = nullptr;
+
+                                                    return shThis->doPipeInputEnqueue(std::move(empty));
+                                                };
+
+                                    shEnqueueThread->toss(std::string("ParallelProcessingVideoCodec::doPipeInputEnqueue"), std::move(func));
                                 }
                             }
 
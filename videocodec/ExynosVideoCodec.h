@@ -104,8 +104,8 @@ public:
     int  getExtraBufNum();
     ExynosVideoCodec::Type getCodecType();
 
-    virtual bool inputEnqueue(ExynosBufferInfo input);
-    virtual bool outputEnqueue(ExynosBufferInfo output);
+    virtual bool inputEnqueue(ExynosBufferInfo &&input);
+    virtual bool outputEnqueue(ExynosBufferInfo &&output);
     virtual bool flush();
     virtual bool waitDequeue(bool isInput);
 
@@ -150,8 +150,8 @@ public:
     ParallelProcessingVideoCodec(Type type);
     ~ParallelProcessingVideoCodec();
 
-    bool inputEnqueue(ExynosBufferInfo input) override;
-    bool outputEnqueue(ExynosBufferInfo output) override;
+    bool inputEnqueue(ExynosBufferInfo &&input) override;
+    bool outputEnqueue(ExynosBufferInfo &&output) override;
     bool flush() override;
     void stopAllThreadPool();
 
@@ -162,9 +162,9 @@ private:
     /* function for thread pool owned by self */
     int getAvailPipeInputCount();
 
-    bool doPipeInputEnqueue(ExynosBufferInfo input);
-    bool doInputEnqueue(ExynosBufferInfo input);
-    bool doOutputEnqueue(ExynosBufferInfo output);
+    bool doPipeInputEnqueue(ExynosBufferInfo &&input);
+    bool doInputEnqueue(ExynosBufferInfo &&input);
+    bool doOutputEnqueue(ExynosBufferInfo &&output);
     bool doWaitInputDequeue();
     bool doWaitOutputDequeue();
     bool doFlush();
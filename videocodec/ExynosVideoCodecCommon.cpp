@@ -136,8 +136,9 @@ ExynosErrorType ExynosVideoCodecCommon::commonSrcEnqueue(std::shared_ptr<CodecIm
          */
         if (needToChangeResolution(buf) ||
             getDRCRequired()) {
-            setDRCRequired(false);
+            /* cleared after changeResolution(), the required DRC is not able to take the fast path */
             auto err = changeResolution(buf);
+            setDRCRequired(false);
             if (err != EXYNOS_ERROR_NONE) {
                 ExynosLogE("[%s] changeResolution() is failed", __FUNCTION__);
                 return EXYNOS_ERROR_CHANGE_RESOLUTION;
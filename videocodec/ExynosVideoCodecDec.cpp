@@ -24,6 +24,7 @@
 #include "ExynosVideoCodecDec.h"
 #include "ExynosVideoApi.h"
 #include "ExynosVideoCodecCommon.h"
+#include "ExynosRefTable.h"
 
 #define LOG_ON
 #include "ExynosLog.h"
@@ -387,44 +388,42 @@ public:
     }
 
     ~RefDPBManager() {
-        mMap.clear();
+        mTable.clear();
     }
 
     void *swapSharedPtrToPtr(std::shared_ptr<ExynosBuffer> shPtr, fds_t &fds) override {
-        std::lock_guard<std::mutex> lock(mMutex);
         if (shPtr.get() != nullptr) {
-            auto optKey = shPtr->getStIno();
-            if (!optKey) {
-                shPtr->setStIno(BufferFdManager::getStIno((shPtr->handle())->data[0]));
+            uint64_t key = getKey(shPtr);
+
+            auto ptr = SharedPtrManager::swapSharedPtrToPtr(shPtr, fds);
+            if (ptr == nullptr) {
+                /* not queued, so that it is not counted as a reference */
+                ExynosLogE("[%s] swapSharedPtrToPtr() is failed : key(%zu)", __FUNCTION__, key);
+                return nullptr;
             }
 
-            addRefDPB(shPtr);
+            /* it is not accessed by the driver until it is queued after this */
+            int count = mTable.add(key, shPtr->origin());
+            ExynosLogT("[%s] ref DPB : key(%zu), cnt(%d)", __FUNCTION__, key, count);
+
+            /* the fixed fd is reported by the driver as a reference */
+            if (fds.plane > 0) {
+                mTable.bindFd(fds.fd[0], key);
+            }
 
-            return SharedPtrManager::swapSharedPtrToPtr(shPtr, fds);
+            return ptr;
         }
 
         return nullptr;
     }
 
     std::shared_ptr<ExynosBuffer> swapPtrToSharedPtr(void *ptr, bool bDelayReturn) override {
-        std::lock_guard<std::mutex> lock(mMutex);
-
         bDelayReturn = true;
         auto shPtr = SharedPtrManager::swapPtrToSharedPtr(ptr, bDelayReturn);
 
         if (shPtr.get() != nullptr) {
-            uint64_t key;
-            auto optKey = shPtr->getStIno();
-            if (!optKey) {
-                key = (uint64_t)BufferFdManager::getStIno((shPtr->handle())->data[0]);
-                shPtr->setStIno(key);
-            } else {
-                key = *optKey;
-            }
-
-            if (!findRefDPB(key)) {
+            if (!mTable.find(getKey(shPtr))) {
                 ExynosLogW("[%s] ref count is already decreased: fd(%d)", __FUNCTION__, (shPtr->handle())->data[0]);
-                // addRefDPB(shPtr);
             }
         }
 
@@ -432,52 +431,28 @@ public:
     }
 
     void eraseSharedPtr(std::shared_ptr<ExynosBuffer> shPtr) override {
-        std::lock_guard<std::mutex> lock(mMutex);
         if (shPtr != nullptr) {
             SharedPtrManager::eraseSharedPtr(shPtr);
 
-            uint64_t key;
-            auto optKey = shPtr->getStIno();
-            if (!optKey) {
-                key = (uint64_t)BufferFdManager::getStIno((shPtr->handle())->data[0]);
-                shPtr->setStIno(key);
-            } else {
-                key = *optKey;
-            }
-
-            auto search = mMap.find(key);
-            if (search != mMap.end()) {
-                (search->second.second)--;
+            uint64_t key = getKey(shPtr);
 
-                ExynosLogT("[%s] delete ref DPB : key(%zu), orig(%p), cnt(%d)", __FUNCTION__,
-                            key, (search->second.first).get(), search->second.second);
-
-                if (search->second.second == 0) {
-                    mMap.erase(search);
-                }
+            int count = mTable.del(key);
+            if (count >= 0) {
+                ExynosLogT("[%s] delete ref DPB : key(%zu), cnt(%d)", __FUNCTION__, key, count);
             }
         }
     }
 
     void reset() override {
-        std::lock_guard<std::mutex> lock(mMutex);
         SharedPtrManager::reset();
 
-        for (auto it = mMap.begin(); it != mMap.end(); it++) {
-            uint64_t key = it->first;
+        ExynosLogT("[%s] delete ref DPB : registered(%d), referenced(%d)", __FUNCTION__,
+                    mTable.registeredCount(), mTable.referencedCount());
 
-            (it->second.second) = 0;
-
-            ExynosLogT("[%s] delete ref DPB : key(%zu), orig(%p), cnt(%d)", __FUNCTION__,
-                        key, (it->second.first).get(), it->second.second);
-        }
-
-        mMap.clear();
+        mTable.clear();
     }
 
     int size() override {
-        std::lock_guard<std::mutex> lock(mMutex);
-
         int qcnt = SharedPtrManager::size();
 
         ExynosLogV("[%s] QBUF(%d)", __FUNCTION__, qcnt);
@@ -486,29 +461,28 @@ public:
     }
 
     void delRefDPB(RefDPBInfo &info) {
-        std::lock_guard<std::mutex> lock(mMutex);
-
         for (int i = 0; i < VIDEO_BUFFER_MAX_NUM; i++) {
             if (info.dpbFD[i].fd <= 0) {
                 break;
             }
 
-            if (mMap.size() > 0) {
-                auto search = mMap.find(BufferFdManager::getStIno(info.dpbFD[i].fd));
-                if (search != mMap.end()) {
-                    uint64_t key = search->first;
-                    delayReturn(key);
-                    ExynosLogT("[%s] ref key found", __FUNCTION__);
+            if (mTable.registeredCount() <= 0) {
+                break;
+            }
 
-                    (search->second.second)--;
+            uint64_t key;
+            auto optKey = mTable.getKeyOfFd(info.dpbFD[i].fd);
+            if (optKey) {
+                key = *optKey;
+            } else {
+                key = BufferFdManager::getStIno(info.dpbFD[i].fd);
+            }
 
-                    ExynosLogT("[%s] ref DPB : key(%zu), orig(%p), cnt(%d)", __FUNCTION__,
-                            key, (search->second.first).get(), search->second.second);
+            int count = mTable.del(key);
+            if (count >= 0) {
+                delayReturn(key);
 
-                    if (search->second.second == 0) {
-                        mMap.erase(search);
-                    }
-                }
+                ExynosLogT("[%s] ref DPB : key(%zu), cnt(%d)", __FUNCTION__, key, count);
             }
         }
 
@@ -516,90 +490,29 @@ public:
     }
 
     int registeredDPBCount() {
-        std::lock_guard<std::mutex> lock(mMutex);
-
-        return mMap.size();
+        return mTable.registeredCount();
     }
 
     int referencedDPBCount() {
-        std::lock_guard<std::mutex> lock(mMutex);
-
-        int count = 0;
-
-        for (const auto& [key, value] : mMap) {
-            if (value.second > 1) {
-                count++;
-            }
-        }
-
-        return count;
+        return mTable.referencedCount();
     }
 
 private:
-    bool findRefDPB(std::shared_ptr<ExynosBuffer> buffer) {
-        if ((mMap.size() > 0) && (buffer.get() != nullptr)) {
-            uint64_t key;
-            auto optKey = buffer->getStIno();
-            if (!optKey) {
-                key = (uint64_t)BufferFdManager::getStIno((buffer->handle())->data[0]);
-                buffer->setStIno(key);
-            } else {
-                key = *optKey;
-            }
-
-            return (mMap.count(key) == 0)? false:true;
+    /* the identity is set on allocation, fstat() is a fallback */
+    uint64_t getKey(std::shared_ptr<ExynosBuffer> buffer) {
+        auto optKey = buffer->getStIno();
+        if (optKey) {
+            return *optKey;
         }
 
-        return false;
-    }
-
-    bool findRefDPB(uint64_t key) {
-        return ((mMap.size() > 0) && (mMap.count(key) > 0))? true:false;
-    }
+        uint64_t key = BufferFdManager::getStIno((buffer->handle())->data[0]);
+        buffer->setStIno(key);
 
-    void addRefDPB(std::shared_ptr<ExynosBuffer> buffer) {
-        if (buffer.get() != nullptr) {
-            uint64_t key;
-            auto optKey = buffer->getStIno();
-            if (!optKey) {
-                key = (uint64_t)BufferFdManager::getStIno((buffer->handle())->data[0]);
-                buffer->setStIno(key);
-            } else {
-                key = *optKey;
-            }
-
-            auto search = mMap.find(key);
-            if (search == mMap.end()) {
-                search = mMap.insert(std::make_pair(key, std::make_pair(buffer->origin(), 1))).first;
-            } else {
-                (search->second.second)++;
-            }
-
-            ExynosLogT("[%s] ref DPB : key(%zu), orig(%p), cnt(%d)", __FUNCTION__,
-                        key, (search->second.first).get(), search->second.second);
-        }
-
-        return;
-    }
-
-    void addRefDPB(uint64_t key, std::shared_ptr<ExynosBuffer> buffer) {
-        if (buffer.get() != nullptr) {
-            auto search = mMap.find(key);
-            if (search == mMap.end()) {
-                search = mMap.insert(std::make_pair(key, std::make_pair(buffer->origin(), 1))).first;
-            } else {
-                (search->second.second)++;
-            }
-
-            ExynosLogT("[%s] ref DPB : key(%zu), orig(%p), cnt(%d)", __FUNCTION__,
-                        key, (search->second.first).get(), search->second.second);
-        }
-
-        return;
+        return key;
     }
 
-    std::mutex mMutex;
-    std::map<uint64_t, std::pair<std::shared_ptr<ExynosBuffer::ExynosBufferOrigin>, int>> mMap;
+    /* no lock for the whole, queue and fds are guarded by SharedPtrManager */
+    ExynosRefTable<ExynosBuffer::ExynosBufferOrigin> mTable;
 };
 #endif
 
@@ -1654,7 +1567,7 @@ void ExynosVideoCodecDec::updateBlackBarInfoToParam(ExynosParams &params) {
     }
 
     {
-        auto param = std::make_shared<ExynosParam<ParamBlackBarInfo>>();
+        auto param = MakePooledShared<ExynosParam<ParamBlackBarInfo>>();
 
         param->m.rect.nLeft     = info.nLeft;
         param->m.rect.nTop      = info.nTop;
@@ -1686,7 +1599,7 @@ void ExynosVideoCodecDec::updateFilmGrainInfoToParam(ExynosParams &params) {
     }
 
     {
-        auto param = std::make_shared<ExynosParam<ParamFilmGrainInfo>>();
+        auto param = MakePooledShared<ExynosParam<ParamFilmGrainInfo>>();
 
         memcpy(&(param->m.info), &info, sizeof(param->m.info));
 
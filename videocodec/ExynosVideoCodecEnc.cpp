@@ -16,6 +16,7 @@
  */
 #include <string>
 #include <cmath>
+#include <type_traits>
 
 #include <system/graphics.h>
 #include "exynos_format.h"
@@ -167,6 +168,27 @@ static void cnvHdrDynamicInfotoVideoHdrDynamic(
     return;
 }
 
+/* the last value set to the driver */
+template<typename T>
+class AppliedValue {
+public:
+    static_assert(std::has_unique_object_representations_v<T>, "compared by memcmp");
+
+    /* true if it has not been set yet or value is different */
+    bool isChanged(const T &value) const {
+        return (!mIsValid || (memcmp(&mValue, &value, sizeof(T)) != 0));
+    }
+
+    void update(const T &value) {
+        mValue = value;
+        mIsValid = true;
+    }
+
+private:
+    T    mValue{};
+    bool mIsValid = false;
+};
+
 class ExynosVideoCodecEnc::CodecEncImpl : public CodecImpl {
 public:
     CodecEncImpl(std::string name) : CodecImpl(name, true) {
@@ -187,12 +209,15 @@ public:
         mHasHDRStaticInfo = false;
         mHdrEncodingType = HDR_ENCODING_UNKNOWN;
         mIsHdr10PlusStat = false;
+        mUseFastDRC = ExynosUtils::GetEncFastDRCType();
     }
 
     ~CodecEncImpl() = default;
 
     ExynosVideoErrorType setDefaultConfig(ExynosBufferInfo &input, bool isDRC = false);
     void                 printConfig();
+    int                  getIntraRefreshMBs(ExynosParams &params, uint32_t width, uint32_t height);
+    void                 updateInCapacity(ExynosVideoGeometry &geometry);
 
     ExynosVideoErrorType enablePrependSpsPpsToIDR();
     ExynosVideoErrorType setBitrate(uint32_t bitrate);
@@ -249,6 +274,31 @@ public:
     ExynosHdrEncodingType  mHdrEncodingType;
     bool                   mIsHdr10PlusStat;
 
+    /* dynamic configurations set to the driver. they are not set again with the same value */
+    struct AppliedConfig {
+        AppliedValue<uint32_t>      bitrate;
+        AppliedValue<uint32_t>      framerate;
+        AppliedValue<uint32_t>      idrPeriod;
+        AppliedValue<ParamLayering> layering;
+        AppliedValue<ParamQpRange>  qpRange;
+        AppliedValue<uint32_t>      operatingRate;
+        AppliedValue<uint32_t>      realTimePriority;
+        AppliedValue<uint32_t>      iFrameRatio;
+        AppliedValue<int>           maxIFrameSize;
+    } mApplied;
+
+    /* input geometry which buffers and the instance are set up for by the full path.
+     * a resolution change within it keeps them and takes the fast path.
+     */
+    struct InCapacity {
+        uint32_t                    width       = 0;
+        uint32_t                    height      = 0;
+        ExynosVideoColorFormatType  format      = VIDEO_COLORFORMAT_UNKNOWN;
+        int                         planeCnt    = 0;
+    } mInCapacity;
+
+    bool mUseFastDRC;
+
 private:
     void setH264StaticConfig(ExynosParams &params, ExynosVideoMeta *meta);
     void setHevcStaticConfig(ExynosParams &params, ExynosVideoMeta *meta);
@@ -268,6 +318,9 @@ ExynosVideoErrorType ExynosVideoCodecEnc::CodecEncImpl::setDefaultConfig(
 
     ExynosVideoMeta *meta = input.obj->metadata();
 
+    /* configurations are set again from the default */
+    mApplied = AppliedConfig();
+
     if (!isDRC) {
         memset(&mEncParam, 0, sizeof(mEncParam));
     }
@@ -335,26 +388,11 @@ ExynosVideoErrorType ExynosVideoCodecEnc::CodecEncImpl::setDefaultConfig(
     {
         /* intra refresh */
         {
-            auto baseParam = input.params.getParam(ExynosParamIndex::IntraRefreshIndex);
-            if (baseParam.get() != nullptr) {
-                auto param = std::static_pointer_cast<ExynosParam<ParamIntraRefresh>>(baseParam);
-
-                if (param->m.period > 0.0) {
-                    int mbsize = 16;
-                    if ((mVideoInstInfo.eCodecType == VIDEO_CODING_HEVC) ||
-                        (mVideoInstInfo.eCodecType == VIDEO_CODING_VP9)) {
-                        mbsize = 32;
-                    }
-
-                    /* W/A : the behavior of ACodec */
-                    int mbs = (int)std::ceil(
-                                    std::ceil((double)commonParam.SourceWidth / mbsize) *
-                                    std::ceil((double)commonParam.SourceHeight / mbsize) / param->m.period);
-
-                    commonParam.RandomIntraMBRefresh = mbs;
+            int mbs = getIntraRefreshMBs(input.params, commonParam.SourceWidth, commonParam.SourceHeight);
+            if (mbs >= 0) {
+                commonParam.RandomIntraMBRefresh = mbs;
 
-                    ExynosLogD("[%s] intra refresh(%d)", __FUNCTION__, mbs);
-                }
+                ExynosLogD("[%s] intra refresh(%d)", __FUNCTION__, mbs);
             }
         }
     }
@@ -441,6 +479,37 @@ void ExynosVideoCodecEnc::CodecEncImpl::printConfig() {
     return;
 }
 
+/* returns -1 if intra refresh is not requested */
+int ExynosVideoCodecEnc::CodecEncImpl::getIntraRefreshMBs(ExynosParams &params, uint32_t width, uint32_t height) {
+    auto baseParam = params.getParam(ExynosParamIndex::IntraRefreshIndex);
+    if (baseParam.get() == nullptr) {
+        return -1;
+    }
+
+    auto param = std::static_pointer_cast<ExynosParam<ParamIntraRefresh>>(baseParam);
+    if (param->m.period <= 0.0) {
+        return -1;
+    }
+
+    int mbsize = 16;
+    if ((mVideoInstInfo.eCodecType == VIDEO_CODING_HEVC) ||
+        (mVideoInstInfo.eCodecType == VIDEO_CODING_VP9)) {
+        mbsize = 32;
+    }
+
+    /* W/A : the behavior of ACodec */
+    return (int)std::ceil(
+                    std::ceil((double)width / mbsize) *
+                    std::ceil((double)height / mbsize) / param->m.period);
+}
+
+void ExynosVideoCodecEnc::CodecEncImpl::updateInCapacity(ExynosVideoGeometry &geometry) {
+    mInCapacity.width    = geometry.nWidth;
+    mInCapacity.height   = geometry.nHeight;
+    mInCapacity.format   = geometry.eColorFormat;
+    mInCapacity.planeCnt = geometry.nPlaneCnt;
+}
+
 ExynosVideoErrorType ExynosVideoCodecEnc::CodecEncImpl::enablePrependSpsPpsToIDR() {
     ExynosLogFunctionTrace();
 
@@ -1099,6 +1168,7 @@ ExynosErrorType ExynosVideoCodecEnc::srcSetup(ExynosBufferInfo input) {
         mCodecImpl->mEncParam.common.FrameMap = geometry.eColorFormat;
 
         memcpy(&(mCodecImpl->mInGeometry), &geometry, sizeof(geometry));
+        mCodecImpl->updateInCapacity(geometry);
     }
 
     if (inBufOps.Setup(handle, 0/* DYNAMIC */) != VIDEO_ERROR_NONE) {
@@ -1214,31 +1284,125 @@ bool ExynosVideoCodecEnc::needToChangeResolution(ExynosBufferInfo &buf) {
             return true;
         }
 
-        ExynosVideoMeta *meta = buf.obj->metadata();
-        if (meta != nullptr) {
-            if ((meta->eType & VIDEO_INFO_TYPE_YSUM_DATA) &&
-                (!mCodecImpl->mIsWeightedPrediction)) {
-                return true;
-            }
+        if (isFeatureChanged(buf)) {
+            return true;
+        }
+    }
 
-            if ((meta->eType & VIDEO_INFO_TYPE_GDC_OTF) &&
-                (meta->data.enc.nUseGdcOTF != GDC_TYPE_NONE) &&
-                (!mCodecImpl->mIsGDCvOTF)) {
-                return true;
-            }
+    return false;
+}
 
-            if ((meta->eType & VIDEO_INFO_TYPE_ROI_INFO) &&
-                ((mCodecImpl->mVideoInstInfo.eCodecType == VIDEO_CODING_AVC) ||
-                 (mCodecImpl->mVideoInstInfo.eCodecType == VIDEO_CODING_HEVC)) &&
-                (!mCodecImpl->mIsROI)) {
-                return true;
-            }
+/* features which are enabled only on setting up */
+bool ExynosVideoCodecEnc::isFeatureChanged(ExynosBufferInfo &buf) {
+    ExynosVideoMeta *meta = buf.obj->metadata();
+    if (meta != nullptr) {
+        if ((meta->eType & VIDEO_INFO_TYPE_YSUM_DATA) &&
+            (!mCodecImpl->mIsWeightedPrediction)) {
+            return true;
+        }
+
+        if ((meta->eType & VIDEO_INFO_TYPE_GDC_OTF) &&
+            (meta->data.enc.nUseGdcOTF != GDC_TYPE_NONE) &&
+            (!mCodecImpl->mIsGDCvOTF)) {
+            return true;
+        }
+
+        if ((meta->eType & VIDEO_INFO_TYPE_ROI_INFO) &&
+            ((mCodecImpl->mVideoInstInfo.eCodecType == VIDEO_CODING_AVC) ||
+             (mCodecImpl->mVideoInstInfo.eCodecType == VIDEO_CODING_HEVC)) &&
+            (!mCodecImpl->mIsROI)) {
+            return true;
         }
     }
 
     return false;
 }
 
+/* only the size is changed within the capacity */
+bool ExynosVideoCodecEnc::canChangeResolutionFast(ExynosBufferInfo &buf) {
+    auto &capacity = mCodecImpl->mInCapacity;
+
+    if ((!mCodecImpl->mUseFastDRC) ||
+        (!mExynosPort[ExynosPort::Input].mIsConfigured) ||
+        (mCodecImpl->mIsDRCRequired) ||
+        (capacity.format == VIDEO_COLORFORMAT_UNKNOWN)) {
+        return false;
+    }
+
+    if ((buf.stImageInfo.nWidth > capacity.width) ||
+        (buf.stImageInfo.nHeight > capacity.height) ||
+        ((ExynosVideoColorFormatType)getVideoFormat(buf.stImageInfo.nFormat) != capacity.format) ||
+        (buf.nPlane != capacity.planeCnt)) {
+        return false;
+    }
+
+    return !isFeatureChanged(buf);
+}
+
+/*
+ * buffer registrations and configurations are kept,
+ * only the format of input and controls depending on the size are set again.
+ * S_FMT is issued without REQBUFS(0) unlike the full path. it is not verified yet
+ * whether MFC D/D accepts it on all targets, so that it is disabled by default
+ * (vendor.debug.c2.enc.fastdrc.enable) and the full path is used if it is failed.
+ */
+ExynosErrorType ExynosVideoCodecEnc::changeResolutionFast(ExynosBufferInfo &buf) {
+    ExynosLogFunctionTrace();
+
+    ExynosVideoEncOps       &ops        = std::get<ExynosVideoEncOps>(mCodecImpl->mCommonOps);
+    ExynosVideoBufferOps    &inBufOps   = mCodecImpl->mInBufOps;
+
+    auto handle = mCodecImpl->mHandle;
+
+    /* format can not be changed while streaming */
+    streamOnOff(ExynosPort::Input, ExynosPort::Off);
+
+    ExynosVideoGeometry geometry = mCodecImpl->mInGeometry;
+
+    geometry.nWidth   = buf.stImageInfo.nWidth;
+    geometry.nHeight  = buf.stImageInfo.nHeight;
+    geometry.nStride  = buf.stImageInfo.nStride;
+    geometry.nCStride = vendor::graphics::ExynosGraphicBufferMeta::get_cstride(buf.obj->handle());
+
+    if (inBufOps.Set_Geometry(handle, &geometry) != VIDEO_ERROR_NONE) {
+        ExynosLogE("[%s] inbuf : Set_Geometry() is failed", __FUNCTION__);
+        return EXYNOS_ERROR_UNKNOWN;
+    }
+
+    memcpy(&(mCodecImpl->mInGeometry), &geometry, sizeof(geometry));
+
+    ExynosVideoEncCommonParam &commonParam = mCodecImpl->mEncParam.common;
+
+    commonParam.SourceWidth  = geometry.nWidth;
+    commonParam.SourceHeight = geometry.nHeight;
+
+    /* mEncParam follows dynamic configurations, so that rate control is not changed by this */
+    int mbs = mCodecImpl->getIntraRefreshMBs(buf.params, geometry.nWidth, geometry.nHeight);
+    if ((mbs >= 0) &&
+        (mbs != commonParam.RandomIntraMBRefresh)) {
+        commonParam.RandomIntraMBRefresh = mbs;
+
+        if (ops.Set_EncParam(handle, &(mCodecImpl->mEncParam)) != VIDEO_ERROR_NONE) {
+            ExynosLogE("[%s] Set_EncParam() is failed", __FUNCTION__);
+            return EXYNOS_ERROR_UNKNOWN;
+        }
+
+        ExynosLogD("[%s] intra refresh(%d)", __FUNCTION__, mbs);
+    }
+
+    /* header with IDR */
+    if (ops.Set_HeaderMode(handle, VIDEO_FALSE) != VIDEO_ERROR_NONE) {
+        ExynosLogE("[%s] Set_HeaderMode() is failed", __FUNCTION__);
+        return EXYNOS_ERROR_UNKNOWN;
+    }
+
+    ExynosLogD("[%s] stream is changed to (w:%d, h:%d, f:0x%x) within (w:%d, h:%d)", __FUNCTION__,
+                buf.stImageInfo.nWidth, buf.stImageInfo.nHeight, buf.stImageInfo.nFormat,
+                mCodecImpl->mInCapacity.width, mCodecImpl->mInCapacity.height);
+
+    return EXYNOS_ERROR_NONE;
+}
+
 ExynosErrorType ExynosVideoCodecEnc::changeResolution(ExynosBufferInfo &buf) {
     ExynosLogFunctionTrace();
 
@@ -1252,6 +1416,14 @@ ExynosErrorType ExynosVideoCodecEnc::changeResolution(ExynosBufferInfo &buf) {
         return EXYNOS_ERROR_BAD_STATE;
     }
 
+    if (canChangeResolutionFast(buf)) {
+        if (changeResolutionFast(buf) == EXYNOS_ERROR_NONE) {
+            return EXYNOS_ERROR_NONE;
+        }
+
+        ExynosLogW("[%s] fast path is failed, buffers are set up again", __FUNCTION__);
+    }
+
     streamOnOff(ExynosPort::Input, ExynosPort::Off);
 
     ExynosVideoGeometry geometry;
@@ -1292,6 +1464,9 @@ ExynosErrorType ExynosVideoCodecEnc::changeResolution(ExynosBufferInfo &buf) {
         }
 
         mCodecImpl->mEncParam.common.FrameMap = geometry.eColorFormat;
+
+        memcpy(&(mCodecImpl->mInGeometry), &geometry, sizeof(geometry));
+        mCodecImpl->updateInCapacity(geometry);
     }
 
     if (inBufOps.Setup(handle, 0/* DYNAMIC */) != VIDEO_ERROR_NONE) {
@@ -1362,35 +1537,30 @@ bool ExynosVideoCodecEnc::getDRCRequired() {
     return mCodecImpl->mIsDRCRequired;
 }
 
-void ExynosVideoCodecEnc::applyConfig_Bitrate(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_Bitrate(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
     /* bitrate */
-    auto baseParam = params.getParam(ExynosParamIndex::BitrateIndex);
-    if (baseParam.get() == nullptr) {
+    auto param = std::static_pointer_cast<ExynosParam<ParamBitrate>>(baseParam);
+
+    if (!mCodecImpl->mApplied.bitrate.isChanged(param->m.bitrate)) {
         return;
     }
 
-    auto param = std::static_pointer_cast<ExynosParam<ParamBitrate>>(baseParam);
-
     auto err = mCodecImpl->setBitrate(param->m.bitrate);
 
     if (err == VIDEO_ERROR_NONE) {
+        mCodecImpl->mApplied.bitrate.update(param->m.bitrate);
         ExynosLogD("[%s] bitrate is changed to %d", __FUNCTION__, param->m.bitrate);
     } else {
         ExynosLogE("[%s] Set_BitRate(%d) is failed", __FUNCTION__, param->m.bitrate);
     }
 }
 
-void ExynosVideoCodecEnc::applyConfig_Framerate(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_Framerate(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
     /* framerate */
-    auto baseParam = params.getParam(ExynosParamIndex::FramerateIndex);
-    if (baseParam.get() == nullptr) {
-        return;
-    }
-
     auto param = std::static_pointer_cast<ExynosParam<ParamFramerate>>(baseParam);
 
     auto framerate = param->m.framerate;
@@ -1402,188 +1572,183 @@ void ExynosVideoCodecEnc::applyConfig_Framerate(ExynosParams &params) {
          framerate = 30;
     }
 
+    if (!mCodecImpl->mApplied.framerate.isChanged(framerate)) {
+        return;
+    }
+
     auto err = mCodecImpl->setFramerate(framerate);
 
     if (err == VIDEO_ERROR_NONE) {
+        mCodecImpl->mApplied.framerate.update(framerate);
         ExynosLogD("[%s] framerate is changed to %d", __FUNCTION__, framerate);
     } else {
         ExynosLogE("[%s] Set_FrameRate(%d) is failed", __FUNCTION__, framerate);
     }
 }
 
-void ExynosVideoCodecEnc::applyConfig_IdrPeriod(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_IdrPeriod(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
     /* IDR period */
-    auto baseParam = params.getParam(ExynosParamIndex::IDRPeriodIndex);
-    if (baseParam.get() == nullptr) {
+    auto param = std::static_pointer_cast<ExynosParam<ParamIDRPeriod>>(baseParam);
+
+    if (!mCodecImpl->mApplied.idrPeriod.isChanged(param->m.period)) {
         return;
     }
 
-    auto param = std::static_pointer_cast<ExynosParam<ParamIDRPeriod>>(baseParam);
-
     auto err = mCodecImpl->setIDRPeriod(param->m.period);
 
     if (err == VIDEO_ERROR_NONE) {
+        mCodecImpl->mApplied.idrPeriod.update(param->m.period);
         ExynosLogD("[%s] IDR Period is changed to %d", __FUNCTION__, param->m.period);
     } else {
         ExynosLogE("[%s] Set_IDRPeriod(%d) is failed", __FUNCTION__, param->m.period);
     }
 }
 
-void ExynosVideoCodecEnc::applyConfig_Layering(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_Layering(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
     /* layering (Temporal SVC) */
-    auto baseParam = params.getParam(ExynosParamIndex::LayeringIndex);
-    if (baseParam.get() == nullptr) {
+    auto param = std::static_pointer_cast<ExynosParam<ParamLayering>>(baseParam);
+
+    if (!mCodecImpl->mApplied.layering.isChanged(param->m)) {
         return;
     }
 
-    auto param = std::static_pointer_cast<ExynosParam<ParamLayering>>(baseParam);
-
     auto err = mCodecImpl->setLayering(param->m);
 
     if (err == VIDEO_ERROR_NONE) {
+        mCodecImpl->mApplied.layering.update(param->m);
         ExynosLogD("[%s] layering is changed to %d", __FUNCTION__, param->m.layerCount);
     } else {
         ExynosLogE("[%s] Set_LayerChange(%d) is failed", __FUNCTION__, param->m.layerCount);
     }
 }
 
-void ExynosVideoCodecEnc::applyConfig_QpRange(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_QpRange(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
     /* qp range */
-    auto baseParam = params.getParam(ExynosParamIndex::QpRangeIndex);
-    if (baseParam.get() == nullptr) {
+    auto param = std::static_pointer_cast<ExynosParam<ParamQpRange>>(baseParam);
+
+    if (!mCodecImpl->mApplied.qpRange.isChanged(param->m)) {
         return;
     }
 
-    auto param = std::static_pointer_cast<ExynosParam<ParamQpRange>>(baseParam);
-
     auto err = mCodecImpl->setQpRange(param->m);
 
     if (err == VIDEO_ERROR_NONE) {
+        mCodecImpl->mApplied.qpRange.update(param->m);
         ExynosLogD("[%s] qp range is changed", __FUNCTION__);
     } else {
         ExynosLogE("[%s] Set_QpRange() is failed", __FUNCTION__);
     }
 }
 
-void ExynosVideoCodecEnc::applyConfig_OperatingRate(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_OperatingRate(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
     /* operating rate */
-    auto baseParam = params.getParam(ExynosParamIndex::OperatingRateIndex);
-    if (baseParam.get() != nullptr) {
-        auto param = std::static_pointer_cast<ExynosParam<ParamOperatingRate>>(baseParam);
+    auto param = std::static_pointer_cast<ExynosParam<ParamOperatingRate>>(baseParam);
+
+    if (!mCodecImpl->mApplied.operatingRate.isChanged(param->m.value)) {
+        return;
+    }
 
-        auto err = mCodecImpl->setOperatingRate(param->m.value);
+    auto err = mCodecImpl->setOperatingRate(param->m.value);
 
-        if (err == VIDEO_ERROR_NONE) {
-            ExynosLogD("[%s] operating rate is %d", __FUNCTION__, param->m.value);
-        } else {
-            ExynosLogE("[%s] Set_OperatingRate(%d) is failed", __FUNCTION__, param->m.value);
-        }
+    if (err == VIDEO_ERROR_NONE) {
+        mCodecImpl->mApplied.operatingRate.update(param->m.value);
+        ExynosLogD("[%s] operating rate is %d", __FUNCTION__, param->m.value);
+    } else {
+        ExynosLogE("[%s] Set_OperatingRate(%d) is failed", __FUNCTION__, param->m.value);
     }
 }
 
-void ExynosVideoCodecEnc::applyConfig_RealTimePriority(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_RealTimePriority(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
     /* realtime priority */
-    auto baseParam = params.getParam(ExynosParamIndex::RealTimePriorityIndex);
-    if (baseParam.get() == nullptr) {
+    auto param = std::static_pointer_cast<ExynosParam<ParamRealTimePriority>>(baseParam);
+
+    if (!mCodecImpl->mApplied.realTimePriority.isChanged(param->m.value)) {
         return;
     }
 
-    auto param = std::static_pointer_cast<ExynosParam<ParamRealTimePriority>>(baseParam);
-
     auto err = mCodecImpl->setRealTimePriority(param->m.value);
 
     if (err == VIDEO_ERROR_NONE) {
+        mCodecImpl->mApplied.realTimePriority.update(param->m.value);
         ExynosLogD("[%s] RealTime priority is %d", __FUNCTION__, param->m.value);
     } else {
         ExynosLogE("[%s] Set_RealTimePriority(%d) is failed", __FUNCTION__, param->m.value);
     }
 }
 
-void ExynosVideoCodecEnc::applyConfig_AverageQp(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_AverageQp(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
     /* average qp */
-    auto baseParam = params.getParam(ExynosParamIndex::AverageQpIndex);
-    if (baseParam.get() != nullptr) {
-        auto param = std::static_pointer_cast<ExynosParam<ParamAverageQp>>(baseParam);
+    auto param = std::static_pointer_cast<ExynosParam<ParamAverageQp>>(baseParam);
 
-        mCodecImpl->mIsAverageQp = (param->m.enable == 1)? true:false;
-    }
+    mCodecImpl->mIsAverageQp = (param->m.enable == 1)? true:false;
 }
 
-void ExynosVideoCodecEnc::applyConfig_IFrameRatio(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_IFrameRatio(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
     /* i-frame ratio */
-    auto baseParam = params.getParam(ExynosParamIndex::IFrameRatioIndex);
-    if (baseParam.get() != nullptr) {
-        auto param = std::static_pointer_cast<ExynosParam<ParamIFrameRatio>>(baseParam);
+    auto param = std::static_pointer_cast<ExynosParam<ParamIFrameRatio>>(baseParam);
 
-        auto err = mCodecImpl->setIFrameRatio(param->m.value);
+    if (!mCodecImpl->mApplied.iFrameRatio.isChanged(param->m.value)) {
+        return;
+    }
 
-        if (err == VIDEO_ERROR_NONE) {
-            ExynosLogD("[%s] I frame ratio is %d", __FUNCTION__, param->m.value);
-        } else {
-            ExynosLogE("[%s] Set_IFrameRatio(%d) is failed", __FUNCTION__, param->m.value);
-        }
+    auto err = mCodecImpl->setIFrameRatio(param->m.value);
+
+    if (err == VIDEO_ERROR_NONE) {
+        mCodecImpl->mApplied.iFrameRatio.update(param->m.value);
+        ExynosLogD("[%s] I frame ratio is %d", __FUNCTION__, param->m.value);
+    } else {
+        ExynosLogE("[%s] Set_IFrameRatio(%d) is failed", __FUNCTION__, param->m.value);
     }
 }
 
-void ExynosVideoCodecEnc::applyConfig_PMV(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_PMV(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
     /* PMV */
-    auto baseParam = params.getParam(ExynosParamIndex::PMVIndex);
-    if (baseParam.get() != nullptr) {
-        auto param = std::static_pointer_cast<ExynosParam<ParamPMV>>(baseParam);
+    auto param = std::static_pointer_cast<ExynosParam<ParamPMV>>(baseParam);
 
-        auto err = mCodecImpl->setPMV(param->m);
+    auto err = mCodecImpl->setPMV(param->m);
 
-        if (err != VIDEO_ERROR_NONE) {
-            ExynosLogE("[%s] Set_PMV() is failed", __FUNCTION__);
-        }
+    if (err != VIDEO_ERROR_NONE) {
+        ExynosLogE("[%s] Set_PMV() is failed", __FUNCTION__);
     }
 }
 
-void ExynosVideoCodecEnc::applyConfig_IntraVopRefresh(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_IntraVopRefresh(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
-    /* intra VOP refresh */
-    auto baseParam = params.getParam(ExynosParamIndex::IntraVOPRefreshIndex);
-    if (baseParam.get() != nullptr) {
-        auto param = std::static_pointer_cast<ExynosParam<ParamIntraVOPRefresh>>(baseParam);
+    /* intra VOP refresh. it is a request of a frame, not a state */
+    auto param = std::static_pointer_cast<ExynosParam<ParamIntraVOPRefresh>>(baseParam);
 
-        if (param->m.request == On) {
-            auto err = mCodecImpl->setFrameType(VIDEO_FRAME_I);
+    if (param->m.request == On) {
+        auto err = mCodecImpl->setFrameType(VIDEO_FRAME_I);
 
-            if (err == VIDEO_ERROR_NONE) {
-                ExynosLogD("[%s] VOP refresh", __FUNCTION__);
-            } else {
-                ExynosLogE("[%s] Set_FrameType(VIDEO_FRAME_I) is failed", __FUNCTION__);
-            }
+        if (err == VIDEO_ERROR_NONE) {
+            ExynosLogD("[%s] VOP refresh", __FUNCTION__);
+        } else {
+            ExynosLogE("[%s] Set_FrameType(VIDEO_FRAME_I) is failed", __FUNCTION__);
         }
     }
 }
 
-void ExynosVideoCodecEnc::applyConfig_PrependHeaderMode(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_PrependHeaderMode(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
     /* prepend header mode */
-    auto baseParam = params.getParam(ExynosParamIndex::PrependHeaderModeIndex);
-    if (baseParam.get() == nullptr) {
-        return;
-    }
-
     auto param = std::static_pointer_cast<ExynosParam<ParamPrependHeaderMode>>(baseParam);
 
     if (param->m.mode != PREPEND_HEADER_MODE_SPS_PPS_TO_IDR) {
@@ -1599,15 +1764,10 @@ void ExynosVideoCodecEnc::applyConfig_PrependHeaderMode(ExynosParams &params) {
     }
 }
 
-void ExynosVideoCodecEnc::applyConfig_ColorAspects(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_ColorAspects(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
     /* Color Aspects */
-    auto baseParam = params.getParam(ExynosParamIndex::ColorAspectsIndex);
-    if (baseParam.get() == nullptr) {
-        return;
-    }
-
     auto param = std::static_pointer_cast<ExynosParam<ParamColorAspects>>(baseParam);
 
     /* convert value in RGBA case */
@@ -1627,37 +1787,27 @@ void ExynosVideoCodecEnc::applyConfig_ColorAspects(ExynosParams &params) {
     }
 }
 
-void ExynosVideoCodecEnc::applyConfig_DropControl(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_DropControl(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
     /* drop control */
-    auto baseParam = params.getParam(ExynosParamIndex::DropControlIndex);
-    if (baseParam.get() == nullptr) {
-        return;
-    }
-
     auto param = std::static_pointer_cast<ExynosParam<ParamDropControl>>(baseParam);
 
     mCodecImpl->mIsDropControl = (param->m.enable != 0)? true:false;
 }
 
-void ExynosVideoCodecEnc::applyConfig_Skype(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_Skype(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
-    /* skype features */
+    /* skype features. all of them are handled at once */
     if (mCodecImpl->mVideoInstInfo.eCodecType == VIDEO_CODING_AVC) {
         mCodecImpl->applySkypeConfig(params);
     }
 }
 
-void ExynosVideoCodecEnc::applyConfig_HDREncoding(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_HDREncoding(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
-    auto baseParam = params.getParam(ExynosParamIndex::HDREncodingIndex);
-    if (baseParam.get() == nullptr) {
-        return;
-    }
-
     auto param = std::static_pointer_cast<ExynosParam<ParamHdrEncoding>>(baseParam);
 
     auto err = mCodecImpl->enableHdrEncoding(param->m.type);
@@ -1669,78 +1819,53 @@ void ExynosVideoCodecEnc::applyConfig_HDREncoding(ExynosParams &params) {
     return;
 }
 
-void ExynosVideoCodecEnc::applyConfig_HDRStaticInfo(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_HDRStaticInfo(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
-    auto baseParam = params.getParam(ExynosParamIndex::HDRStaticInfoIndex);
-    if (baseParam.get() == nullptr) {
-        return;
-    }
-
-    auto param = std::static_pointer_cast<ExynosParam<ParamHdrStaticInfo>>(baseParam);
-
     if ((mCodecImpl->mVideoInstInfo.eCodecType == VIDEO_CODING_HEVC) &&
         (mCodecImpl->mInGeometry.eFilledDataType & DATA_10BIT) &&
         (mCodecImpl->mVideoInstInfo.supportInfo.enc.bHDRStaticInfoSupport == VIDEO_TRUE)) {
-        auto baseParam = params.getParam(ExynosParamIndex::HDRStaticInfoIndex);
-        if (baseParam.get() != nullptr) {
-            ExynosLogD("[%s] has StaticInfo", __FUNCTION__);
-            auto param = std::static_pointer_cast<ExynosParam<ParamHdrStaticInfo>>(baseParam);
+        ExynosLogD("[%s] has StaticInfo", __FUNCTION__);
+        auto param = std::static_pointer_cast<ExynosParam<ParamHdrStaticInfo>>(baseParam);
 
-            ExynosVideoHdrStatic STInfo;
-            cnvHdrStaticInfotoVideoHdrStatic(STInfo, param->m.ST);
+        ExynosVideoHdrStatic STInfo;
+        cnvHdrStaticInfotoVideoHdrStatic(STInfo, param->m.ST);
 
-            auto err = mCodecImpl->setHDRStaticInfo(STInfo);
-            if (err != VIDEO_ERROR_NONE) {
-                ExynosLogW("[%s] setHDRStaticInfo() is failed", __FUNCTION__);
-            }
+        auto err = mCodecImpl->setHDRStaticInfo(STInfo);
+        if (err != VIDEO_ERROR_NONE) {
+            ExynosLogW("[%s] setHDRStaticInfo() is failed", __FUNCTION__);
         }
     }
 }
 
-void ExynosVideoCodecEnc::applyConfig_HDR10PlusInfo(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_HDR10PlusInfo(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
-    auto baseParam = params.getParam(ExynosParamIndex::HDRDynamicInfoIndex);
-    if (baseParam.get() == nullptr) {
-        return;
-    }
-
-    auto param = std::static_pointer_cast<ExynosParam<ParamHdrDynamicInfo>>(baseParam);
-
     if ((mCodecImpl->mVideoInstInfo.eCodecType == VIDEO_CODING_HEVC) &&
         (mCodecImpl->mInGeometry.eFilledDataType & DATA_10BIT) &&
         (mCodecImpl->mVideoInstInfo.supportInfo.enc.bHDRDynamicInfoSupport == VIDEO_TRUE)) {
-        auto baseParam = params.getParam(ExynosParamIndex::HDRDynamicInfoIndex);
-        if (baseParam.get() != nullptr) {
-            auto param = std::static_pointer_cast<ExynosParam<ParamHdrDynamicInfo>>(baseParam);
+        auto param = std::static_pointer_cast<ExynosParam<ParamHdrDynamicInfo>>(baseParam);
 
-            ExynosLogD("[%s] has DynamicInfo", __FUNCTION__);
+        ExynosLogD("[%s] has DynamicInfo", __FUNCTION__);
 
-            if (mCodecImpl->mIsHdr10PlusStat) {
-                ExynosLogD("[%s] postponed about handling hdr dynamic info", __FUNCTION__);
-            } else {
-                ExynosVideoHdrDynamic DYInfo;
-                cnvHdrDynamicInfotoVideoHdrDynamic(DYInfo, param->m.DY);
+        if (mCodecImpl->mIsHdr10PlusStat) {
+            ExynosLogD("[%s] postponed about handling hdr dynamic info", __FUNCTION__);
+        } else {
+            ExynosVideoHdrDynamic DYInfo;
+            cnvHdrDynamicInfotoVideoHdrDynamic(DYInfo, param->m.DY);
 
-                auto err = mCodecImpl->setHDRDynamicInfo(DYInfo);
-                if (err != VIDEO_ERROR_NONE) {
-                    ExynosLogW("[%s] setHDRDynamicInfo() is failed", __FUNCTION__);
-                }
+            auto err = mCodecImpl->setHDRDynamicInfo(DYInfo);
+            if (err != VIDEO_ERROR_NONE) {
+                ExynosLogW("[%s] setHDRDynamicInfo() is failed", __FUNCTION__);
             }
         }
     }
 }
 
-void ExynosVideoCodecEnc::applyConfig_HDR10PlusStat(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_HDR10PlusStat(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
     /* hdr10plus statistic*/
-    auto baseParam = params.getParam(ExynosParamIndex::HDR10PlusStatIndex);
-    if (baseParam.get() == nullptr) {
-        return;
-    }
-
     auto param = std::static_pointer_cast<ExynosParam<ParamHDR10PlusStat>>(baseParam);
 
     if (param->m.enable == On) {
@@ -1754,25 +1879,78 @@ void ExynosVideoCodecEnc::applyConfig_HDR10PlusStat(ExynosParams &params) {
     }
 }
 
-void ExynosVideoCodecEnc::applyConfig_SetMaxIFrameSize(ExynosParams &params) {
+void ExynosVideoCodecEnc::applyConfig_SetMaxIFrameSize(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam) {
     ExynosLogFunctionTrace();
 
-    /* hdr10plus statistic*/
-    auto baseParam = params.getParam(ExynosParamIndex::MaxIFrameSizeIndex);
-    if (baseParam.get() == nullptr) {
+    /* max I frame size */
+    auto param = std::static_pointer_cast<ExynosParam<ParamMaxIFrameSize>>(baseParam);
+
+    if (!mCodecImpl->mApplied.maxIFrameSize.isChanged(param->m.size)) {
         return;
     }
 
-    auto param = std::static_pointer_cast<ExynosParam<ParamMaxIFrameSize>>(baseParam);
-
     auto err = mCodecImpl->setMaxIFrameSize(param->m.size);
     if (err == VIDEO_ERROR_NONE) {
+        mCodecImpl->mApplied.maxIFrameSize.update(param->m.size);
         ExynosLogD("[%s] max I frame size : %d", __FUNCTION__, param->m.size);
     } else {
         ExynosLogE("[%s] Set_MaxIFrameSize() is failed", __FUNCTION__);
     }
 }
 
+/* handlers in order of applying.
+ * hdr10plus statistic must be decided before setting HDR static or HDR dynamic.
+ */
+const std::array<ExynosVideoCodecEnc::ConfigHandler, ExynosVideoCodecEnc::kConfigHandlerCnt> ExynosVideoCodecEnc::sConfigHandlers = {{
+    /* dynamic configurations */
+    { ExynosParamIndex::BitrateIndex,            &ExynosVideoCodecEnc::applyConfig_Bitrate,            false },
+    { ExynosParamIndex::FramerateIndex,          &ExynosVideoCodecEnc::applyConfig_Framerate,          false },
+    { ExynosParamIndex::IDRPeriodIndex,          &ExynosVideoCodecEnc::applyConfig_IdrPeriod,          false },
+    { ExynosParamIndex::LayeringIndex,           &ExynosVideoCodecEnc::applyConfig_Layering,           false },
+    { ExynosParamIndex::QpRangeIndex,            &ExynosVideoCodecEnc::applyConfig_QpRange,            false },
+    { ExynosParamIndex::OperatingRateIndex,      &ExynosVideoCodecEnc::applyConfig_OperatingRate,      false },
+    { ExynosParamIndex::RealTimePriorityIndex,   &ExynosVideoCodecEnc::applyConfig_RealTimePriority,   false },
+    { ExynosParamIndex::AverageQpIndex,          &ExynosVideoCodecEnc::applyConfig_AverageQp,          false },
+    { ExynosParamIndex::IFrameRatioIndex,        &ExynosVideoCodecEnc::applyConfig_IFrameRatio,        false },
+    { ExynosParamIndex::PMVIndex,                &ExynosVideoCodecEnc::applyConfig_PMV,                false },
+    { ExynosParamIndex::IntraVOPRefreshIndex,    &ExynosVideoCodecEnc::applyConfig_IntraVopRefresh,    false },
+    { ExynosParamIndex::MaxIFrameSizeIndex,      &ExynosVideoCodecEnc::applyConfig_SetMaxIFrameSize,   false },
+    { ExynosParamIndex::HDR10PlusStatIndex,      &ExynosVideoCodecEnc::applyConfig_HDR10PlusStat,      false },
+    /* it can not be applied during encoding */
+    { ExynosParamIndex::PrependHeaderModeIndex,  &ExynosVideoCodecEnc::applyConfig_PrependHeaderMode,  true },
+    { ExynosParamIndex::ColorAspectsIndex,       &ExynosVideoCodecEnc::applyConfig_ColorAspects,       true },
+    { ExynosParamIndex::HDREncodingIndex,        &ExynosVideoCodecEnc::applyConfig_HDREncoding,        true },
+    { ExynosParamIndex::HDRStaticInfoIndex,      &ExynosVideoCodecEnc::applyConfig_HDRStaticInfo,      true },
+    { ExynosParamIndex::DropControlIndex,        &ExynosVideoCodecEnc::applyConfig_DropControl,        true },
+    /* skype features : any of them calls the handler once */
+    { ExynosParamIndex::SkypeLowLatencyIndex,    &ExynosVideoCodecEnc::applyConfig_Skype,              false },
+    { ExynosParamIndex::HDRDynamicInfoIndex,     &ExynosVideoCodecEnc::applyConfig_HDR10PlusInfo,      false },
+}};
+
+int ExynosVideoCodecEnc::getConfigHandlerSlot(ParamIndex index) {
+    /* index of a param -> position in sConfigHandlers, built at once */
+    static const auto slots = []() {
+        std::array<int8_t, ExynosParamIndex::SkypeBaseLayerPidIndex + 1> table;
+        table.fill(-1);
+
+        for (int i = 0; i < kConfigHandlerCnt; i++) {
+            table[sConfigHandlers[i].index] = i;
+        }
+
+        for (int index = ExynosParamIndex::SkypeLowLatencyIndex; index <= ExynosParamIndex::SkypeBaseLayerPidIndex; index++) {
+            table[index] = table[ExynosParamIndex::SkypeLowLatencyIndex];
+        }
+
+        return table;
+    }();
+
+    if ((index < 0) || (index >= (ParamIndex)slots.size())) {
+        return -1;
+    }
+
+    return slots[index];
+}
+
 void ExynosVideoCodecEnc::applyConfig(ExynosParams &params) {
     ExynosLogFunctionTrace();
 
@@ -1788,68 +1966,42 @@ void ExynosVideoCodecEnc::applyConfig(ExynosParams &params) {
         return;
     }
 
-    /* dynamic configurations */
-    /* bitrate */
-    applyConfig_Bitrate(params);
-
-    /* framerate */
-    applyConfig_Framerate(params);
-
-    /* IDR period */
-    applyConfig_IdrPeriod(params);
-
-    /* layering (Temporal SVC) */
-    applyConfig_Layering(params);
-
-    /* qp range */
-    applyConfig_QpRange(params);
-
-    /* operating rate */
-    applyConfig_OperatingRate(params);
-
-    /* realtime priority */
-    applyConfig_RealTimePriority(params);
+    /* only handlers of params in this frame are called, a param is looked up once */
+    std::array<std::shared_ptr<ExynosParamBase> *, kConfigHandlerCnt> found{};
 
-    /* average qp */
-    applyConfig_AverageQp(params);
+    for (auto &entry : params) {
+        int slot = getConfigHandlerSlot(entry.first);
 
-    /* i-frame ratio */
-    applyConfig_IFrameRatio(params);
-
-    /* PMV */
-    applyConfig_PMV(params);
-
-    /* intra VOP refresh */
-    applyConfig_IntraVopRefresh(params);
-
-    /* max I frame size */
-    applyConfig_SetMaxIFrameSize(params);
-
-    /* hdr10plus statistic
-     * it must be decided before setting HDR static or HDR dynamic
-     */
-    applyConfig_HDR10PlusStat(params);
+        if ((slot >= 0) &&
+            (found[slot] == nullptr)) {
+            found[slot] = &(entry.second);
+        }
+    }
 
-    /* it can not be applied during encoding */
-    if (!isStreamOn(ExynosPort::Input)) {
-        /* prepend header mode */
-        applyConfig_PrependHeaderMode(params);
+    bool isStreaming = isStreamOn(ExynosPort::Input);
 
-        /* Color Aspects */
-        applyConfig_ColorAspects(params);
+    /* controls set by handlers are sent to the driver at once */
+    auto &encOps = std::get<ExynosVideoEncOps>(mCodecImpl->mCommonOps);
+    bool isBatched = (encOps.Begin_Controls(handle) == VIDEO_ERROR_NONE);
 
-        applyConfig_HDREncoding(params);
+    for (int i = 0; i < kConfigHandlerCnt; i++) {
+        if (found[i] == nullptr) {
+            continue;
+        }
 
-        applyConfig_HDRStaticInfo(params);
+        if (sConfigHandlers[i].isStatic && isStreaming) {
+            continue;
+        }
 
-        /* drop control */
-        applyConfig_DropControl(params);
+        (this->*(sConfigHandlers[i].apply))(params, *(found[i]));
     }
 
-    /* skype features */
-    applyConfig_Skype(params);
-
-    applyConfig_HDR10PlusInfo(params);
+    if (isBatched &&
+        (encOps.End_Controls(handle) != VIDEO_ERROR_NONE)) {
+        /* failed controls are reported by OSAL. every config will be set again on the next time */
+        ExynosLogW("[%s] some controls are not applied", __FUNCTION__);
+        mCodecImpl->mApplied = CodecEncImpl::AppliedConfig();
+    }
 }
 
 void ExynosVideoCodecEnc::getColorAspectsForRGB(
@@ -2150,7 +2302,7 @@ void ExynosVideoCodecEnc::updateAverageQpInfoToParam(ExynosParams &params) {
         return;
     }
 
-    auto param = std::make_shared<ExynosParam<ParamAverageQpInfo>>();
+    auto param = MakePooledShared<ExynosParam<ParamAverageQpInfo>>();
     param->m.value = qp;
 
     params.addParam(param);
@@ -2175,7 +2327,7 @@ void ExynosVideoCodecEnc::updateHDR10PlusStatInfoToParam(ExynosParams &params) {
         return;
     }
 
-    auto param = std::make_shared<ExynosParam<ParamHDR10PlusStatInfo>>();
+    auto param = MakePooledShared<ExynosParam<ParamHDR10PlusStatInfo>>();
 
     memcpy(&(param->m.info.sHdrDynamicStatInfo), &info.statistic_info, sizeof(ExynosHdrDynamicStatInfo));
     param->m.info.hdr10_plus_stat_sei_size = info.hdr10_plus_stat_sei_size;
@@ -2192,7 +2344,7 @@ void ExynosVideoCodecEnc::updateHDRDynamicInfoToParam(ExynosParams &params, Exyn
     ExynosLogFunctionTrace();
 
     if (DY.valid != 0) {
-        auto param = std::make_shared<ExynosParam<ParamHdrDynamicInfo>>();
+        auto param = MakePooledShared<ExynosParam<ParamHdrDynamicInfo>>();
 
         memcpy(&(param->m.DY), &DY, sizeof(param->m.DY));
 
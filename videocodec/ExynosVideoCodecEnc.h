@@ -17,6 +17,7 @@
 #ifndef EXYNOS_VIDEO_CODEC_ENC_H
 #define EXYNOS_VIDEO_CODEC_ENC_H
 
+#include <array>
 #include <memory>
 
 #include "ExynosVideoCodecCommon.h"
@@ -72,26 +73,42 @@ protected:
     ExynosVideoErrorType CodecSpecific_Reset_Wait_Buffer(std::shared_ptr<CodecImpl> codecImpl) override;
 
 private:
-    void applyConfig_Bitrate(ExynosParams &params);
-    void applyConfig_Framerate(ExynosParams &params);
-    void applyConfig_IdrPeriod(ExynosParams &params);
-    void applyConfig_Layering(ExynosParams &params);
-    void applyConfig_QpRange(ExynosParams &params);
-    void applyConfig_OperatingRate(ExynosParams &params);
-    void applyConfig_RealTimePriority(ExynosParams &params);
-    void applyConfig_AverageQp(ExynosParams &params);
-    void applyConfig_IFrameRatio(ExynosParams &params);
-    void applyConfig_PMV(ExynosParams &params);
-    void applyConfig_IntraVopRefresh(ExynosParams &params);
-    void applyConfig_PrependHeaderMode(ExynosParams &params);
-    void applyConfig_ColorAspects(ExynosParams &params);
-    void applyConfig_DropControl(ExynosParams &params);
-    void applyConfig_Skype(ExynosParams &params);
-    void applyConfig_HDREncoding(ExynosParams &params);
-    void applyConfig_HDRStaticInfo(ExynosParams &params);
-    void applyConfig_HDR10PlusInfo(ExynosParams &params);
-    void applyConfig_HDR10PlusStat(ExynosParams &params);
-    void applyConfig_SetMaxIFrameSize(ExynosParams &params);
+    void applyConfig_Bitrate(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_Framerate(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_IdrPeriod(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_Layering(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_QpRange(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_OperatingRate(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_RealTimePriority(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_AverageQp(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_IFrameRatio(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_PMV(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_IntraVopRefresh(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_PrependHeaderMode(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_ColorAspects(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_DropControl(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_Skype(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_HDREncoding(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_HDRStaticInfo(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_HDR10PlusInfo(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_HDR10PlusStat(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+    void applyConfig_SetMaxIFrameSize(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+
+    /* applying a param to the codec */
+    struct ConfigHandler {
+        ParamIndex index;
+        void (ExynosVideoCodecEnc::*apply)(ExynosParams &params, std::shared_ptr<ExynosParamBase> &baseParam);
+        bool isStatic;  /* it can not be applied during encoding */
+    };
+
+    static constexpr int kConfigHandlerCnt = 20;
+    static const std::array<ConfigHandler, kConfigHandlerCnt> sConfigHandlers;
+
+    static int getConfigHandlerSlot(ParamIndex index);
+
+    bool isFeatureChanged(ExynosBufferInfo &buf);
+    bool canChangeResolutionFast(ExynosBufferInfo &buf);
+    ExynosErrorType changeResolutionFast(ExynosBufferInfo &buf);
 
     void applyExtraInfo_Config(ExynosBufferInfo &buf);
     void applyExtraInfo_Param(ExynosBufferInfo &buf);
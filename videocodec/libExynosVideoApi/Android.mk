@@ -50,6 +50,11 @@ ifeq ($(BOARD_SUPPORT_GPU_SBWC), true)
 LOCAL_CFLAGS += -DUSE_SUPPORT_GPU_SBWC
 endif
 
+ifeq ($(BOARD_USE_CODEC_OSAL_MOCK), true)
+LOCAL_SRC_FILES += osal/ExynosVideo_OSAL_Mock.c
+LOCAL_CFLAGS += -DUSE_CODEC_OSAL_MOCK
+endif
+
 LOCAL_HEADER_LIBRARIES := libexynos_videoapi_headers
 LOCAL_HEADER_LIBRARIES += $(EXYNOS_VENDOR_HEADER_LIBS)
 
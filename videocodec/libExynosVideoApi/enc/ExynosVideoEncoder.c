@@ -1959,6 +1959,44 @@ ExynosVideoErrorType MFC_Encoder_Reset_Wait_Buffer(void *pHandle) {
     return MFC_Reset_Wait_Buffer(pHandle);
 }
 
+/*
+ * [Encoder OPS] Begin Controls
+ */
+static ExynosVideoErrorType MFC_Encoder_Begin_Controls(void *pHandle) {
+    CodecOSALVideoContext *pCtx = (CodecOSALVideoContext *)pHandle;
+
+    if (CHECK_POINTER(pCtx) == false) {
+        return VIDEO_ERROR_BADPARAM;
+    }
+
+    if (Codec_OSAL_BeginControls(pCtx) != 0) {
+        ALOGE("%s: Failed to begin controls", __FUNCTION__);
+        return VIDEO_ERROR_APIFAIL;
+    }
+
+    return VIDEO_ERROR_NONE;
+}
+
+/*
+ * [Encoder OPS] End Controls
+ */
+static ExynosVideoErrorType MFC_Encoder_End_Controls(void *pHandle) {
+    CodecOSALVideoContext *pCtx = (CodecOSALVideoContext *)pHandle;
+    int nFailed;
+
+    if (CHECK_POINTER(pCtx) == false) {
+        return VIDEO_ERROR_BADPARAM;
+    }
+
+    nFailed = Codec_OSAL_EndControls(pCtx);
+    if (nFailed != 0) {
+        ALOGE("%s: Failed to set controls(%d)", __FUNCTION__, nFailed);
+        return VIDEO_ERROR_APIFAIL;
+    }
+
+    return VIDEO_ERROR_NONE;
+}
+
 /*
  * [Encoder Buffer OPS] Enable Cacheable (Input)
  */
@@ -2738,6 +2776,9 @@ static ExynosVideoEncOps defEncOps = {
 
     .Stop_Wait_Buffer            = MFC_Encoder_Stop_Wait_Buffer,
     .Reset_Wait_Buffer           = MFC_Encoder_Reset_Wait_Buffer,
+
+    .Begin_Controls              = MFC_Encoder_Begin_Controls,
+    .End_Controls                = MFC_Encoder_End_Controls,
 };
 
 /*
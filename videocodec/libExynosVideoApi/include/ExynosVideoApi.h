@@ -1009,6 +1009,10 @@ typedef struct _ExynosVideoEncOps {
 
     ExynosVideoErrorType (*Stop_Wait_Buffer)(void *pHandle);
     ExynosVideoErrorType (*Reset_Wait_Buffer)(void *pHandle);
+
+    /* controls between them are set at once */
+    ExynosVideoErrorType (*Begin_Controls)(void *pHandle);
+    ExynosVideoErrorType (*End_Controls)(void *pHandle);
 } ExynosVideoEncOps;
 
 typedef struct _ExynosVideoBufferOps {
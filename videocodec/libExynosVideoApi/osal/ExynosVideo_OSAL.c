@@ -36,6 +36,10 @@
 #include "ExynosVideoDec.h"
 #include "ExynosVideoEnc.h"
 
+#ifdef USE_CODEC_OSAL_MOCK
+#include "ExynosVideo_OSAL_Mock.h"
+#endif
+
 #define LOG_NDEBUG 0
 #ifdef LOG_TAG
 #undef LOG_TAG
@@ -340,13 +344,100 @@ unsigned int Codec_OSAL_ColorFormatToPixelFormat(
     return nPixelFormat;
 }
 
+/* batch lock should be held */
+static void Codec_OSAL_SubmitControls(CodecOSALVideoContext *pCtx) {
+    CodecOSAL_CtrlBatch      *pBatch = &pCtx->osalCtx.batch;
+    struct v4l2_ext_controls  ext_ctrls;
+    int i;
+
+    if (pBatch->nCtrl <= 0)
+        return;
+
+    memset(&ext_ctrls, 0, sizeof(ext_ctrls));
+    ext_ctrls.ctrl_class = pBatch->ctrlClass;
+    ext_ctrls.count      = pBatch->nCtrl;
+    ext_ctrls.controls   = pBatch->ctrls;
+
+    if (exynos_v4l2_s_ext_ctrl(pCtx->videoCtx.hDevice, &ext_ctrls) != 0) {
+        /* some of them may be applied already, so that all of them are set again one by one */
+        ALOGW("[%s] failed to set %d controls at once(error_idx:%d). try to set them individually",
+                    __FUNCTION__, pBatch->nCtrl, ext_ctrls.error_idx);
+
+        for (i = 0; i < pBatch->nCtrl; i++) {
+            if (exynos_v4l2_s_ctrl(pCtx->videoCtx.hDevice, pBatch->ctrls[i].id, pBatch->ctrls[i].value) != 0) {
+                ALOGE("[%s] failed to set control(id:0x%x, value:%d)", __FUNCTION__,
+                            pBatch->ctrls[i].id, pBatch->ctrls[i].value);
+                pBatch->nFailed++;
+            }
+        }
+    }
+
+    pBatch->nCtrl = 0;
+}
+
+/* returns 0 if the control is taken by the batch */
+static int Codec_OSAL_AppendControl(
+    CodecOSALVideoContext  *pCtx,
+    unsigned int            uCID,
+    unsigned long           nValue) {
+    CodecOSAL_CtrlBatch     *pBatch = &pCtx->osalCtx.batch;
+    struct v4l2_ext_control *pCtrl  = NULL;
+    int ret = -1;
+
+    pthread_mutex_lock(&pBatch->lock);
+
+    if ((pBatch->bOpened == 1) &&
+        (pthread_equal(pBatch->owner, pthread_self()))) {
+        /* a single call can not have controls of different classes */
+        if ((pBatch->nCtrl >= CODEC_OSAL_MAX_BATCH_CTRL) ||
+            ((pBatch->nCtrl > 0) && (pBatch->ctrlClass != V4L2_CTRL_ID2CLASS(uCID))))
+            Codec_OSAL_SubmitControls(pCtx);
+
+        pCtrl = &pBatch->ctrls[pBatch->nCtrl];
+        memset(pCtrl, 0, sizeof(*pCtrl));
+        pCtrl->id    = uCID;
+        pCtrl->value = (int)nValue;
+
+        pBatch->ctrlClass = V4L2_CTRL_ID2CLASS(uCID);
+        pBatch->nCtrl++;
+
+        ret = 0;
+    }
+
+    pthread_mutex_unlock(&pBatch->lock);
+
+    return ret;
+}
+
+/* pending controls are set before the other request of the owner to keep the order */
+static void Codec_OSAL_FlushControls(CodecOSALVideoContext *pCtx) {
+    CodecOSAL_CtrlBatch *pBatch = &pCtx->osalCtx.batch;
+
+    pthread_mutex_lock(&pBatch->lock);
+
+    if ((pBatch->bOpened == 1) &&
+        (pthread_equal(pBatch->owner, pthread_self())))
+        Codec_OSAL_SubmitControls(pCtx);
+
+    pthread_mutex_unlock(&pBatch->lock);
+
+    return;
+}
+
 int Codec_OSAL_DevOpen(
     const char              *sDevName,
     int                      nFlag,
     CodecOSALVideoContext   *pCtx) {
     if ((sDevName != NULL) &&
         (pCtx != NULL)) {
+        pthread_mutex_init(&pCtx->osalCtx.batch.lock, NULL);
+        pCtx->osalCtx.batch.bOpened = 0;
+        pCtx->osalCtx.batch.nCtrl   = 0;
+
         pCtx->videoCtx.hDevice = exynos_v4l2_open_devname(sDevName, nFlag, 0);
+        if (pCtx->videoCtx.hDevice < 0)
+            pthread_mutex_destroy(&pCtx->osalCtx.batch.lock);
+
         return pCtx->videoCtx.hDevice;
     }
 
@@ -357,6 +448,7 @@ void Codec_OSAL_DevClose(CodecOSALVideoContext *pCtx) {
     if ((pCtx != NULL) &&
         (pCtx->videoCtx.hDevice >= 0)) {
         exynos_v4l2_close(pCtx->videoCtx.hDevice);
+        pthread_mutex_destroy(&pCtx->osalCtx.batch.lock);
     }
 
     return;
@@ -384,6 +476,9 @@ int Codec_OSAL_EnqueueBuf(
         struct v4l2_plane   planes[VIDEO_BUFFER_MAX_PLANES];
         int i;
 
+        /* ex) frame tag should be set before the buffer */
+        Codec_OSAL_FlushControls(pCtx);
+
         memset(&buf, 0, sizeof(buf));
         memset(&planes, 0, sizeof(planes));
 
@@ -726,6 +821,8 @@ int Codec_OSAL_GetControls(
         goto EXIT;
     }
 
+    Codec_OSAL_FlushControls(pCtx);
+
     switch (nCID) {
     case CODEC_OSAL_CID_DEC_SEI_INFO:
         ret = Codec_OSAL_GetControls_SeiInfo(pCtx, pInfo);
@@ -2202,6 +2299,8 @@ int Codec_OSAL_SetControls(
         goto EXIT;
     }
 
+    Codec_OSAL_FlushControls(pCtx);
+
     switch (nCID) {
     case CODEC_OSAL_CID_ENC_SET_PARAMS:
         ret = Codec_OSAL_SetControls_EncParams(pCtx, pInfo);
@@ -2237,6 +2336,8 @@ int Codec_OSAL_GetControl(
     if ((pCtx != NULL) &&
         (pValue != NULL) &&
         (pCtx->videoCtx.hDevice >= 0)) {
+        Codec_OSAL_FlushControls(pCtx);
+
         return exynos_v4l2_g_ctrl(pCtx->videoCtx.hDevice, uCID, pValue);
     }
 
@@ -2249,12 +2350,87 @@ int Codec_OSAL_SetControl(
     unsigned long           nValue) {
     if ((pCtx != NULL) &&
         (pCtx->videoCtx.hDevice >= 0)) {
+        /* it will be set on closing the batch */
+        if (Codec_OSAL_AppendControl(pCtx, uCID, nValue) == 0)
+            return 0;
+
         return exynos_v4l2_s_ctrl(pCtx->videoCtx.hDevice, uCID, nValue);
     }
 
     return -1;
 }
 
+/*
+ * opens a batch of controls.
+ * Codec_OSAL_SetControl() of the calling thread is not set to the device,
+ * but accumulated until Codec_OSAL_EndControls() to be set by an ioctl(S_EXT_CTRLS).
+ * controls of the other threads are set immediately as before.
+ */
+int Codec_OSAL_BeginControls(CodecOSALVideoContext *pCtx) {
+    CodecOSAL_CtrlBatch *pBatch = NULL;
+
+    if ((pCtx == NULL) ||
+        (pCtx->videoCtx.hDevice < 0)) {
+        return -1;
+    }
+
+    pBatch = &pCtx->osalCtx.batch;
+
+    pthread_mutex_lock(&pBatch->lock);
+
+    if (pBatch->bOpened == 1) {
+        pthread_mutex_unlock(&pBatch->lock);
+        ALOGE("[%s] batch is already opened", __FUNCTION__);
+        return -1;
+    }
+
+    pBatch->bOpened = 1;
+    pBatch->owner   = pthread_self();
+    pBatch->nCtrl   = 0;
+    pBatch->nFailed = 0;
+
+    pthread_mutex_unlock(&pBatch->lock);
+
+    return 0;
+}
+
+/*
+ * sets controls accumulated and closes the batch.
+ * if the device rejects them at once, they are set one by one and failures are reported per control.
+ * returns number of controls failed.
+ */
+int Codec_OSAL_EndControls(CodecOSALVideoContext *pCtx) {
+    CodecOSAL_CtrlBatch *pBatch = NULL;
+    int ret = 0;
+
+    if ((pCtx == NULL) ||
+        (pCtx->videoCtx.hDevice < 0)) {
+        return -1;
+    }
+
+    pBatch = &pCtx->osalCtx.batch;
+
+    pthread_mutex_lock(&pBatch->lock);
+
+    if ((pBatch->bOpened != 1) ||
+        (!pthread_equal(pBatch->owner, pthread_self()))) {
+        pthread_mutex_unlock(&pBatch->lock);
+        ALOGE("[%s] batch is not opened by this thread", __FUNCTION__);
+        return -1;
+    }
+
+    Codec_OSAL_SubmitControls(pCtx);
+
+    ret = pBatch->nFailed;
+
+    pBatch->bOpened = 0;
+    pBatch->nFailed = 0;
+
+    pthread_mutex_unlock(&pBatch->lock);
+
+    return ret;
+}
+
 int Codec_OSAL_GetCrop(
     CodecOSALVideoContext   *pCtx,
     CodecOSAL_Crop          *pCrop) {
@@ -2482,12 +2658,22 @@ int Codec_OSAL_Poll(
         pollfds[i].fd       = pollfd[i].fd;
         pollfds[i].events   = pollfd[i].events;
         pollfds[i].revents  = 0;
+#ifdef USE_CODEC_OSAL_MOCK
+        if (Codec_OSAL_Mock_IsDevice(pollfd[i].fd)) {
+            pollfds[i].fd       = Codec_OSAL_Mock_GetPollFd(pollfd[i].fd, pollfd[i].events);
+            pollfds[i].events   = Codec_OSAL_Mock_GetPollEvents(pollfd[i].events);
+        }
+#endif
     }
 
     ret = poll((struct pollfd *)pollfds, cnt, time);
 
     for (i = 0; i < cnt; i++) {
         pollfd[i].revents = pollfds[i].revents;
+#ifdef USE_CODEC_OSAL_MOCK
+        if (pollfds[i].fd != pollfd[i].fd)
+            pollfd[i].revents = Codec_OSAL_Mock_TranslateEvents(pollfd[i].events, pollfds[i].revents);
+#endif
     }
 
     return ret;
@@ -2542,12 +2728,20 @@ int Codec_OSAL_Epoll_Regist(
 
     for (i = 0; i < cnt; i++) {
         struct epoll_event event;
+        int fd = pollfd[i].fd;
 
         memset(&event, 0, sizeof(event));
         event.data.fd = pollfd[i].fd;
         event.events  = pollfd[i].events;
 
-        err = epoll_ctl(pEpoll->epfd, EPOLL_CTL_ADD, pollfd[i].fd, &event);
+#ifdef USE_CODEC_OSAL_MOCK
+        if (Codec_OSAL_Mock_IsDevice(pollfd[i].fd)) {
+            fd           = Codec_OSAL_Mock_GetPollFd(pollfd[i].fd, pollfd[i].events);
+            event.events = Codec_OSAL_Mock_GetPollEvents(pollfd[i].events);
+        }
+#endif
+
+        err = epoll_ctl(pEpoll->epfd, EPOLL_CTL_ADD, fd, &event);
         if (err < 0) {
             ALOGE("[%s] epoll_ctl(EPOLL_CTL_ADD) is failed: err(0x%x)", __FUNCTION__, err);
             break;
@@ -2589,6 +2783,18 @@ int Codec_OSAL_Epoll(
         for (i = 0; i < cnt; i++) {
             pollfd[i].fd        = events[i].data.fd;
             pollfd[i].revents   = events[i].events;
+#ifdef USE_CODEC_OSAL_MOCK
+            if (Codec_OSAL_Mock_IsDevice(events[i].data.fd)) {
+                int j;
+
+                for (j = 0; j < pEpoll->cnt; j++) {
+                    if (pEpoll->pollfds[j].fd == events[i].data.fd) {
+                        pollfd[i].revents = Codec_OSAL_Mock_TranslateEvents(pEpoll->pollfds[j].events, events[i].events);
+                        break;
+                    }
+                }
+            }
+#endif
         }
     }
 
@@ -2612,12 +2818,18 @@ void Codec_OSAL_Epoll_Destroy(void *pHandle) {
 
     for (i = 0; i < pEpoll->cnt; i++) {
         struct epoll_event event;
+        int fd = pEpoll->pollfds[i].fd;
 
         memset(&event, 0, sizeof(event));
         event.data.fd = pEpoll->pollfds[i].fd;
         event.events  = pEpoll->pollfds[i].events;
 
-        err = epoll_ctl(pEpoll->epfd, EPOLL_CTL_DEL, pEpoll->pollfds[i].fd, &event);
+#ifdef USE_CODEC_OSAL_MOCK
+        if (Codec_OSAL_Mock_IsDevice(pEpoll->pollfds[i].fd))
+            fd = Codec_OSAL_Mock_GetPollFd(pEpoll->pollfds[i].fd, pEpoll->pollfds[i].events);
+#endif
+
+        err = epoll_ctl(pEpoll->epfd, EPOLL_CTL_DEL, fd, &event);
         if (err < 0) {
             ALOGE("[%s] epoll_ctl(EPOLL_CTL_DEL) is failed: err(0x%x)", __FUNCTION__, err);
             continue;
@@ -0,0 +1,1022 @@
+/*
+ *
+ * Copyright 2016 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * @file    ExynosVideo_OSAL_Mock.c
+ * @brief   ExynosVideo OSAL mock device
+ * @version    1.0.0
+ */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/eventfd.h>
+
+#define CODEC_OSAL_MOCK_IMPL
+#include "ExynosVideo_OSAL.h"
+#include "ExynosVideo_OSAL_Mock.h"
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "ExynosVideoOSALMock"
+
+#include "ExynosVideo_OSAL_Log.h"
+
+#define MOCK_ENV_NAME       "EXYNOS_VIDEO_MOCK"
+#define MOCK_MAX_DEVICE     16
+#define MOCK_MAX_BUFFER     32
+#define MOCK_MAX_PLANE      VIDEO_MAX_PLANES
+#define MOCK_MAX_CTRL       64
+#define MOCK_MAX_CTRL_LOG   256
+
+#define MOCK_ALIGN(x, a)    (((x) + (a) - 1) & ~((a) - 1))
+
+#define MOCK_SRC_PORT       0
+#define MOCK_DST_PORT       1
+
+/* values of CODEC_OSAL_CID_DEC_DISPLAY_STATUS */
+#define MOCK_STATUS_DECODING_ONLY   0
+#define MOCK_STATUS_DISPLAY         1
+#define MOCK_STATUS_FINISHED        3
+
+typedef struct _MockConfig {
+    int width;
+    int height;
+    int dpb;
+    int reorder;
+    int delay;      /* us */
+    int qlat;       /* us */
+    int resChange;  /* frames */
+    unsigned int failCtrl;
+} MockConfig;
+
+typedef struct _MockBuffer {
+    int             index;
+    int             nPlane;
+    unsigned int    bytesused[MOCK_MAX_PLANE];
+    struct timeval  timestamp;
+    unsigned int    reserved2;
+    unsigned int    flags;
+    int             tag;
+    int             status;
+} MockBuffer;
+
+typedef struct _MockQueue {
+    MockBuffer  buf[MOCK_MAX_BUFFER];
+    int         head;
+    int         cnt;
+} MockQueue;
+
+typedef struct _MockPort {
+    struct v4l2_format  fmt;
+    int                 memory;
+    int                 nBuffer;
+    bool                bStreaming;
+    MockQueue           queued;     /* owned by device */
+    MockQueue           done;       /* ready to be dequeued */
+    int                 hEvent;     /* counts done buffers */
+} MockPort;
+
+typedef struct _MockDevice {
+    bool            bUsed;
+    bool            bEncoder;
+    int             hDevice;
+
+    pthread_t       thread;
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    bool            bExit;
+
+    MockConfig      config;
+    MockPort        port[2];
+    MockQueue       dpb;    /* decoded, waiting for being displayed */
+
+    struct {
+        unsigned int id;
+        int          value;
+    } ctrls[MOCK_MAX_CTRL];
+    int             nCtrl;
+
+    /* how controls are set */
+    int             nSetCtrlCall;
+    int             nSetExtCtrlCall;
+    unsigned int    ctrlLog[MOCK_MAX_CTRL_LOG];
+    int             nCtrlLog;
+
+    int             width;
+    int             height;
+    int             nFrame;
+    int             nTag;           /* set for the next source */
+    int             nCurTag;        /* tag of the last dequeued destination */
+    int             displayStatus;  /* status of the last dequeued destination */
+    int             checkState;
+    bool            bResChanged;
+} MockDevice;
+
+static MockDevice       gMockDevices[MOCK_MAX_DEVICE];
+static pthread_mutex_t  gMockLock = PTHREAD_MUTEX_INITIALIZER;
+
+static bool Mock_GetConfig(MockConfig *pConfig) {
+    const char *env = getenv(MOCK_ENV_NAME);
+    char *str, *token, *save = NULL;
+
+    if (env == NULL)
+        return false;
+
+    pConfig->width      = 1920;
+    pConfig->height     = 1080;
+    pConfig->dpb        = 4;
+    pConfig->reorder    = 0;
+    pConfig->delay      = 0;
+    pConfig->qlat       = 0;
+    pConfig->resChange  = 0;
+    pConfig->failCtrl   = 0;
+
+    str = strdup(env);
+    if (str == NULL)
+        return true;
+
+    for (token = strtok_r(str, ",", &save); token != NULL; token = strtok_r(NULL, ",", &save)) {
+        char *value = strchr(token, '=');
+        if (value == NULL)
+            continue;
+
+        *value++ = '\0';
+
+        if (!strcmp(token, "width"))            pConfig->width      = atoi(value);
+        else if (!strcmp(token, "height"))      pConfig->height     = atoi(value);
+        else if (!strcmp(token, "dpb"))         pConfig->dpb        = atoi(value);
+        else if (!strcmp(token, "reorder"))     pConfig->reorder    = atoi(value);
+        else if (!strcmp(token, "delay"))       pConfig->delay      = atoi(value);
+        else if (!strcmp(token, "qlat"))        pConfig->qlat       = atoi(value);
+        else if (!strcmp(token, "reschange"))   pConfig->resChange  = atoi(value);
+        else if (!strcmp(token, "failctrl"))    pConfig->failCtrl   = (unsigned int)strtoul(value, NULL, 0);
+        else ALOGW("[%s] unknown key(%s)", __FUNCTION__, token);
+    }
+
+    free(str);
+
+    return true;
+}
+
+static MockDevice *Mock_Find(int fd) {
+    MockDevice *pDev = NULL;
+    int i;
+
+    if (fd < 0)
+        return NULL;
+
+    pthread_mutex_lock(&gMockLock);
+    for (i = 0; i < MOCK_MAX_DEVICE; i++) {
+        if ((gMockDevices[i].bUsed == true) &&
+            (gMockDevices[i].hDevice == fd)) {
+            pDev = &gMockDevices[i];
+            break;
+        }
+    }
+    pthread_mutex_unlock(&gMockLock);
+
+    return pDev;
+}
+
+static int Mock_PortIndex(int type) {
+    return (type == CODEC_OSAL_BUF_TYPE_SRC)? MOCK_SRC_PORT:MOCK_DST_PORT;
+}
+
+static void Mock_Push(MockQueue *pQueue, MockBuffer *pBuf) {
+    if (pQueue->cnt >= MOCK_MAX_BUFFER)
+        return;
+
+    pQueue->buf[(pQueue->head + pQueue->cnt) % MOCK_MAX_BUFFER] = *pBuf;
+    pQueue->cnt++;
+}
+
+static void Mock_PushFront(MockQueue *pQueue, MockBuffer *pBuf) {
+    if (pQueue->cnt >= MOCK_MAX_BUFFER)
+        return;
+
+    pQueue->head = (pQueue->head + MOCK_MAX_BUFFER - 1) % MOCK_MAX_BUFFER;
+    pQueue->buf[pQueue->head] = *pBuf;
+    pQueue->cnt++;
+}
+
+static bool Mock_Pop(MockQueue *pQueue, MockBuffer *pBuf) {
+    if (pQueue->cnt <= 0)
+        return false;
+
+    *pBuf = pQueue->buf[pQueue->head];
+    pQueue->head = (pQueue->head + 1) % MOCK_MAX_BUFFER;
+    pQueue->cnt--;
+
+    return true;
+}
+
+static void Mock_Done(MockPort *pPort, MockBuffer *pBuf) {
+    uint64_t val = 1;
+
+    Mock_Push(&pPort->done, pBuf);
+
+    if (write(pPort->hEvent, &val, sizeof(val)) != sizeof(val))
+        ALOGE("[%s] failed to signal", __FUNCTION__);
+}
+
+static void Mock_ClearPort(MockPort *pPort) {
+    uint64_t val;
+
+    memset(&pPort->queued, 0, sizeof(pPort->queued));
+    memset(&pPort->done, 0, sizeof(pPort->done));
+
+    while (read(pPort->hEvent, &val, sizeof(val)) == sizeof(val)) {}
+}
+
+static void Mock_GetPlaneSize(MockDevice *pDev, unsigned int size[MOCK_MAX_PLANE], int *pPlane) {
+    struct v4l2_pix_format_mplane *pFmt = &pDev->port[MOCK_DST_PORT].fmt.fmt.pix_mp;
+    int i;
+
+    if ((pDev->bEncoder == true) ||
+        (pFmt->num_planes == 0)) {
+        /* size configured by user */
+        *pPlane = (pFmt->num_planes > 0)? pFmt->num_planes:1;
+        for (i = 0; i < *pPlane; i++)
+            size[i] = pFmt->plane_fmt[i].sizeimage;
+
+        return;
+    }
+
+    *pPlane = pFmt->num_planes;
+    size[0] = MOCK_ALIGN(pDev->width, 16) * MOCK_ALIGN(pDev->height, 16);
+    size[1] = size[0] / 2;
+    if (*pPlane == 1) {
+        size[0] += size[1];
+    } else if (*pPlane == 3) {
+        size[1] = size[0] / 4;
+        size[2] = size[0] / 4;
+    }
+}
+
+static void Mock_Display(MockDevice *pDev, bool bAll) {
+    MockBuffer frame;
+
+    while ((pDev->dpb.cnt > (bAll? 0:pDev->config.reorder)) &&
+           (Mock_Pop(&pDev->dpb, &frame) == true)) {
+        frame.status = MOCK_STATUS_DISPLAY;
+        Mock_Done(&pDev->port[MOCK_DST_PORT], &frame);
+    }
+}
+
+static bool Mock_IsRunnable(MockDevice *pDev) {
+    MockPort *pSrc = &pDev->port[MOCK_SRC_PORT];
+    MockPort *pDst = &pDev->port[MOCK_DST_PORT];
+
+    if ((pSrc->bStreaming == false) ||
+        (pSrc->queued.cnt == 0) ||
+        (pDev->bResChanged == true))
+        return false;
+
+    /* header parsing on decoder doesn't need any destination */
+    if ((pDev->bEncoder == false) &&
+        (pDst->bStreaming == false))
+        return true;
+
+    return ((pDst->bStreaming == true) && (pDst->queued.cnt > 0));
+}
+
+static void Mock_Process(MockDevice *pDev, MockBuffer *pSrcBuf) {
+    MockPort   *pSrc = &pDev->port[MOCK_SRC_PORT];
+    MockPort   *pDst = &pDev->port[MOCK_DST_PORT];
+    MockBuffer  dstBuf;
+    unsigned int size[MOCK_MAX_PLANE] = { 0, };
+    bool bEOS = ((pSrcBuf->reserved2 & CODEC_OSAL_FLAG_EOS) || (pSrcBuf->bytesused[0] == 0));
+    int i;
+
+    if ((pDev->bEncoder == false) &&
+        (pDst->bStreaming == false)) {
+        /* header is parsed */
+        Mock_Done(pSrc, pSrcBuf);
+        return;
+    }
+
+    if ((pDev->bEncoder == false) &&
+        (bEOS == false) &&
+        (pDev->config.resChange > 0) &&
+        (pDev->nFrame > 0) &&
+        ((pDev->nFrame % pDev->config.resChange) == 0)) {
+        /* source is kept until destination is reconfigured */
+        Mock_PushFront(&pSrc->queued, pSrcBuf);
+
+        pDev->width  = (pDev->width == pDev->config.width)? (pDev->config.width / 2):pDev->config.width;
+        pDev->height = (pDev->height == pDev->config.height)? (pDev->config.height / 2):pDev->config.height;
+
+        Mock_Display(pDev, true);
+
+        Mock_Pop(&pDst->queued, &dstBuf);
+        memset(dstBuf.bytesused, 0, sizeof(dstBuf.bytesused));
+        dstBuf.status = MOCK_STATUS_FINISHED;
+        Mock_Done(pDst, &dstBuf);
+
+        pDev->checkState  = 1;
+        pDev->bResChanged = true;
+        pDev->nFrame++;
+
+        ALOGV("[%s] resolution is changed to %dx%d", __FUNCTION__, pDev->width, pDev->height);
+        return;
+    }
+
+    Mock_Pop(&pDst->queued, &dstBuf);
+    Mock_GetPlaneSize(pDev, size, &dstBuf.nPlane);
+
+    dstBuf.timestamp = pSrcBuf->timestamp;
+    dstBuf.tag       = pSrcBuf->tag;
+    dstBuf.reserved2 = 0;
+    dstBuf.flags     = ((pDev->nFrame % 30) == 0)? V4L2_BUF_FLAG_KEYFRAME:V4L2_BUF_FLAG_PFRAME;
+
+    if (bEOS == true) {
+        if (pDev->bEncoder == false)
+            Mock_Display(pDev, true);
+
+        memset(dstBuf.bytesused, 0, sizeof(dstBuf.bytesused));
+        dstBuf.reserved2 = CODEC_OSAL_FLAG_EOS;
+        dstBuf.status    = MOCK_STATUS_FINISHED;
+        Mock_Done(pDst, &dstBuf);
+    } else if (pDev->bEncoder == true) {
+        /* bitstream : about 1/10 of capacity */
+        dstBuf.bytesused[0] = (size[0] / 10 > 0)? (size[0] / 10):1;
+        dstBuf.status       = MOCK_STATUS_DISPLAY;
+        Mock_Done(pDst, &dstBuf);
+    } else {
+        for (i = 0; i < dstBuf.nPlane; i++)
+            dstBuf.bytesused[i] = size[i];
+
+        Mock_Push(&pDev->dpb, &dstBuf);
+        Mock_Display(pDev, false);
+    }
+
+    pDev->nFrame++;
+
+    Mock_Done(pSrc, pSrcBuf);
+}
+
+static void *Mock_Thread(void *pParam) {
+    MockDevice *pDev = (MockDevice *)pParam;
+    MockBuffer  srcBuf;
+
+    pthread_mutex_lock(&pDev->lock);
+
+    while (pDev->bExit == false) {
+        if (Mock_IsRunnable(pDev) == false) {
+            pthread_cond_wait(&pDev->cond, &pDev->lock);
+            continue;
+        }
+
+        if (pDev->config.delay > 0) {
+            /* H/W processing time */
+            pthread_mutex_unlock(&pDev->lock);
+            usleep(pDev->config.delay);
+            pthread_mutex_lock(&pDev->lock);
+
+            if (Mock_IsRunnable(pDev) == false)
+                continue;
+        }
+
+        Mock_Pop(&pDev->port[MOCK_SRC_PORT].queued, &srcBuf);
+        Mock_Process(pDev, &srcBuf);
+    }
+
+    pthread_mutex_unlock(&pDev->lock);
+
+    return NULL;
+}
+
+int Codec_OSAL_Mock_Open(const char *devname, int oflag, ...) {
+    MockConfig  config;
+    MockDevice *pDev = NULL;
+    int hDevice = -1;
+    int ret, err;
+    int i;
+
+    if (Mock_GetConfig(&config) == false)
+        return exynos_v4l2_open_devname(devname, oflag, 0);
+
+    pthread_mutex_lock(&gMockLock);
+    for (i = 0; i < MOCK_MAX_DEVICE; i++) {
+        if (gMockDevices[i].bUsed == false) {
+            pDev = &gMockDevices[i];
+            memset(pDev, 0, sizeof(*pDev));
+            pDev->bUsed   = true;
+            pDev->hDevice = -1;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&gMockLock);
+
+    if (pDev == NULL) {
+        ALOGE("[%s] no more mock device", __FUNCTION__);
+        errno = EBUSY;
+        return -1;
+    }
+
+    pDev->config    = config;
+    pDev->bEncoder  = (strstr(devname, "enc") != NULL)? true:false;
+    pDev->width     = config.width;
+    pDev->height    = config.height;
+    pDev->nTag      = -1;
+    pDev->nCurTag   = -1;
+
+    pDev->port[MOCK_SRC_PORT].hEvent = eventfd(0, EFD_SEMAPHORE | EFD_NONBLOCK | EFD_CLOEXEC);
+    pDev->port[MOCK_DST_PORT].hEvent = eventfd(0, EFD_SEMAPHORE | EFD_NONBLOCK | EFD_CLOEXEC);
+    hDevice = eventfd(0, EFD_CLOEXEC);  /* the identity of device */
+
+    if ((pDev->port[MOCK_SRC_PORT].hEvent < 0) ||
+        (pDev->port[MOCK_DST_PORT].hEvent < 0) ||
+        (hDevice < 0)) {
+        ALOGE("[%s] failed to create eventfd(%d)", __FUNCTION__, errno);
+        goto EXIT;
+    }
+
+    pthread_mutex_init(&pDev->lock, NULL);
+    pthread_cond_init(&pDev->cond, NULL);
+
+    ret = pthread_create(&pDev->thread, NULL, Mock_Thread, pDev);
+    if (ret != 0) {
+        ALOGE("[%s] failed to create thread(%d)", __FUNCTION__, ret);
+        pthread_cond_destroy(&pDev->cond);
+        pthread_mutex_destroy(&pDev->lock);
+        errno = ret;
+        goto EXIT;
+    }
+
+    /* it is published at last to be found */
+    pthread_mutex_lock(&gMockLock);
+    pDev->hDevice = hDevice;
+    pthread_mutex_unlock(&gMockLock);
+
+    ALOGI("[%s] %s is opened as mock(%d) : %dx%d, dpb(%d), delay(%d us)", __FUNCTION__,
+            devname, pDev->hDevice, config.width, config.height, config.dpb, config.delay);
+
+    return pDev->hDevice;
+
+EXIT:
+    err = errno;
+
+    if (pDev->port[MOCK_SRC_PORT].hEvent >= 0)
+        close(pDev->port[MOCK_SRC_PORT].hEvent);
+    if (pDev->port[MOCK_DST_PORT].hEvent >= 0)
+        close(pDev->port[MOCK_DST_PORT].hEvent);
+    if (hDevice >= 0)
+        close(hDevice);
+
+    /* release the slot */
+    pthread_mutex_lock(&gMockLock);
+    pDev->bUsed = false;
+    pthread_mutex_unlock(&gMockLock);
+
+    errno = err;
+    return -1;
+}
+
+int Codec_OSAL_Mock_Close(int fd) {
+    MockDevice *pDev = Mock_Find(fd);
+
+    if (pDev == NULL)
+        return exynos_v4l2_close(fd);
+
+    pthread_mutex_lock(&pDev->lock);
+    pDev->bExit = true;
+    pthread_cond_signal(&pDev->cond);
+    pthread_mutex_unlock(&pDev->lock);
+
+    pthread_join(pDev->thread, NULL);
+
+    pthread_cond_destroy(&pDev->cond);
+    pthread_mutex_destroy(&pDev->lock);
+
+    close(pDev->port[MOCK_SRC_PORT].hEvent);
+    close(pDev->port[MOCK_DST_PORT].hEvent);
+    close(pDev->hDevice);
+
+    pthread_mutex_lock(&gMockLock);
+    pDev->bUsed   = false;
+    pDev->hDevice = -1;
+    pthread_mutex_unlock(&gMockLock);
+
+    return 0;
+}
+
+bool Codec_OSAL_Mock_QueryCap(int fd, unsigned int need_caps) {
+    if (Mock_Find(fd) == NULL)
+        return exynos_v4l2_querycap(fd, need_caps);
+
+    return true;
+}
+
+int Codec_OSAL_Mock_QBuf(int fd, struct v4l2_buffer *buf) {
+    MockDevice *pDev = Mock_Find(fd);
+    MockPort   *pPort;
+    MockBuffer  mockBuf;
+    int i;
+
+    if (pDev == NULL)
+        return exynos_v4l2_qbuf(fd, buf);
+
+    if (pDev->config.qlat > 0)
+        usleep(pDev->config.qlat);
+
+    pthread_mutex_lock(&pDev->lock);
+
+    pPort = &pDev->port[Mock_PortIndex(buf->type)];
+    if ((int)buf->index >= pPort->nBuffer) {
+        pthread_mutex_unlock(&pDev->lock);
+        errno = EINVAL;
+        return -1;
+    }
+
+    memset(&mockBuf, 0, sizeof(mockBuf));
+    mockBuf.index     = buf->index;
+    mockBuf.nPlane    = (buf->length < MOCK_MAX_PLANE)? buf->length:MOCK_MAX_PLANE;
+    mockBuf.timestamp = buf->timestamp;
+    mockBuf.reserved2 = buf->reserved2;
+    mockBuf.tag       = -1;
+
+    for (i = 0; i < mockBuf.nPlane; i++)
+        mockBuf.bytesused[i] = buf->m.planes[i].bytesused;
+
+    if (buf->type == CODEC_OSAL_BUF_TYPE_SRC) {
+        mockBuf.tag = pDev->nTag;
+    }
+
+    Mock_Push(&pPort->queued, &mockBuf);
+
+    pthread_cond_signal(&pDev->cond);
+    pthread_mutex_unlock(&pDev->lock);
+
+    return 0;
+}
+
+int Codec_OSAL_Mock_DQBuf(int fd, struct v4l2_buffer *buf) {
+    MockDevice *pDev = Mock_Find(fd);
+    MockPort   *pPort;
+    MockBuffer  mockBuf;
+    uint64_t    val;
+    int i;
+
+    if (pDev == NULL)
+        return exynos_v4l2_dqbuf(fd, buf);
+
+    if (pDev->config.qlat > 0)
+        usleep(pDev->config.qlat);
+
+    pthread_mutex_lock(&pDev->lock);
+
+    pPort = &pDev->port[Mock_PortIndex(buf->type)];
+    if (Mock_Pop(&pPort->done, &mockBuf) == false) {
+        pthread_mutex_unlock(&pDev->lock);
+        errno = EAGAIN;
+        return -1;
+    }
+
+    if (read(pPort->hEvent, &val, sizeof(val)) != sizeof(val))
+        ALOGE("[%s] failed to consume a signal", __FUNCTION__);
+
+    buf->index      = mockBuf.index;
+    buf->timestamp  = mockBuf.timestamp;
+    buf->reserved2  = mockBuf.reserved2;
+    buf->flags      = mockBuf.flags;
+    buf->field      = V4L2_FIELD_NONE;
+
+    for (i = 0; (i < (int)buf->length) && (i < MOCK_MAX_PLANE); i++)
+        buf->m.planes[i].bytesused = mockBuf.bytesused[i];
+
+    if (buf->type == CODEC_OSAL_BUF_TYPE_DST) {
+        pDev->nCurTag       = mockBuf.tag;
+        pDev->displayStatus = mockBuf.status;
+    }
+
+    pthread_mutex_unlock(&pDev->lock);
+
+    return 0;
+}
+
+int Codec_OSAL_Mock_GetCtrl(int fd, unsigned int id, int *value) {
+    MockDevice *pDev = Mock_Find(fd);
+    int i;
+
+    if (pDev == NULL)
+        return exynos_v4l2_g_ctrl(fd, id, value);
+
+    pthread_mutex_lock(&pDev->lock);
+
+    switch (id) {
+    case CODEC_OSAL_CID_VIDEO_GET_VERSION_INFO:
+        /* default version will be used */
+        pthread_mutex_unlock(&pDev->lock);
+        return -1;
+    case CODEC_OSAL_CID_DEC_NUM_MIN_BUFFERS:
+        *value = pDev->config.dpb;
+        break;
+    case CODEC_OSAL_CID_DEC_GET_DISPLAY_DELAY:
+        *value = pDev->config.reorder;
+        break;
+    case CODEC_OSAL_CID_DEC_DISPLAY_STATUS:
+        *value = pDev->displayStatus;
+        break;
+    case CODEC_OSAL_CID_DEC_CHECK_STATE:
+        *value = pDev->checkState;
+        break;
+    case CODEC_OSAL_CID_VIDEO_FRAME_TAG:
+        *value = pDev->nCurTag;
+        break;
+    default:
+        *value = 0;
+        for (i = 0; i < pDev->nCtrl; i++) {
+            if (pDev->ctrls[i].id == id) {
+                *value = pDev->ctrls[i].value;
+                break;
+            }
+        }
+        break;
+    }
+
+    pthread_mutex_unlock(&pDev->lock);
+
+    return 0;
+}
+
+/* lock should be held */
+static void Mock_SetCtrl(MockDevice *pDev, unsigned int id, int value) {
+    int i;
+
+    if (id == CODEC_OSAL_CID_VIDEO_FRAME_TAG)
+        pDev->nTag = value;
+
+    for (i = 0; i < pDev->nCtrl; i++) {
+        if (pDev->ctrls[i].id == id)
+            break;
+    }
+
+    if (i < MOCK_MAX_CTRL) {
+        pDev->ctrls[i].id    = id;
+        pDev->ctrls[i].value = value;
+        pDev->nCtrl = (i == pDev->nCtrl)? (pDev->nCtrl + 1):pDev->nCtrl;
+    }
+
+    if (pDev->nCtrlLog < MOCK_MAX_CTRL_LOG)
+        pDev->ctrlLog[pDev->nCtrlLog++] = id;
+}
+
+int Codec_OSAL_Mock_SetCtrl(int fd, unsigned int id, int value) {
+    MockDevice *pDev = Mock_Find(fd);
+
+    if (pDev == NULL)
+        return exynos_v4l2_s_ctrl(fd, id, value);
+
+    pthread_mutex_lock(&pDev->lock);
+
+    pDev->nSetCtrlCall++;
+
+    if ((pDev->config.failCtrl != 0) &&
+        (pDev->config.failCtrl == id)) {
+        pthread_mutex_unlock(&pDev->lock);
+        errno = EINVAL;
+        return -1;
+    }
+
+    Mock_SetCtrl(pDev, id, value);
+
+    pthread_mutex_unlock(&pDev->lock);
+
+    return 0;
+}
+
+int Codec_OSAL_Mock_GetExtCtrl(int fd, struct v4l2_ext_controls *ctrl) {
+    unsigned int i;
+
+    if (Mock_Find(fd) == NULL)
+        return exynos_v4l2_g_ext_ctrl(fd, ctrl);
+
+    for (i = 0; i < ctrl->count; i++) {
+        int value = 0;
+
+        Codec_OSAL_Mock_GetCtrl(fd, ctrl->controls[i].id, &value);
+        ctrl->controls[i].value = value;
+    }
+
+    return 0;
+}
+
+int Codec_OSAL_Mock_SetExtCtrl(int fd, struct v4l2_ext_controls *ctrl) {
+    MockDevice *pDev = Mock_Find(fd);
+    unsigned int i;
+
+    if (pDev == NULL)
+        return exynos_v4l2_s_ext_ctrl(fd, ctrl);
+
+    pthread_mutex_lock(&pDev->lock);
+
+    pDev->nSetExtCtrlCall++;
+
+    /* nothing is applied if any of them is invalid */
+    for (i = 0; i < ctrl->count; i++) {
+        if ((pDev->config.failCtrl != 0) &&
+            (pDev->config.failCtrl == ctrl->controls[i].id)) {
+            ctrl->error_idx = i;
+            pthread_mutex_unlock(&pDev->lock);
+            errno = EINVAL;
+            return -1;
+        }
+    }
+
+    for (i = 0; i < ctrl->count; i++)
+        Mock_SetCtrl(pDev, ctrl->controls[i].id, ctrl->controls[i].value);
+
+    pthread_mutex_unlock(&pDev->lock);
+
+    return 0;
+}
+
+void Codec_OSAL_Mock_GetCtrlStat(int fd, int *pSetCtrlCall, int *pSetExtCtrlCall) {
+    MockDevice *pDev = Mock_Find(fd);
+
+    if (pDev == NULL)
+        return;
+
+    pthread_mutex_lock(&pDev->lock);
+    if (pSetCtrlCall != NULL)
+        *pSetCtrlCall = pDev->nSetCtrlCall;
+    if (pSetExtCtrlCall != NULL)
+        *pSetExtCtrlCall = pDev->nSetExtCtrlCall;
+    pthread_mutex_unlock(&pDev->lock);
+}
+
+int Codec_OSAL_Mock_GetCtrlLog(int fd, unsigned int *pIds, int nMax) {
+    MockDevice *pDev = Mock_Find(fd);
+    int i, nLog;
+
+    if (pDev == NULL)
+        return 0;
+
+    pthread_mutex_lock(&pDev->lock);
+    nLog = (pDev->nCtrlLog < nMax)? pDev->nCtrlLog:nMax;
+    for (i = 0; i < nLog; i++)
+        pIds[i] = pDev->ctrlLog[i];
+    pthread_mutex_unlock(&pDev->lock);
+
+    return nLog;
+}
+
+void Codec_OSAL_Mock_ResetCtrlStat(int fd) {
+    MockDevice *pDev = Mock_Find(fd);
+
+    if (pDev == NULL)
+        return;
+
+    pthread_mutex_lock(&pDev->lock);
+    pDev->nSetCtrlCall    = 0;
+    pDev->nSetExtCtrlCall = 0;
+    pDev->nCtrlLog        = 0;
+    pthread_mutex_unlock(&pDev->lock);
+}
+
+int Codec_OSAL_Mock_GetDevices(int *pFds, int nMax) {
+    int i, nDev = 0;
+
+    pthread_mutex_lock(&gMockLock);
+    for (i = 0; (i < MOCK_MAX_DEVICE) && (nDev < nMax); i++) {
+        if ((gMockDevices[i].bUsed == true) &&
+            (gMockDevices[i].hDevice >= 0))
+            pFds[nDev++] = gMockDevices[i].hDevice;
+    }
+    pthread_mutex_unlock(&gMockLock);
+
+    return nDev;
+}
+
+int Codec_OSAL_Mock_GetCrop(int fd, struct v4l2_crop *crop) {
+    MockDevice *pDev = Mock_Find(fd);
+
+    if (pDev == NULL)
+        return exynos_v4l2_g_crop(fd, crop);
+
+    pthread_mutex_lock(&pDev->lock);
+    crop->c.left   = 0;
+    crop->c.top    = 0;
+    crop->c.width  = pDev->width;
+    crop->c.height = pDev->height;
+    pthread_mutex_unlock(&pDev->lock);
+
+    return 0;
+}
+
+int Codec_OSAL_Mock_SetCrop(int fd, struct v4l2_crop *crop) {
+    if (Mock_Find(fd) == NULL)
+        return exynos_v4l2_s_crop(fd, crop);
+
+    return 0;
+}
+
+int Codec_OSAL_Mock_GetFmt(int fd, struct v4l2_format *fmt) {
+    MockDevice *pDev = Mock_Find(fd);
+    unsigned int size[MOCK_MAX_PLANE] = { 0, };
+    unsigned int type;
+    int nPlane = 0;
+    int i;
+
+    if (pDev == NULL)
+        return exynos_v4l2_g_fmt(fd, fmt);
+
+    pthread_mutex_lock(&pDev->lock);
+
+    type = fmt->type;
+    *fmt = pDev->port[Mock_PortIndex(type)].fmt;
+    fmt->type = type;
+
+    if ((pDev->bEncoder == false) &&
+        (fmt->type == CODEC_OSAL_BUF_TYPE_DST)) {
+        /* decoded resolution */
+        if (fmt->fmt.pix_mp.num_planes == 0) {
+            fmt->fmt.pix_mp.pixelformat = V4L2_PIX_FMT_NV12M;
+            fmt->fmt.pix_mp.num_planes  = 2;
+            pDev->port[MOCK_DST_PORT].fmt.fmt.pix_mp.num_planes = 2;
+        }
+
+        Mock_GetPlaneSize(pDev, size, &nPlane);
+
+        fmt->fmt.pix_mp.width  = pDev->width;
+        fmt->fmt.pix_mp.height = pDev->height;
+        for (i = 0; i < nPlane; i++) {
+            fmt->fmt.pix_mp.plane_fmt[i].bytesperline = MOCK_ALIGN(pDev->width, 16);
+            fmt->fmt.pix_mp.plane_fmt[i].sizeimage    = size[i];
+        }
+    }
+
+    pthread_mutex_unlock(&pDev->lock);
+
+    return 0;
+}
+
+int Codec_OSAL_Mock_SetFmt(int fd, struct v4l2_format *fmt) {
+    MockDevice *pDev = Mock_Find(fd);
+
+    if (pDev == NULL)
+        return exynos_v4l2_s_fmt(fd, fmt);
+
+    pthread_mutex_lock(&pDev->lock);
+
+    pDev->port[Mock_PortIndex(fmt->type)].fmt = *fmt;
+
+    if ((pDev->bEncoder == true) &&
+        (fmt->type == CODEC_OSAL_BUF_TYPE_SRC)) {
+        pDev->width  = fmt->fmt.pix_mp.width;
+        pDev->height = fmt->fmt.pix_mp.height;
+    }
+
+    pthread_mutex_unlock(&pDev->lock);
+
+    return 0;
+}
+
+int Codec_OSAL_Mock_TryFmt(int fd, struct v4l2_format *fmt) {
+    if (Mock_Find(fd) == NULL)
+        return exynos_v4l2_try_fmt(fd, fmt);
+
+    return 0;
+}
+
+int Codec_OSAL_Mock_ReqBufs(int fd, struct v4l2_requestbuffers *req) {
+    MockDevice *pDev = Mock_Find(fd);
+    MockPort   *pPort;
+
+    if (pDev == NULL)
+        return exynos_v4l2_reqbufs(fd, req);
+
+    pthread_mutex_lock(&pDev->lock);
+
+    pPort = &pDev->port[Mock_PortIndex(req->type)];
+
+    if (req->count > MOCK_MAX_BUFFER)
+        req->count = MOCK_MAX_BUFFER;
+
+    pPort->nBuffer = req->count;
+    pPort->memory  = req->memory;
+
+    if (req->count == 0)
+        Mock_ClearPort(pPort);
+
+    pthread_mutex_unlock(&pDev->lock);
+
+    return 0;
+}
+
+int Codec_OSAL_Mock_QueryBuf(int fd, struct v4l2_buffer *buf) {
+    MockDevice *pDev = Mock_Find(fd);
+    struct v4l2_pix_format_mplane *pFmt;
+    unsigned int i;
+
+    if (pDev == NULL)
+        return exynos_v4l2_querybuf(fd, buf);
+
+    pthread_mutex_lock(&pDev->lock);
+
+    pFmt = &pDev->port[Mock_PortIndex(buf->type)].fmt.fmt.pix_mp;
+
+    for (i = 0; (i < buf->length) && (i < MOCK_MAX_PLANE); i++) {
+        buf->m.planes[i].length     = pFmt->plane_fmt[i].sizeimage;
+        buf->m.planes[i].m.mem_offset = 0;
+    }
+
+    pthread_mutex_unlock(&pDev->lock);
+
+    return 0;
+}
+
+int Codec_OSAL_Mock_StreamOn(int fd, enum v4l2_buf_type type) {
+    MockDevice *pDev = Mock_Find(fd);
+
+    if (pDev == NULL)
+        return exynos_v4l2_streamon(fd, type);
+
+    pthread_mutex_lock(&pDev->lock);
+
+    pDev->port[Mock_PortIndex(type)].bStreaming = true;
+
+    if ((int)type == CODEC_OSAL_BUF_TYPE_DST) {
+        /* destination is reconfigured */
+        pDev->checkState  = 0;
+        pDev->bResChanged = false;
+    }
+
+    pthread_cond_signal(&pDev->cond);
+    pthread_mutex_unlock(&pDev->lock);
+
+    return 0;
+}
+
+int Codec_OSAL_Mock_StreamOff(int fd, enum v4l2_buf_type type) {
+    MockDevice *pDev = Mock_Find(fd);
+    MockPort   *pPort;
+
+    if (pDev == NULL)
+        return exynos_v4l2_streamoff(fd, type);
+
+    pthread_mutex_lock(&pDev->lock);
+
+    pPort = &pDev->port[Mock_PortIndex(type)];
+    pPort->bStreaming = false;
+    Mock_ClearPort(pPort);
+
+    if ((int)type == CODEC_OSAL_BUF_TYPE_DST)
+        memset(&pDev->dpb, 0, sizeof(pDev->dpb));
+
+    pthread_cond_signal(&pDev->cond);
+    pthread_mutex_unlock(&pDev->lock);
+
+    return 0;
+}
+
+bool Codec_OSAL_Mock_IsDevice(int fd) {
+    return (Mock_Find(fd) != NULL)? true:false;
+}
+
+int Codec_OSAL_Mock_GetPollFd(int fd, short events) {
+    MockDevice *pDev = Mock_Find(fd);
+
+    if (pDev == NULL)
+        return fd;
+
+    /* POLLOUT : source is done, POLLIN : destination is done */
+    if (events & CODEC_OSAL_POLL_SRC_EVENT)
+        return pDev->port[MOCK_SRC_PORT].hEvent;
+
+    return pDev->port[MOCK_DST_PORT].hEvent;
+}
+
+short Codec_OSAL_Mock_GetPollEvents(short events) {
+    /* eventfd is readable when there is a done buffer */
+    return (CODEC_OSAL_POLL_DST_EVENT | (events & CODEC_OSAL_POLL_ERR_EVENT));
+}
+
+short Codec_OSAL_Mock_TranslateEvents(short events, short revents) {
+    short ret = (revents & CODEC_OSAL_POLL_ERR_EVENT);
+
+    if (revents & CODEC_OSAL_POLL_DST_EVENT)
+        ret |= (events & (CODEC_OSAL_POLL_SRC_EVENT | CODEC_OSAL_POLL_DST_EVENT));
+
+    return ret;
+}
@@ -32,6 +32,7 @@
 #else
 #include <sys/poll.h>
 #endif
+#include <pthread.h>
 
 #include "exynos_v4l2.h"
 #include "videodev2_exynos_media.h"
@@ -245,8 +246,21 @@ typedef struct _CodecOSAL_Pollfd {
     short   revents;
 } CodecOSAL_Pollfd;
 
+/* controls are accumulated while a batch is opened, and set at once on closing */
+#define CODEC_OSAL_MAX_BATCH_CTRL 32
+
+typedef struct _CodecOSAL_CtrlBatch {
+    pthread_mutex_t          lock;
+    pthread_t                owner;     /* only controls of the thread opened are batched */
+    int                      bOpened;
+    unsigned int             ctrlClass;
+    int                      nCtrl;
+    int                      nFailed;   /* accumulated until the batch is closed */
+    struct v4l2_ext_control  ctrls[CODEC_OSAL_MAX_BATCH_CTRL];
+} CodecOSAL_CtrlBatch;
+
 typedef struct _CodecOSALInfo {
-    int reserved;
+    CodecOSAL_CtrlBatch batch;
 } CodecOSALInfo;
 
 typedef struct _CodecOSALVideoContext {
@@ -254,6 +268,10 @@ typedef struct _CodecOSALVideoContext {
     CodecOSALInfo      osalCtx;
 } CodecOSALVideoContext;
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 int Codec_OSAL_VideoMemoryToSystemMemory(ExynosVideoMemoryType eMemoryType);
 
 unsigned int Codec_OSAL_CodingTypeToCompressdFormat(ExynosVideoCodingType eCodingType);
@@ -274,6 +292,9 @@ int Codec_OSAL_SetControls(CodecOSALVideoContext *pCtx, unsigned int nCID, void
 int Codec_OSAL_GetControl(CodecOSALVideoContext *pCtx, unsigned int nCID, int *pValue);
 int Codec_OSAL_SetControl(CodecOSALVideoContext *pCtx, unsigned int nCID, unsigned long nValue);
 
+int Codec_OSAL_BeginControls(CodecOSALVideoContext *pCtx);
+int Codec_OSAL_EndControls(CodecOSALVideoContext *pCtx);
+
 int Codec_OSAL_GetCrop(CodecOSALVideoContext *pCtx, CodecOSAL_Crop *pCrop);
 int Codec_OSAL_SetCrop(CodecOSALVideoContext *pCtx, CodecOSAL_Crop *pCrop);
 
@@ -299,4 +320,8 @@ int   Codec_OSAL_Epoll(void *pHandle, CodecOSAL_Pollfd pollfd[CODEC_OSAL_MAX_POL
 void  Codec_OSAL_Epoll_Destroy(void *pHandle);
 #endif
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif
@@ -0,0 +1,105 @@
+/*
+ *
+ * Copyright 2016 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * @file    ExynosVideo_OSAL_Mock.h
+ * @brief   ExynosVideo OSAL mock device
+ *
+ *          emulates MFC device without H/W, in order to run the codec stack on the host.
+ *          it is built with USE_CODEC_OSAL_MOCK and used only when EXYNOS_VIDEO_MOCK is set
+ *          in the environment, otherwise every call is passed to libexynosv4l2.
+ *
+ *          EXYNOS_VIDEO_MOCK="key=value,..."
+ *            width, height : resolution of the stream (default 1920x1080)
+ *            dpb           : minimum number of DPB (default 4)
+ *            reorder       : number of frames held before being displayed (default 0)
+ *            delay         : processing time of a frame in us (default 0)
+ *            qlat          : latency of ioctl(qbuf/dqbuf) in us (default 0)
+ *            reschange     : resolution is changed every N frames. 0 means never (default 0)
+ *            failctrl      : id of a control which is always rejected. 0 means none (default 0)
+ */
+
+#ifndef _EXYNOS_VIDEO_OSAL_MOCK_H_
+#define _EXYNOS_VIDEO_OSAL_MOCK_H_
+
+#include <stdbool.h>
+
+#include "exynos_v4l2.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int  Codec_OSAL_Mock_Open(const char *devname, int oflag, ...);
+int  Codec_OSAL_Mock_Close(int fd);
+bool Codec_OSAL_Mock_QueryCap(int fd, unsigned int need_caps);
+int  Codec_OSAL_Mock_QBuf(int fd, struct v4l2_buffer *buf);
+int  Codec_OSAL_Mock_DQBuf(int fd, struct v4l2_buffer *buf);
+int  Codec_OSAL_Mock_GetCtrl(int fd, unsigned int id, int *value);
+int  Codec_OSAL_Mock_SetCtrl(int fd, unsigned int id, int value);
+int  Codec_OSAL_Mock_GetExtCtrl(int fd, struct v4l2_ext_controls *ctrl);
+int  Codec_OSAL_Mock_SetExtCtrl(int fd, struct v4l2_ext_controls *ctrl);
+int  Codec_OSAL_Mock_GetCrop(int fd, struct v4l2_crop *crop);
+int  Codec_OSAL_Mock_SetCrop(int fd, struct v4l2_crop *crop);
+int  Codec_OSAL_Mock_GetFmt(int fd, struct v4l2_format *fmt);
+int  Codec_OSAL_Mock_SetFmt(int fd, struct v4l2_format *fmt);
+int  Codec_OSAL_Mock_TryFmt(int fd, struct v4l2_format *fmt);
+int  Codec_OSAL_Mock_ReqBufs(int fd, struct v4l2_requestbuffers *req);
+int  Codec_OSAL_Mock_QueryBuf(int fd, struct v4l2_buffer *buf);
+int  Codec_OSAL_Mock_StreamOn(int fd, enum v4l2_buf_type type);
+int  Codec_OSAL_Mock_StreamOff(int fd, enum v4l2_buf_type type);
+
+/* calls and order of controls set, to check how the stack uses the device */
+void Codec_OSAL_Mock_GetCtrlStat(int fd, int *pSetCtrlCall, int *pSetExtCtrlCall);
+int  Codec_OSAL_Mock_GetCtrlLog(int fd, unsigned int *pIds, int nMax);
+void Codec_OSAL_Mock_ResetCtrlStat(int fd);
+
+/* mock devices opened, to find the one opened by the stack */
+int  Codec_OSAL_Mock_GetDevices(int *pFds, int nMax);
+
+/* mock device is not pollable itself. it has an eventfd per port instead */
+bool  Codec_OSAL_Mock_IsDevice(int fd);
+int   Codec_OSAL_Mock_GetPollFd(int fd, short events);
+short Codec_OSAL_Mock_GetPollEvents(short events);
+short Codec_OSAL_Mock_TranslateEvents(short events, short revents);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifndef CODEC_OSAL_MOCK_IMPL
+#define exynos_v4l2_open_devname    Codec_OSAL_Mock_Open
+#define exynos_v4l2_close           Codec_OSAL_Mock_Close
+#define exynos_v4l2_querycap        Codec_OSAL_Mock_QueryCap
+#define exynos_v4l2_qbuf            Codec_OSAL_Mock_QBuf
+#define exynos_v4l2_dqbuf           Codec_OSAL_Mock_DQBuf
+#define exynos_v4l2_g_ctrl          Codec_OSAL_Mock_GetCtrl
+#define exynos_v4l2_s_ctrl          Codec_OSAL_Mock_SetCtrl
+#define exynos_v4l2_g_ext_ctrl      Codec_OSAL_Mock_GetExtCtrl
+#define exynos_v4l2_s_ext_ctrl      Codec_OSAL_Mock_SetExtCtrl
+#define exynos_v4l2_g_crop          Codec_OSAL_Mock_GetCrop
+#define exynos_v4l2_s_crop          Codec_OSAL_Mock_SetCrop
+#define exynos_v4l2_g_fmt           Codec_OSAL_Mock_GetFmt
+#define exynos_v4l2_s_fmt           Codec_OSAL_Mock_SetFmt
+#define exynos_v4l2_try_fmt         Codec_OSAL_Mock_TryFmt
+#define exynos_v4l2_reqbufs         Codec_OSAL_Mock_ReqBufs
+#define exynos_v4l2_querybuf        Codec_OSAL_Mock_QueryBuf
+#define exynos_v4l2_streamon        Codec_OSAL_Mock_StreamOn
+#define exynos_v4l2_streamoff       Codec_OSAL_Mock_StreamOff
+#endif
+
+#endif
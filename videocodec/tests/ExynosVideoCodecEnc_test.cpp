@@ -0,0 +1,330 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * controls written to the device by the encoder, counted by the mock device.
+ * it runs only on a build with BOARD_USE_CODEC_OSAL_MOCK.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <cutils/properties.h>
+
+#include "exynos_format.h"
+
+#include "ExynosVideoCodecEnc.h"
+#include "ExynosVideo_OSAL.h"
+#include "ExynosVideo_OSAL_Mock.h"
+
+#define TEST_FRAMES      300
+#define TEST_MAX_CTRLS   64
+#define TEST_MAX_DEVICES 4
+#define TEST_SWITCHES    90
+
+using steady_clock = std::chrono::steady_clock;
+
+namespace {
+
+/* to call what a component calls through ExynosVideoCodec */
+class EncoderAccess : public ExynosVideoCodecEnc {
+public:
+    EncoderAccess() : ExynosVideoCodecEnc(ExynosVideoCodecBase::Type::H264) { }
+
+    using ExynosVideoCodecEnc::applyConfig;
+    using ExynosVideoCodecEnc::changeResolution;
+};
+
+/* controls set to the device since the last reset */
+struct CtrlStat {
+    int ioctls = 0;
+    std::vector<unsigned int> ids;
+
+    bool has(unsigned int id) const {
+        return (std::find(ids.begin(), ids.end(), id) != ids.end());
+    }
+};
+
+class ExynosVideoCodecEncTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        setenv("EXYNOS_VIDEO_MOCK", "width=1280,height=720", 1);
+
+        /* it opens the device on constructing */
+        mEncoder = std::make_shared<EncoderAccess>();
+
+        int fds[TEST_MAX_DEVICES];
+        ASSERT_EQ(1, Codec_OSAL_Mock_GetDevices(fds, TEST_MAX_DEVICES));
+        mFd = fds[0];
+
+        ExynosBufferInfo input = makeInput(1280, 720);
+        ASSERT_EQ(EXYNOS_ERROR_NONE, mEncoder->srcSetup(input));
+    }
+
+    void TearDown() override {
+        if (mEncoder.get() != nullptr) {
+            mEncoder->deinit();
+        }
+
+        unsetenv("EXYNOS_VIDEO_MOCK");
+    }
+
+    ExynosBufferInfo makeInput(uint32_t width, uint32_t height) {
+        ExynosBufferInfo info;
+        ExynosBufferInfo::reset(info);
+
+        info.obj                  = std::make_shared<ExynosBuffer>();
+        info.eDataInfo            = DataInfo::SingleData;
+        info.nPlane               = 2;
+        info.stImageInfo.nWidth   = width;
+        info.stImageInfo.nHeight  = height;
+        info.stImageInfo.nStride  = width;
+        info.stImageInfo.nFormat  = HAL_PIXEL_FORMAT_EXYNOS_YCbCr_420_SP_M;
+
+        return info;
+    }
+
+    /* params which a client sends with every frame */
+    ExynosParams makeParams(uint32_t bitrate) {
+        ExynosParams params;
+
+        auto bitrateParam = MakePooledShared<ExynosParam<ParamBitrate>>();
+        bitrateParam->m.bitrate = bitrate;
+        params.addParam(bitrateParam);
+
+        auto framerateParam = MakePooledShared<ExynosParam<ParamFramerate>>();
+        framerateParam->m.framerate = 30;
+        params.addParam(framerateParam);
+
+        auto idrParam = MakePooledShared<ExynosParam<ParamIDRPeriod>>();
+        idrParam->m.period = 60;
+        params.addParam(idrParam);
+
+        return params;
+    }
+
+    CtrlStat applyFrame(uint32_t bitrate) {
+        Codec_OSAL_Mock_ResetCtrlStat(mFd);
+
+        ExynosParams params = makeParams(bitrate);
+        mEncoder->applyConfig(params);
+
+        return takeStat();
+    }
+
+    CtrlStat takeStat() {
+        CtrlStat stat;
+        int setCtrlCall = 0, setExtCtrlCall = 0;
+
+        Codec_OSAL_Mock_GetCtrlStat(mFd, &setCtrlCall, &setExtCtrlCall);
+        stat.ioctls = setCtrlCall + setExtCtrlCall;
+
+        unsigned int ids[TEST_MAX_CTRLS];
+        int cnt = Codec_OSAL_Mock_GetCtrlLog(mFd, ids, TEST_MAX_CTRLS);
+        stat.ids.assign(ids, ids + cnt);
+
+        Codec_OSAL_Mock_ResetCtrlStat(mFd);
+
+        return stat;
+    }
+
+    /* resolutions of adaptive streaming within 720p, switched in turn */
+    void switchResolutions(int switches, int64_t &elapsed, int &ioctls) {
+        static const uint32_t sizes[][2] = { { 640, 360 }, { 960, 540 }, { 1280, 720 } };
+
+        elapsed = 0;
+        ioctls  = 0;
+
+        for (int i = 0; i < switches; i++) {
+            ExynosBufferInfo input = makeInput(sizes[i % 3][0], sizes[i % 3][1]);
+
+            Codec_OSAL_Mock_ResetCtrlStat(mFd);
+
+            auto startTime = steady_clock::now();
+            ASSERT_EQ(EXYNOS_ERROR_NONE, mEncoder->changeResolution(input));
+            elapsed += std::chrono::duration_cast<std::chrono::nanoseconds>(steady_clock::now() - startTime).count();
+
+            ioctls += takeStat().ioctls;
+
+            ASSERT_EQ(sizes[i % 3][0], getWidth()) << "switch " << i;
+        }
+    }
+
+    /* width of the input which the device has */
+    uint32_t getWidth() {
+        struct v4l2_format fmt;
+        memset(&fmt, 0, sizeof(fmt));
+        fmt.type = CODEC_OSAL_BUF_TYPE_SRC;
+
+        Codec_OSAL_Mock_GetFmt(mFd, &fmt);
+
+        return fmt.fmt.pix_mp.width;
+    }
+
+    int getControl(unsigned int id) {
+        int value = -1;
+        Codec_OSAL_Mock_GetCtrl(mFd, id, &value);
+
+        return value;
+    }
+
+    std::shared_ptr<EncoderAccess> mEncoder;
+    int mFd = -1;
+};
+
+/* the same encoder which takes the fast path of DRC */
+class ExynosVideoCodecEncFastDRCTest : public ExynosVideoCodecEncTest {
+protected:
+    void SetUp() override {
+        property_set("vendor.debug.c2.enc.fastdrc.enable", "true");
+
+        ExynosVideoCodecEncTest::SetUp();
+    }
+
+    void TearDown() override {
+        ExynosVideoCodecEncTest::TearDown();
+
+        property_set("vendor.debug.c2.enc.fastdrc.enable", "false");
+    }
+};
+
+}  // namespace
+
+TEST_F(ExynosVideoCodecEncTest, SameConfigsAreNotSetAgain) {
+    /* the first frame sets them at once */
+    CtrlStat first = applyFrame(4000000);
+    EXPECT_EQ(1, first.ioctls);
+    EXPECT_TRUE(first.has(CODEC_OSAL_CID_ENC_BIT_RATE));
+
+    for (int i = 0; i < TEST_FRAMES; i++) {
+        CtrlStat stat = applyFrame(4000000);
+
+        ASSERT_EQ(0, stat.ioctls) << "frame " << i;
+        ASSERT_TRUE(stat.ids.empty()) << "frame " << i;
+    }
+
+    /* only the changed one is set */
+    CtrlStat changed = applyFrame(2000000);
+    EXPECT_EQ(1, changed.ioctls);
+    ASSERT_EQ(1u, changed.ids.size());
+    EXPECT_EQ((unsigned int)CODEC_OSAL_CID_ENC_BIT_RATE, changed.ids[0]);
+
+    EXPECT_EQ(0, applyFrame(2000000).ioctls);
+}
+
+TEST_F(ExynosVideoCodecEncTest, ConfigsAreSetAgainAfterSetup) {
+    CtrlStat first = applyFrame(4000000);
+    EXPECT_EQ(0, applyFrame(4000000).ioctls);
+
+    /* setDefaultConfig() sets the driver to the default, so that the same values must be set again */
+    ExynosBufferInfo input = makeInput(1280, 720);
+    ASSERT_EQ(EXYNOS_ERROR_NONE, mEncoder->srcSetup(input));
+    takeStat();
+
+    CtrlStat again = applyFrame(4000000);
+    EXPECT_EQ(1, again.ioctls);
+    EXPECT_EQ(first.ids, again.ids);
+}
+
+TEST_F(ExynosVideoCodecEncTest, ConfigsAreSetAgainAfterDRC) {
+    CtrlStat first = applyFrame(4000000);
+    EXPECT_EQ(0, applyFrame(4000000).ioctls);
+
+    /* the full path of DRC calls setDefaultConfig() as well */
+    ExynosBufferInfo input = makeInput(640, 480);
+    ASSERT_EQ(EXYNOS_ERROR_NONE, mEncoder->changeResolution(input));
+    takeStat();
+
+    CtrlStat again = applyFrame(4000000);
+    EXPECT_EQ(1, again.ioctls);
+    EXPECT_EQ(first.ids, again.ids);
+
+    EXPECT_EQ(0, applyFrame(4000000).ioctls);
+}
+
+TEST_F(ExynosVideoCodecEncFastDRCTest, ConfigsSurviveSwitchWithinCapacity) {
+    applyFrame(4000000);
+    EXPECT_EQ(0, applyFrame(4000000).ioctls);
+
+    int64_t elapsed = 0;
+    int     ioctls  = 0;
+
+    /* rate control is kept, so that nothing is set again after every switch */
+    for (int i = 0; i < TEST_SWITCHES; i++) {
+        switchResolutions(1, elapsed, ioctls);
+
+        ASSERT_EQ(0, applyFrame(4000000).ioctls) << "switch " << i;
+        ASSERT_EQ(4000000, getControl(CODEC_OSAL_CID_ENC_BIT_RATE)) << "switch " << i;
+    }
+
+    /* a changed one is still set alone */
+    CtrlStat changed = applyFrame(2000000);
+    EXPECT_EQ(1, changed.ioctls);
+    EXPECT_EQ(std::vector<unsigned int>{ CODEC_OSAL_CID_ENC_BIT_RATE }, changed.ids);
+}
+
+TEST_F(ExynosVideoCodecEncFastDRCTest, SwitchOverCapacityTakesFullPath) {
+    CtrlStat first = applyFrame(4000000);
+
+    ExynosBufferInfo input = makeInput(1920, 1080);
+    ASSERT_EQ(EXYNOS_ERROR_NONE, mEncoder->changeResolution(input));
+    takeStat();
+    EXPECT_EQ(1920u, getWidth());
+
+    /* the driver is set to the default as the full path does */
+    CtrlStat again = applyFrame(4000000);
+    EXPECT_EQ(1, again.ioctls);
+    EXPECT_EQ(first.ids, again.ids);
+
+    /* the capacity grows, so that a smaller one takes the fast path again */
+    input = makeInput(1280, 720);
+    ASSERT_EQ(EXYNOS_ERROR_NONE, mEncoder->changeResolution(input));
+    takeStat();
+
+    EXPECT_EQ(0, applyFrame(4000000).ioctls);
+}
+
+TEST_F(ExynosVideoCodecEncFastDRCTest, SwitchLatency) {
+    applyFrame(4000000);
+
+    int64_t fastElapsed = 0, fullElapsed = 0;
+    int     fastIoctls  = 0, fullIoctls  = 0;
+
+    switchResolutions(TEST_SWITCHES, fastElapsed, fastIoctls);
+
+    /* the same encoder without the fast path */
+    mEncoder->deinit();
+    property_set("vendor.debug.c2.enc.fastdrc.enable", "false");
+    ExynosVideoCodecEncTest::SetUp();
+    applyFrame(4000000);
+
+    switchResolutions(TEST_SWITCHES, fullElapsed, fullIoctls);
+
+    RecordProperty("fast_ns_per_switch", std::to_string((double)fastElapsed / TEST_SWITCHES));
+    RecordProperty("full_ns_per_switch", std::to_string((double)fullElapsed / TEST_SWITCHES));
+    RecordProperty("fast_ctrl_ioctls_per_switch", std::to_string((double)fastIoctls / TEST_SWITCHES));
+    RecordProperty("full_ctrl_ioctls_per_switch", std::to_string((double)fullIoctls / TEST_SWITCHES));
+
+    /* time depends on the host, the number of controls written does not */
+    EXPECT_LT(fastIoctls, fullIoctls);
+}
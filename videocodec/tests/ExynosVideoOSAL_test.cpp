@@ -0,0 +1,270 @@
+/*
+ *
+ * Copyright 2018 Samsung Electronics S.LSI Co. LTD
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * batch of controls between Codec_OSAL_BeginControls() and Codec_OSAL_EndControls(),
+ * counted by the mock device.
+ * it runs only on a build with BOARD_USE_CODEC_OSAL_MOCK.
+ */
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ExynosVideo_OSAL.h"
+#include "ExynosVideo_OSAL_Enc.h"
+#include "ExynosVideo_OSAL_Mock.h"
+
+#define TEST_MAX_CTRLS  128
+
+/* controls of the mpeg class which are not used by the other ones */
+#define TEST_CID(i)     (V4L2_CID_MPEG_BASE + 0x1000 + (i))
+
+namespace {
+
+/* controls set to the device since the last reset */
+struct CtrlStat {
+    int setCtrlCall    = 0;
+    int setExtCtrlCall = 0;
+    std::vector<unsigned int> ids;
+};
+
+class ExynosVideoOSALTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        memset(&mCtx, 0, sizeof(mCtx));
+        mCtx.videoCtx.hDevice = -1;
+    }
+
+    void TearDown() override {
+        close();
+    }
+
+    /* config is what EXYNOS_VIDEO_MOCK has, ex) "failctrl=0x990a2f" */
+    void open(const std::string &config) {
+        setenv("EXYNOS_VIDEO_MOCK", config.c_str(), 1);
+
+        memset(&mCtx, 0, sizeof(mCtx));
+        ASSERT_GE(Codec_OSAL_DevOpen(VIDEO_MFC_ENCODER_NAME, O_RDWR, &mCtx), 0);
+
+        unsetenv("EXYNOS_VIDEO_MOCK");
+    }
+
+    void close() {
+        if (mCtx.videoCtx.hDevice >= 0) {
+            Codec_OSAL_DevClose(&mCtx);
+            mCtx.videoCtx.hDevice = -1;
+        }
+    }
+
+    CtrlStat takeStat() {
+        CtrlStat stat;
+
+        Codec_OSAL_Mock_GetCtrlStat(mCtx.videoCtx.hDevice, &stat.setCtrlCall, &stat.setExtCtrlCall);
+
+        unsigned int ids[TEST_MAX_CTRLS];
+        int cnt = Codec_OSAL_Mock_GetCtrlLog(mCtx.videoCtx.hDevice, ids, TEST_MAX_CTRLS);
+        stat.ids.assign(ids, ids + cnt);
+
+        Codec_OSAL_Mock_ResetCtrlStat(mCtx.videoCtx.hDevice);
+
+        return stat;
+    }
+
+    int getControl(unsigned int id) {
+        int value = -1;
+        EXPECT_EQ(0, Codec_OSAL_GetControl(&mCtx, id, &value));
+
+        return value;
+    }
+
+    CodecOSALVideoContext mCtx;
+};
+
+const std::vector<unsigned int> kCtrls = {
+    CODEC_OSAL_CID_ENC_BIT_RATE,
+    CODEC_OSAL_CID_ENC_FRAME_RATE,
+    CODEC_OSAL_CID_ENC_IDR_PERIOD,
+};
+
+}  // namespace
+
+TEST_F(ExynosVideoOSALTest, BatchIsSetAtOnceInOrder) {
+    open("");
+
+    ASSERT_EQ(0, Codec_OSAL_BeginControls(&mCtx));
+
+    for (size_t i = 0; i < kCtrls.size(); i++) {
+        ASSERT_EQ(0, Codec_OSAL_SetControl(&mCtx, kCtrls[i], 100 + i));
+    }
+
+    /* nothing reaches the device until the batch is closed */
+    CtrlStat pending = takeStat();
+    EXPECT_EQ(0, pending.setCtrlCall);
+    EXPECT_EQ(0, pending.setExtCtrlCall);
+
+    EXPECT_EQ(0, Codec_OSAL_EndControls(&mCtx));
+
+    CtrlStat stat = takeStat();
+    EXPECT_EQ(0, stat.setCtrlCall);
+    EXPECT_EQ(1, stat.setExtCtrlCall);
+    EXPECT_EQ(kCtrls, stat.ids);
+
+    for (size_t i = 0; i < kCtrls.size(); i++) {
+        EXPECT_EQ((int)(100 + i), getControl(kCtrls[i]));
+    }
+}
+
+TEST_F(ExynosVideoOSALTest, ControlsOutOfBatchAreSetOneByOne) {
+    open("");
+
+    for (size_t i = 0; i < kCtrls.size(); i++) {
+        ASSERT_EQ(0, Codec_OSAL_SetControl(&mCtx, kCtrls[i], 100 + i));
+    }
+
+    CtrlStat stat = takeStat();
+    EXPECT_EQ((int)kCtrls.size(), stat.setCtrlCall);
+    EXPECT_EQ(0, stat.setExtCtrlCall);
+    EXPECT_EQ(kCtrls, stat.ids);
+
+    /* a closed batch does not take them */
+    ASSERT_EQ(0, Codec_OSAL_BeginControls(&mCtx));
+    EXPECT_EQ(0, Codec_OSAL_EndControls(&mCtx));
+    EXPECT_EQ(-1, Codec_OSAL_EndControls(&mCtx));
+
+    ASSERT_EQ(0, Codec_OSAL_SetControl(&mCtx, kCtrls[0], 1));
+    EXPECT_EQ(1, takeStat().setCtrlCall);
+}
+
+TEST_F(ExynosVideoOSALTest, ClassChangeSubmitsEarlyInOrder) {
+    open("");
+
+    ASSERT_EQ(0, Codec_OSAL_BeginControls(&mCtx));
+
+    ASSERT_EQ(0, Codec_OSAL_SetControl(&mCtx, kCtrls[0], 1));
+    ASSERT_EQ(0, Codec_OSAL_SetControl(&mCtx, V4L2_CID_BRIGHTNESS, 2));  /* user class */
+    ASSERT_EQ(0, Codec_OSAL_SetControl(&mCtx, kCtrls[1], 3));
+
+    /* the former ones are submitted on every change of the class */
+    CtrlStat pending = takeStat();
+    EXPECT_EQ(2, pending.setExtCtrlCall);
+
+    EXPECT_EQ(0, Codec_OSAL_EndControls(&mCtx));
+
+    CtrlStat stat = takeStat();
+    EXPECT_EQ(1, stat.setExtCtrlCall);
+    EXPECT_EQ(0, stat.setCtrlCall);
+
+    std::vector<unsigned int> expected = { kCtrls[0], V4L2_CID_BRIGHTNESS, kCtrls[1] };
+    std::vector<unsigned int> ids = pending.ids;
+    ids.insert(ids.end(), stat.ids.begin(), stat.ids.end());
+    EXPECT_EQ(expected, ids);
+}
+
+TEST_F(ExynosVideoOSALTest, FullBatchIsSplitInOrder) {
+    open("");
+
+    int total = CODEC_OSAL_MAX_BATCH_CTRL + (CODEC_OSAL_MAX_BATCH_CTRL / 4);
+    std::vector<unsigned int> expected;
+
+    ASSERT_EQ(0, Codec_OSAL_BeginControls(&mCtx));
+
+    for (int i = 0; i < total; i++) {
+        ASSERT_EQ(0, Codec_OSAL_SetControl(&mCtx, TEST_CID(i), i));
+        expected.push_back(TEST_CID(i));
+    }
+
+    EXPECT_EQ(0, Codec_OSAL_EndControls(&mCtx));
+
+    CtrlStat stat = takeStat();
+    EXPECT_EQ(2, stat.setExtCtrlCall);
+    EXPECT_EQ(0, stat.setCtrlCall);
+    EXPECT_EQ(expected, stat.ids);
+}
+
+TEST_F(ExynosVideoOSALTest, RejectedBatchFallsBackPerControl) {
+    char config[64];
+    snprintf(config, sizeof(config), "failctrl=0x%x", kCtrls[1]);
+    open(config);
+
+    ASSERT_EQ(0, Codec_OSAL_BeginControls(&mCtx));
+
+    for (size_t i = 0; i < kCtrls.size(); i++) {
+        ASSERT_EQ(0, Codec_OSAL_SetControl(&mCtx, kCtrls[i], 100 + i));
+    }
+
+    /* only the rejected one is reported */
+    EXPECT_EQ(1, Codec_OSAL_EndControls(&mCtx));
+
+    CtrlStat stat = takeStat();
+    EXPECT_EQ(1, stat.setExtCtrlCall);
+    EXPECT_EQ((int)kCtrls.size(), stat.setCtrlCall);
+
+    std::vector<unsigned int> expected = { kCtrls[0], kCtrls[2] };
+    EXPECT_EQ(expected, stat.ids);
+
+    /* the next batch starts with no failure */
+    ASSERT_EQ(0, Codec_OSAL_BeginControls(&mCtx));
+    ASSERT_EQ(0, Codec_OSAL_SetControl(&mCtx, kCtrls[0], 1));
+    EXPECT_EQ(0, Codec_OSAL_EndControls(&mCtx));
+}
+
+TEST_F(ExynosVideoOSALTest, OtherThreadIsNotBatched) {
+    open("");
+
+    ASSERT_EQ(0, Codec_OSAL_BeginControls(&mCtx));
+    ASSERT_EQ(0, Codec_OSAL_SetControl(&mCtx, kCtrls[0], 1));
+
+    std::thread([this]() {
+                    EXPECT_EQ(0, Codec_OSAL_SetControl(&mCtx, kCtrls[1], 2));
+                    EXPECT_EQ(-1, Codec_OSAL_EndControls(&mCtx));
+                }).join();
+
+    CtrlStat pending = takeStat();
+    EXPECT_EQ(1, pending.setCtrlCall);
+    EXPECT_EQ(0, pending.setExtCtrlCall);
+    EXPECT_EQ(std::vector<unsigned int>{ kCtrls[1] }, pending.ids);
+
+    EXPECT_EQ(0, Codec_OSAL_EndControls(&mCtx));
+
+    CtrlStat stat = takeStat();
+    EXPECT_EQ(1, stat.setExtCtrlCall);
+    EXPECT_EQ(std::vector<unsigned int>{ kCtrls[0] }, stat.ids);
+}
+
+TEST_F(ExynosVideoOSALTest, ReadFlushesPendingControls) {
+    open("");
+
+    ASSERT_EQ(0, Codec_OSAL_BeginControls(&mCtx));
+    ASSERT_EQ(0, Codec_OSAL_SetControl(&mCtx, kCtrls[0], 7));
+
+    /* the owner reads what it has set */
+    EXPECT_EQ(7, getControl(kCtrls[0]));
+    EXPECT_EQ(1, takeStat().setExtCtrlCall);
+
+    ASSERT_EQ(0, Codec_OSAL_SetControl(&mCtx, kCtrls[1], 8));
+    EXPECT_EQ(0, Codec_OSAL_EndControls(&mCtx));
+
+    CtrlStat stat = takeStat();
+    EXPECT_EQ(1, stat.setExtCtrlCall);
+    EXPECT_EQ(std::vector<unsigned int>{ kCtrls[1] }, stat.ids);
+}